@@ -0,0 +1,241 @@
+#include "array_format.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Paires de chiffres "00" à "99" : deux chiffres par division
+static const char DIGIT_PAIRS[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+// Au-delà, v * 100 ne tient plus exactement dans un entier 64 bits : repli
+// sur snprintf (valeurs rares, hors des distributions générées)
+#define FORMAT_FLOAT_FAST_LIMIT 1e15
+
+// Éléments formatés entre deux vérifications de capacité
+#define FORMAT_BLOCK 1024
+
+// Longueur maximale d'un élément formaté (hors chaînes)
+#define FORMAT_INT_MAX 11
+#define FORMAT_FLOAT_MAX 48
+
+void dsa_text_buffer_clear(DsaTextBuffer *buffer) {
+  buffer->length = 0;
+  if (buffer->text)
+    buffer->text[0] = '\0';
+}
+
+void dsa_text_buffer_free(DsaTextBuffer *buffer) {
+  free(buffer->text);
+  buffer->text = NULL;
+  buffer->length = 0;
+  buffer->capacity = 0;
+}
+
+// Garantit `extra` caractères libres (plus le '\0')
+static bool text_buffer_reserve(DsaTextBuffer *buffer, size_t extra) {
+  size_t needed = buffer->length + extra + 1;
+  if (needed <= buffer->capacity)
+    return true;
+  size_t capacity = buffer->capacity ? buffer->capacity : 256;
+  while (capacity < needed)
+    capacity *= 2;
+  char *text = realloc(buffer->text, capacity);
+  if (!text)
+    return false;
+  buffer->text = text;
+  buffer->capacity = capacity;
+  return true;
+}
+
+bool dsa_text_buffer_append(DsaTextBuffer *buffer, const char *text,
+                            size_t length) {
+  if (!text_buffer_reserve(buffer, length))
+    return false;
+  memcpy(buffer->text + buffer->length, text, length);
+  buffer->length += length;
+  buffer->text[buffer->length] = '\0';
+  return true;
+}
+
+// Chiffres de `value` écrits de droite à gauche à partir de `end`
+static char *write_digits(char *end, uint64_t value) {
+  while (value >= 100) {
+    unsigned pair = (unsigned)(value % 100) * 2;
+    value /= 100;
+    end -= 2;
+    memcpy(end, DIGIT_PAIRS + pair, 2);
+  }
+  if (value >= 10) {
+    end -= 2;
+    memcpy(end, DIGIT_PAIRS + value * 2, 2);
+  } else {
+    *--end = (char)('0' + value);
+  }
+  return end;
+}
+
+// Écrit la valeur sans '\0' final et retourne le nombre de caractères
+static size_t format_int(char *out, int value) {
+  char digits[FORMAT_INT_MAX];
+  char *end = digits + sizeof(digits);
+  // Magnitude en non signé : -INT_MIN déborde un int
+  uint64_t magnitude = value < 0 ? (uint64_t)0 - (uint64_t)(int64_t)value
+                                 : (uint64_t)value;
+  char *start = write_digits(end, magnitude);
+  size_t length = 0;
+  if (value < 0)
+    out[length++] = '-';
+  memcpy(out + length, start, (size_t)(end - start));
+  return length + (size_t)(end - start);
+}
+
+// Même texte que printf("%.2f")
+static size_t format_float(char *out, float value) {
+  double magnitude = fabs((double)value);
+  if (!(magnitude < FORMAT_FLOAT_FAST_LIMIT)) { // NaN, infinis, très grands
+    char tmp[FORMAT_FLOAT_MAX + 1];
+    int written = snprintf(tmp, sizeof(tmp), "%.2f", value);
+    size_t length = written > 0 ? (size_t)written : 0;
+    if (length > FORMAT_FLOAT_MAX)
+      length = FORMAT_FLOAT_MAX;
+    memcpy(out, tmp, length);
+    return length;
+  }
+
+  // float * 100 est exact en double ; nearbyint arrondit les égalités au
+  // pair, comme printf
+  uint64_t cents = (uint64_t)nearbyint(magnitude * 100.0);
+  char digits[24];
+  char *end = digits + sizeof(digits);
+  end -= 2;
+  memcpy(end, DIGIT_PAIRS + (cents % 100) * 2, 2);
+  *--end = '.';
+  char *start = write_digits(end, cents / 100);
+  end = digits + sizeof(digits);
+
+  size_t length = 0;
+  if (signbit(value)) // printf écrit aussi "-0.00"
+    out[length++] = '-';
+  memcpy(out + length, start, (size_t)(end - start));
+  return length + (size_t)(end - start);
+}
+
+size_t dsa_array_format_line_length(DsaDataType type) {
+  switch (type) {
+  case DSA_TYPE_INT:
+    return 100;
+  case DSA_TYPE_FLOAT:
+    return 80;
+  case DSA_TYPE_CHAR:
+    return 150;
+  case DSA_TYPE_STRING:
+    return 50;
+  }
+  return 100;
+}
+
+// Place maximale d'un élément et de son séparateur
+static size_t element_room(const DsaArrayData *data, size_t index) {
+  switch (data->type) {
+  case DSA_TYPE_INT:
+    return FORMAT_INT_MAX + 2;
+  case DSA_TYPE_FLOAT:
+    return FORMAT_FLOAT_MAX + 2;
+  case DSA_TYPE_CHAR:
+    return 1 + 2;
+  case DSA_TYPE_STRING:
+    return strlen(((char **)data->array)[index]) + 2;
+  }
+  return 2;
+}
+
+bool dsa_array_format_append(DsaTextBuffer *buffer, const DsaArrayData *data,
+                             size_t begin, size_t end, size_t per_line) {
+  if (end > data->size)
+    end = data->size;
+  if (!text_buffer_reserve(buffer, 0))
+    return false;
+
+  for (size_t block = begin; block < end; block += FORMAT_BLOCK) {
+    size_t block_end = end - block < FORMAT_BLOCK ? end : block + FORMAT_BLOCK;
+
+    size_t room = 0;
+    if (data->type == DSA_TYPE_STRING) {
+      for (size_t i = block; i < block_end; i++)
+        room += element_room(data, i);
+    } else {
+      room = (block_end - block) * element_room(data, block);
+    }
+    if (!text_buffer_reserve(buffer, room))
+      return false;
+
+    char *ptr = buffer->text + buffer->length;
+    for (size_t i = block; i < block_end; i++) {
+      switch (data->type) {
+      case DSA_TYPE_INT:
+        ptr += format_int(ptr, ((int *)data->array)[i]);
+        break;
+      case DSA_TYPE_FLOAT:
+        ptr += format_float(ptr, ((float *)data->array)[i]);
+        break;
+      case DSA_TYPE_CHAR:
+        *ptr++ = ((char *)data->array)[i];
+        break;
+      case DSA_TYPE_STRING: {
+        const char *str = ((char **)data->array)[i];
+        size_t len = strlen(str);
+        memcpy(ptr, str, len);
+        ptr += len;
+        break;
+      }
+      }
+
+      if (i + 1 < end) {
+        if (per_line && (i + 1) % per_line == 0) {
+          *ptr++ = '\n';
+        } else {
+          *ptr++ = ',';
+          *ptr++ = ' ';
+        }
+      }
+    }
+    buffer->length = (size_t)(ptr - buffer->text);
+  }
+
+  buffer->text[buffer->length] = '\0';
+  return true;
+}
+
+bool dsa_array_format_stream(const DsaArrayData *data, size_t per_line,
+                             DsaArrayFormatSink sink, void *context) {
+  DsaTextBuffer buffer = {0};
+  bool ok = true;
+  for (size_t begin = 0; ok && begin < data->size;
+       begin += DSA_ARRAY_FORMAT_CHUNK) {
+    size_t end = data->size - begin < DSA_ARRAY_FORMAT_CHUNK
+                     ? data->size
+                     : begin + DSA_ARRAY_FORMAT_CHUNK;
+    dsa_text_buffer_clear(&buffer);
+    ok = dsa_array_format_append(&buffer, data, begin, end, per_line);
+    // Séparateur entre deux tranches (omis par dsa_array_format_append)
+    if (ok && end < data->size)
+      ok = per_line && end % per_line == 0
+               ? dsa_text_buffer_append(&buffer, "\n", 1)
+               : dsa_text_buffer_append(&buffer, ", ", 2);
+    if (ok)
+      ok = sink(buffer.text, buffer.length, context);
+  }
+  dsa_text_buffer_free(&buffer);
+  return ok;
+}
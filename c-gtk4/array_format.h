@@ -0,0 +1,47 @@
+#ifndef ARRAY_FORMAT_H
+#define ARRAY_FORMAT_H
+
+#include "sort_algorithms.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+// Mise en texte rapide des tableaux (sans sprintf : table de paires de
+// chiffres). Le texte est produit par tranches dans un tampon réutilisable,
+// ce qui permet d'afficher ou d'enregistrer un extrait sans formater tout le
+// tableau. Les réels sont écrits comme printf("%.2f").
+
+// Tampon de texte réutilisable : sa capacité croît au besoin et n'est jamais
+// réduite, `text` est toujours terminé par '\0'
+typedef struct {
+  char *text;
+  size_t length;
+  size_t capacity;
+} DsaTextBuffer;
+
+void dsa_text_buffer_clear(DsaTextBuffer *buffer);
+void dsa_text_buffer_free(DsaTextBuffer *buffer);
+// Ajoute `length` caractères ; retourne false si la mémoire manque
+bool dsa_text_buffer_append(DsaTextBuffer *buffer, const char *text,
+                            size_t length);
+
+// Nombre de valeurs par ligne utilisé par dsa_array_to_string
+size_t dsa_array_format_line_length(DsaDataType type);
+
+// Ajoute au tampon les éléments [begin, end) séparés par ", ", avec un saut
+// de ligne après chaque multiple de `per_line` (indices du tableau ; 0 :
+// jamais). Retourne false si la mémoire manque.
+bool dsa_array_format_append(DsaTextBuffer *buffer, const DsaArrayData *data,
+                             size_t begin, size_t end, size_t per_line);
+
+// Reçoit le texte par tranches ; retourne false pour interrompre l'écriture
+typedef bool (*DsaArrayFormatSink)(const char *text, size_t length,
+                                   void *context);
+
+// Formate tout le tableau par tranches d'DSA_ARRAY_FORMAT_CHUNK éléments, sans
+// jamais le tenir entièrement en mémoire. Retourne false si la mémoire manque
+// ou si `sink` a interrompu l'écriture.
+#define DSA_ARRAY_FORMAT_CHUNK 4096
+bool dsa_array_format_stream(const DsaArrayData *data, size_t per_line,
+                             DsaArrayFormatSink sink, void *context);
+
+#endif
@@ -0,0 +1,446 @@
+#include "array_generators.h"
+#include "prng.h"
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- Table des distributions ---
+// Une distribution = une source de valeurs + une disposition. Ajouter une
+// distribution revient à ajouter une ligne (et au besoin une source ou une
+// disposition).
+
+typedef enum {
+  VALUES_UNIFORM, // même plage que l'ancien dsa_generate_random_data()
+  VALUES_FEW_UNIQUE,
+  VALUES_ZIPF,
+  VALUES_FULL_RANGE
+} ValueSource;
+
+typedef enum {
+  LAYOUT_RANDOM,
+  LAYOUT_SORTED,
+  LAYOUT_REVERSED,
+  LAYOUT_PERTURBED,
+  LAYOUT_ORGAN_PIPE
+} Layout;
+
+typedef struct {
+  const char *name;
+  const char *label;
+  ValueSource values;
+  Layout layout;
+} ArrayGenerator;
+
+static const ArrayGenerator GENERATORS[DSA_ARRAY_DISTRIBUTION_COUNT] = {
+    [DSA_DIST_UNIFORM] = {"uniform", "Aléatoire", VALUES_UNIFORM,
+                          LAYOUT_RANDOM},
+    [DSA_DIST_SORTED] = {"sorted", "Trié", VALUES_UNIFORM, LAYOUT_SORTED},
+    [DSA_DIST_REVERSED] = {"reversed", "Inversé", VALUES_UNIFORM,
+                           LAYOUT_REVERSED},
+    [DSA_DIST_PERTURBED] = {"perturbed", "Presque trié", VALUES_UNIFORM,
+                            LAYOUT_PERTURBED},
+    [DSA_DIST_ORGAN_PIPE] = {"organ-pipe", "Tuyaux d'orgue", VALUES_UNIFORM,
+                             LAYOUT_ORGAN_PIPE},
+    [DSA_DIST_FEW_UNIQUE] = {"few-unique", "Peu de valeurs distinctes",
+                             VALUES_FEW_UNIQUE, LAYOUT_RANDOM},
+    [DSA_DIST_ZIPF] = {"zipf", "Zipf", VALUES_ZIPF, LAYOUT_RANDOM},
+    [DSA_DIST_FULL_RANGE] = {"full-range", "Intervalle complet",
+                             VALUES_FULL_RANGE, LAYOUT_RANDOM},
+};
+
+#define UNIFORM_INT_RANGE 1000
+#define STRING_KEY_LENGTH 4
+
+// Remplissage en bloc : taille d'un bloc (un flux par bloc) et taille à
+// partir de laquelle les blocs sont répartis sur plusieurs threads
+#define GEN_BLOCK ((size_t)1 << 16)
+#define GEN_PARALLEL_THRESHOLD ((size_t)1 << 22)
+#define GEN_MAX_THREADS 64
+
+DsaArrayGenOptions dsa_array_gen_options(DsaArrayDistribution distribution,
+                                         uint64_t seed) {
+  DsaArrayGenOptions options = {0};
+  options.distribution = distribution;
+  options.seed = seed;
+  options.perturb_percent = 1.0;
+  options.unique_values = distribution == DSA_DIST_ZIPF ? UNIFORM_INT_RANGE : 8;
+  options.zipf_exponent = 1.0;
+  return options;
+}
+
+const char *dsa_array_distribution_name(DsaArrayDistribution distribution) {
+  if ((unsigned)distribution >= DSA_ARRAY_DISTRIBUTION_COUNT)
+    return "?";
+  return GENERATORS[distribution].name;
+}
+
+const char *dsa_array_distribution_label(DsaArrayDistribution distribution) {
+  if ((unsigned)distribution >= DSA_ARRAY_DISTRIBUTION_COUNT)
+    return "?";
+  return GENERATORS[distribution].label;
+}
+
+int dsa_array_distribution_from_name(const char *name) {
+  for (int d = 0; d < DSA_ARRAY_DISTRIBUTION_COUNT; d++) {
+    if (strcmp(GENERATORS[d].name, name) == 0)
+      return d;
+  }
+  return -1;
+}
+
+// --- Loi de Zipf ---
+// Fonction de répartition cumulée des rangs 1..n, puis recherche dichotomique
+// pour chaque tirage : O(log n) par élément.
+
+typedef struct {
+  double *cdf;
+  uint32_t count;
+} ZipfTable;
+
+static bool zipf_init(ZipfTable *zipf, uint32_t count, double exponent) {
+  zipf->count = count ? count : 1;
+  zipf->cdf = malloc(zipf->count * sizeof(double));
+  if (!zipf->cdf)
+    return false;
+
+  double sum = 0.0;
+  for (uint32_t k = 0; k < zipf->count; k++) {
+    sum += 1.0 / pow((double)(k + 1), exponent);
+    zipf->cdf[k] = sum;
+  }
+  for (uint32_t k = 0; k < zipf->count; k++)
+    zipf->cdf[k] /= sum;
+  return true;
+}
+
+// Rang (0 = le plus fréquent) correspondant au tirage uniforme u de [0, 1)
+static uint32_t zipf_rank(const ZipfTable *zipf, double u) {
+  uint32_t low = 0;
+  uint32_t high = zipf->count - 1;
+  while (low < high) {
+    uint32_t mid = low + (high - low) / 2;
+    if (zipf->cdf[mid] < u)
+      low = mid + 1;
+    else
+      high = mid;
+  }
+  return low;
+}
+
+static uint32_t zipf_sample(const ZipfTable *zipf, DsaPrng *rng) {
+  return zipf_rank(zipf, dsa_prng_double(rng));
+}
+
+// --- Remplissage en bloc des clés ---
+// Le bloc b est tiré du générateur de la graine avancé de b sauts
+// (dsa_prng_jump) : le résultat ne dépend ni du nombre de threads ni du jeu
+// d'instructions.
+
+typedef struct {
+  uint32_t *keys;
+  size_t count;
+  uint32_t bound;
+  uint64_t seed;
+  int thread;
+  int threads;
+} KeyFillTask;
+
+static void *fill_keys_worker(void *arg) {
+  KeyFillTask *task = arg;
+  DsaPrng rng;
+  dsa_prng_seed(&rng, task->seed);
+  for (int t = 0; t < task->thread; t++)
+    dsa_prng_jump(&rng);
+
+  size_t blocks = (task->count + GEN_BLOCK - 1) / GEN_BLOCK;
+  for (size_t b = (size_t)task->thread; b < blocks; b += task->threads) {
+    size_t begin = b * GEN_BLOCK;
+    size_t len = task->count - begin < GEN_BLOCK ? task->count - begin
+                                                 : GEN_BLOCK;
+    DsaPrng block = rng;
+    dsa_prng_fill_u32(&block, task->keys + begin, len, task->bound);
+    for (int t = 0; t < task->threads; t++)
+      dsa_prng_jump(&rng);
+  }
+  return NULL;
+}
+
+// `count` clés dans [0, bound) (bound = 0 : 32 bits bruts)
+static void fill_keys(uint32_t *keys, size_t count, uint32_t bound,
+                      uint64_t seed) {
+  int threads = 1;
+  if (count >= GEN_PARALLEL_THRESHOLD) {
+    size_t blocks = (count + GEN_BLOCK - 1) / GEN_BLOCK;
+    threads = dsa_sort_get_thread_count();
+    if (threads > GEN_MAX_THREADS)
+      threads = GEN_MAX_THREADS;
+    if ((size_t)threads > blocks)
+      threads = (int)blocks;
+  }
+
+  KeyFillTask tasks[GEN_MAX_THREADS];
+  pthread_t ids[GEN_MAX_THREADS];
+  bool started[GEN_MAX_THREADS];
+  for (int t = 0; t < threads; t++)
+    tasks[t] = (KeyFillTask){keys, count, bound, seed, t, threads};
+
+  // La dernière tâche s'exécute sur le thread appelant, ainsi que celles
+  // dont le thread n'a pas pu être créé
+  for (int t = 0; t < threads - 1; t++) {
+    started[t] =
+        pthread_create(&ids[t], NULL, fill_keys_worker, &tasks[t]) == 0;
+    if (!started[t])
+      fill_keys_worker(&tasks[t]);
+  }
+  fill_keys_worker(&tasks[threads - 1]);
+  for (int t = 0; t < threads - 1; t++) {
+    if (started[t])
+      pthread_join(ids[t], NULL);
+  }
+}
+
+// --- Génération des valeurs ---
+
+// Clé entière selon la source (hors VALUES_UNIFORM, propre à chaque type)
+static uint32_t draw_key(ValueSource source, const DsaArrayGenOptions *options,
+                         const ZipfTable *zipf, DsaPrng *rng) {
+  switch (source) {
+  case VALUES_FEW_UNIQUE:
+    return dsa_prng_bounded(rng, options->unique_values ? options->unique_values
+                                                        : 1);
+  case VALUES_ZIPF:
+    return zipf_sample(zipf, rng);
+  case VALUES_UNIFORM:
+    return dsa_prng_bounded(rng, UNIFORM_INT_RANGE);
+  case VALUES_FULL_RANGE:
+    break;
+  }
+  return dsa_prng_next32(rng);
+}
+
+// Chaîne dont l'ordre lexicographique suit celui de la clé (base 26)
+static char *key_to_string(uint32_t key) {
+  char *str = malloc(STRING_KEY_LENGTH + 1);
+  if (!str)
+    return NULL;
+  for (int c = STRING_KEY_LENGTH - 1; c >= 0; c--) {
+    str[c] = 'a' + (char)(key % 26);
+    key /= 26;
+  }
+  str[STRING_KEY_LENGTH] = '\0';
+  return str;
+}
+
+// Chaîne minuscule aléatoire de min_len à max_len caractères
+static char *random_string(DsaPrng *rng, int min_len, int max_len) {
+  uint32_t span = (uint32_t)(max_len - min_len + 1);
+  int len = min_len + (int)dsa_prng_bounded(rng, span);
+  char *str = malloc(len + 1);
+  if (!str)
+    return NULL;
+  for (int c = 0; c < len; c++)
+    str[c] = 'a' + (char)dsa_prng_bounded(rng, 26);
+  str[len] = '\0';
+  return str;
+}
+
+// Borne des clés tirées en bloc (0 : 32 bits bruts, convertis ensuite)
+static uint32_t key_bound(DsaDataType type, ValueSource source,
+                          const DsaArrayGenOptions *options) {
+  switch (source) {
+  case VALUES_UNIFORM:
+    if (type == DSA_TYPE_INT)
+      return UNIFORM_INT_RANGE;
+    return type == DSA_TYPE_CHAR ? 26 : 0;
+  case VALUES_FEW_UNIQUE:
+    return options->unique_values ? options->unique_values : 1;
+  case VALUES_ZIPF:
+    return 0;
+  case VALUES_FULL_RANGE:
+    return type == DSA_TYPE_CHAR ? 95 : 0; // caractères : ASCII imprimable
+  }
+  return 0;
+}
+
+static double key_to_unit(uint32_t key) { return (double)key * 0x1.0p-32; }
+
+// Chaînes : une allocation par élément, tirages scalaires
+static bool fill_strings(char **arr, size_t size, ValueSource source,
+                         const DsaArrayGenOptions *options,
+                         const ZipfTable *zipf, DsaPrng *rng) {
+  for (size_t i = 0; i < size; i++) {
+    if (source == VALUES_UNIFORM)
+      arr[i] = random_string(rng, 3, 7);
+    else if (source == VALUES_FULL_RANGE)
+      arr[i] = random_string(rng, 1, 16);
+    else
+      arr[i] = key_to_string(draw_key(source, options, zipf, rng));
+    if (!arr[i])
+      return false; // les éléments suivants sont à NULL (calloc)
+  }
+  return true;
+}
+
+// Entiers, réels et caractères : clés tirées en bloc (AVX2, multi-thread
+// pour les grands tableaux) puis converties dans le type de l'élément
+static bool fill_values(DsaArrayData *data, ValueSource source,
+                        const DsaArrayGenOptions *options,
+                        const ZipfTable *zipf, DsaPrng *rng) {
+  size_t size = data->size;
+  if (data->type == DSA_TYPE_STRING)
+    return fill_strings(data->array, size, source, options, zipf, rng);
+
+  // Les entiers reçoivent les clés directement dans le tableau
+  uint32_t *keys = data->type == DSA_TYPE_INT ? data->array
+                                              : malloc(size * sizeof(uint32_t));
+  if (!keys)
+    return false;
+  fill_keys(keys, size, key_bound(data->type, source, options),
+            options->seed);
+
+  switch (data->type) {
+  case DSA_TYPE_INT: {
+    int *arr = data->array;
+    if (source == VALUES_ZIPF) {
+      for (size_t i = 0; i < size; i++)
+        arr[i] = (int)zipf_rank(zipf, key_to_unit(keys[i]));
+    }
+    break; // sinon les clés sont déjà les valeurs
+  }
+  case DSA_TYPE_FLOAT: {
+    float *arr = data->array;
+    for (size_t i = 0; i < size; i++) {
+      if (source == VALUES_UNIFORM)
+        arr[i] = (float)(key_to_unit(keys[i]) * 1000.0);
+      else if (source == VALUES_FULL_RANGE)
+        arr[i] = (float)(int32_t)keys[i];
+      else if (source == VALUES_ZIPF)
+        arr[i] = (float)zipf_rank(zipf, key_to_unit(keys[i]));
+      else
+        arr[i] = (float)keys[i];
+    }
+    break;
+  }
+  case DSA_TYPE_CHAR: {
+    char *arr = data->array;
+    for (size_t i = 0; i < size; i++) {
+      if (source == VALUES_FULL_RANGE)
+        arr[i] = (char)(' ' + keys[i]);
+      else if (source == VALUES_ZIPF)
+        arr[i] = 'A' + (char)(zipf_rank(zipf, key_to_unit(keys[i])) % 26);
+      else
+        arr[i] = 'A' + (char)(keys[i] % 26);
+    }
+    break;
+  }
+  case DSA_TYPE_STRING:
+    break;
+  }
+
+  if (keys != data->array)
+    free(keys);
+  return true;
+}
+
+// --- Dispositions ---
+
+static void swap_elements(char *base, size_t elem, size_t i, size_t j) {
+  char tmp[sizeof(double)];
+  memcpy(tmp, base + i * elem, elem);
+  memcpy(base + i * elem, base + j * elem, elem);
+  memcpy(base + j * elem, tmp, elem);
+}
+
+static void reverse_elements(char *base, size_t elem, size_t size) {
+  if (size < 2)
+    return;
+  for (size_t i = 0, j = size - 1; i < j; i++, j--)
+    swap_elements(base, elem, i, j);
+}
+
+// Éléments pairs du tableau trié en ordre croissant, puis impairs en ordre
+// décroissant : 0 2 4 ... 5 3 1
+static bool organ_pipe(char *base, size_t elem, size_t size) {
+  char *tmp = malloc(size * elem);
+  if (!tmp)
+    return false;
+  size_t out = 0;
+  for (size_t i = 0; i < size; i += 2)
+    memcpy(tmp + out++ * elem, base + i * elem, elem);
+  // Impairs en descendant ; i repasse au-dessus de size après l'indice 1
+  for (size_t i = (size % 2) ? size - 2 : size - 1; i < size; i -= 2)
+    memcpy(tmp + out++ * elem, base + i * elem, elem);
+  memcpy(base, tmp, size * elem);
+  free(tmp);
+  return true;
+}
+
+static bool apply_layout(DsaArrayData *data, Layout layout,
+                         const DsaArrayGenOptions *options, DsaPrng *rng) {
+  if (layout == LAYOUT_RANDOM || data->size < 2)
+    return true;
+
+  dsa_sort_array(data, DSA_ALGO_QUICK);
+
+  char *base = data->array;
+  size_t elem = dsa_array_element_size(data->type);
+  size_t size = data->size;
+
+  switch (layout) {
+  case LAYOUT_REVERSED:
+    reverse_elements(base, elem, size);
+    break;
+  case LAYOUT_PERTURBED: {
+    // Chaque échange déplace deux éléments
+    size_t swaps = (size_t)((double)size * options->perturb_percent / 200.0);
+    for (size_t k = 0; k < swaps; k++) {
+      size_t i = dsa_prng_bounded(rng, (uint32_t)size);
+      size_t j = dsa_prng_bounded(rng, (uint32_t)size);
+      swap_elements(base, elem, i, j);
+    }
+    break;
+  }
+  case LAYOUT_ORGAN_PIPE:
+    return organ_pipe(base, elem, size);
+  case LAYOUT_RANDOM:
+  case LAYOUT_SORTED:
+    break;
+  }
+  return true;
+}
+
+bool dsa_generate_array(DsaArrayData *data, size_t size, DsaDataType type,
+                        const DsaArrayGenOptions *options) {
+  dsa_free_array_data(data);
+  data->type = type;
+  if ((unsigned)options->distribution >= DSA_ARRAY_DISTRIBUTION_COUNT)
+    return false;
+  const ArrayGenerator *generator = &GENERATORS[options->distribution];
+
+  // calloc : en cas d'échec, les chaînes non allouées restent à NULL
+  data->array = calloc(size ? size : 1, dsa_array_element_size(type));
+  if (!data->array)
+    return false;
+  data->size = size;
+
+  // Flux des tirages scalaires (chaînes, dispositions), disjoint des voies
+  // du remplissage en bloc qui partent de la même graine
+  DsaPrng rng;
+  dsa_prng_seed(&rng, options->seed);
+  for (int lane = 0; lane < DSA_PRNG_FILL_LANES; lane++)
+    dsa_prng_long_jump(&rng);
+
+  ZipfTable zipf = {0};
+  bool ok = generator->values != VALUES_ZIPF ||
+            zipf_init(&zipf, options->unique_values, options->zipf_exponent);
+  if (ok)
+    ok = fill_values(data, generator->values, options, &zipf, &rng);
+  free(zipf.cdf);
+
+  if (ok)
+    ok = apply_layout(data, generator->layout, options, &rng);
+  if (!ok)
+    dsa_free_array_data(data);
+  return ok;
+}
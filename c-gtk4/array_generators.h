@@ -0,0 +1,52 @@
+#ifndef ARRAY_GENERATORS_H
+#define ARRAY_GENERATORS_H
+
+#include "sort_algorithms.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Distributions des données générées. Les tris adaptatifs (insertion, Shell)
+// et le choix du pivot réagissent très différemment selon l'ordre initial et
+// le nombre de doublons : un benchmark sur données uniformes seules ne les
+// départage pas.
+typedef enum {
+  DSA_DIST_UNIFORM,    // valeurs uniformes (entiers dans [0, 1000))
+  DSA_DIST_SORTED,     // uniformes puis triées
+  DSA_DIST_REVERSED,   // triées en ordre décroissant
+  DSA_DIST_PERTURBED,  // triées puis k % des éléments échangés au hasard
+  DSA_DIST_ORGAN_PIPE, // croissant puis décroissant (0 1 2 ... 2 1 0)
+  DSA_DIST_FEW_UNIQUE, // peu de valeurs distinctes
+  DSA_DIST_ZIPF,       // loi de Zipf : quelques valeurs très fréquentes
+  DSA_DIST_FULL_RANGE  // tout l'intervalle du type (entiers 32 bits, etc.)
+} DsaArrayDistribution;
+
+#define DSA_ARRAY_DISTRIBUTION_COUNT 8
+
+typedef struct {
+  DsaArrayDistribution distribution;
+  uint64_t seed;          // même graine => mêmes données
+  double perturb_percent; // DSA_DIST_PERTURBED : % d'éléments déplacés
+  uint32_t unique_values; // DSA_DIST_FEW_UNIQUE / ZIPF : valeurs distinctes
+  double zipf_exponent;   // DSA_DIST_ZIPF : exposant s (P(k) ~ 1 / k^s)
+} DsaArrayGenOptions;
+
+// Paramètres par défaut d'une distribution (1 %, 8 valeurs, Zipf s = 1 sur
+// 1000 valeurs)
+DsaArrayGenOptions dsa_array_gen_options(DsaArrayDistribution distribution,
+                                         uint64_t seed);
+
+// Remplace le contenu de `data` par `size` éléments de type `type` tirés
+// selon `options`. Retourne false si l'allocation échoue (data est alors
+// vide).
+bool dsa_generate_array(DsaArrayData *data, size_t size, DsaDataType type,
+                        const DsaArrayGenOptions *options);
+
+// Identifiant court ("uniform", "sorted", ...) et libellé pour l'interface
+const char *dsa_array_distribution_name(DsaArrayDistribution distribution);
+const char *dsa_array_distribution_label(DsaArrayDistribution distribution);
+
+// Recherche par identifiant court ; -1 si inconnu
+int dsa_array_distribution_from_name(const char *name);
+
+#endif
@@ -0,0 +1,405 @@
+#include "array_io.h"
+#include "array_format.h"
+#include "array_parse.h"
+#include "scratch_pool.h"
+#include <float.h>
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#define ARRAY_IO_HAVE_MMAP 0
+// Positions sur 64 bits : les fichiers peuvent dépasser 2 Go
+#define file_seek _fseeki64
+#define file_tell _ftelli64
+#else
+#define ARRAY_IO_HAVE_MMAP 1
+#define file_seek fseeko
+#define file_tell ftello
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Marqueur d'ordre des octets : relu à l'envers sur une machine d'un autre
+// boutisme
+#define ARRAY_FILE_BYTE_ORDER 0x01020304u
+#define ARRAY_FILE_HAS_SEED 1u
+
+// Taille des blocs lus par l'import CSV
+#define CSV_CHUNK (1 << 20)
+
+typedef struct {
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order;
+  uint32_t type;
+  uint32_t element_size;
+  uint64_t count;
+  uint64_t seed;
+  uint32_t flags;
+  uint8_t reserved[20];
+} ArrayFileHeader;
+
+_Static_assert(sizeof(ArrayFileHeader) == DSA_ARRAY_FILE_HEADER_SIZE,
+               "en-tête de 64 octets");
+
+const char *dsa_array_io_status_message(DsaArrayIoStatus status) {
+  switch (status) {
+  case DSA_ARRAY_IO_OK:
+    return "Succès";
+  case DSA_ARRAY_IO_ERR_OPEN:
+    return "Impossible d'ouvrir le fichier";
+  case DSA_ARRAY_IO_ERR_READ:
+    return "Erreur de lecture (fichier tronqué ?)";
+  case DSA_ARRAY_IO_ERR_WRITE:
+    return "Erreur d'écriture";
+  case DSA_ARRAY_IO_ERR_FORMAT:
+    return "Format de fichier invalide";
+  case DSA_ARRAY_IO_ERR_TYPE:
+    return "Type non pris en charge par le format binaire (chaînes)";
+  case DSA_ARRAY_IO_ERR_MEMORY:
+    return "Mémoire insuffisante";
+  case DSA_ARRAY_IO_ERR_PARSE:
+    return "Valeur invalide";
+  case DSA_ARRAY_IO_ERR_CANCELLED:
+    return "Opération annulée";
+  }
+  return "Erreur inconnue";
+}
+
+bool dsa_array_file_is_binary(const char *path) {
+  size_t len = strlen(path);
+  size_t ext = strlen(DSA_ARRAY_FILE_EXTENSION);
+  return len >= ext && strcmp(path + len - ext, DSA_ARRAY_FILE_EXTENSION) == 0;
+}
+
+// --- Format binaire ---
+
+static bool binary_type(DsaDataType type) {
+  return type == DSA_TYPE_INT || type == DSA_TYPE_FLOAT ||
+         type == DSA_TYPE_CHAR;
+}
+
+DsaArrayIoStatus dsa_array_write_header(FILE *file, DsaDataType type,
+                                        uint64_t count, const uint64_t *seed) {
+  if (!binary_type(type))
+    return DSA_ARRAY_IO_ERR_TYPE;
+
+  ArrayFileHeader header = {0};
+  memcpy(header.magic, DSA_ARRAY_FILE_MAGIC, sizeof(header.magic));
+  header.version = DSA_ARRAY_FILE_VERSION;
+  header.byte_order = ARRAY_FILE_BYTE_ORDER;
+  header.type = (uint32_t)type;
+  header.element_size = (uint32_t)dsa_array_element_size(type);
+  header.count = count;
+  if (seed) {
+    header.seed = *seed;
+    header.flags |= ARRAY_FILE_HAS_SEED;
+  }
+  return fwrite(&header, sizeof(header), 1, file) == 1 ? DSA_ARRAY_IO_OK
+                                                       : DSA_ARRAY_IO_ERR_WRITE;
+}
+
+DsaArrayIoStatus dsa_array_save_binary(const char *path,
+                                       const DsaArrayData *data,
+                                       const uint64_t *seed) {
+  if (!binary_type(data->type))
+    return DSA_ARRAY_IO_ERR_TYPE;
+
+  FILE *f = fopen(path, "wb");
+  if (!f)
+    return DSA_ARRAY_IO_ERR_OPEN;
+  size_t bytes = data->size * dsa_array_element_size(data->type);
+  DsaArrayIoStatus status =
+      dsa_array_write_header(f, data->type, data->size, seed);
+  if (status == DSA_ARRAY_IO_OK && bytes > 0 &&
+      fwrite(data->array, 1, bytes, f) != bytes)
+    status = DSA_ARRAY_IO_ERR_WRITE;
+  if (fclose(f) != 0 && status == DSA_ARRAY_IO_OK)
+    status = DSA_ARRAY_IO_ERR_WRITE;
+  return status;
+}
+
+// Vérifie l'en-tête et la taille du fichier (`file_size` : octets présents)
+static DsaArrayIoStatus check_header(const ArrayFileHeader *header,
+                                     uint64_t file_size,
+                                     DsaArrayFileInfo *info) {
+  if (memcmp(header->magic, DSA_ARRAY_FILE_MAGIC, sizeof(header->magic)) != 0 ||
+      header->version != DSA_ARRAY_FILE_VERSION ||
+      header->byte_order != ARRAY_FILE_BYTE_ORDER ||
+      header->type >= DSA_DATA_TYPE_COUNT ||
+      !binary_type((DsaDataType)header->type) ||
+      header->element_size != dsa_array_element_size((DsaDataType)header->type))
+    return DSA_ARRAY_IO_ERR_FORMAT;
+
+  if (file_size < DSA_ARRAY_FILE_HEADER_SIZE)
+    return DSA_ARRAY_IO_ERR_FORMAT;
+  uint64_t payload = file_size - DSA_ARRAY_FILE_HEADER_SIZE;
+  if (header->count > payload / header->element_size)
+    return DSA_ARRAY_IO_ERR_READ;
+  if (header->count > SIZE_MAX / header->element_size)
+    return DSA_ARRAY_IO_ERR_MEMORY;
+
+  info->type = (DsaDataType)header->type;
+  info->count = header->count;
+  info->has_seed = (header->flags & ARRAY_FILE_HAS_SEED) != 0;
+  info->seed = header->seed;
+  return DSA_ARRAY_IO_OK;
+}
+
+static DsaArrayIoStatus read_header(FILE *f, DsaArrayFileInfo *info) {
+  ArrayFileHeader header;
+  if (fread(&header, sizeof(header), 1, f) != 1)
+    return DSA_ARRAY_IO_ERR_FORMAT;
+  if (file_seek(f, 0, SEEK_END) != 0)
+    return DSA_ARRAY_IO_ERR_READ;
+  int64_t end = file_tell(f);
+  if (end < 0)
+    return DSA_ARRAY_IO_ERR_READ;
+  return check_header(&header, (uint64_t)end, info);
+}
+
+DsaArrayIoStatus dsa_array_read_info(const char *path, DsaArrayFileInfo *info) {
+  FILE *f = fopen(path, "rb");
+  if (!f)
+    return DSA_ARRAY_IO_ERR_OPEN;
+  DsaArrayIoStatus status = read_header(f, info);
+  fclose(f);
+  return status;
+}
+
+DsaArrayIoStatus dsa_array_open_binary(const char *path, DsaArrayFileInfo *info,
+                                       FILE **file) {
+  FILE *f = fopen(path, "rb");
+  if (!f)
+    return DSA_ARRAY_IO_ERR_OPEN;
+  DsaArrayIoStatus status = read_header(f, info);
+  if (status == DSA_ARRAY_IO_OK &&
+      file_seek(f, DSA_ARRAY_FILE_HEADER_SIZE, SEEK_SET) != 0)
+    status = DSA_ARRAY_IO_ERR_READ;
+  if (status != DSA_ARRAY_IO_OK) {
+    fclose(f);
+    return status;
+  }
+  *file = f;
+  return DSA_ARRAY_IO_OK;
+}
+
+#if ARRAY_IO_HAVE_MMAP
+
+DsaArrayIoStatus dsa_array_map_file(const char *path, unsigned flags,
+                                    DsaMappedArray *mapped) {
+  memset(mapped, 0, sizeof(*mapped));
+  bool writable = (flags & DSA_ARRAY_MAP_WRITE) != 0;
+  int fd = open(path, writable ? O_RDWR : O_RDONLY);
+  if (fd < 0)
+    return DSA_ARRAY_IO_ERR_OPEN;
+
+  struct stat st;
+  ArrayFileHeader header;
+  if (fstat(fd, &st) != 0 ||
+      pread(fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header)) {
+    close(fd);
+    return DSA_ARRAY_IO_ERR_FORMAT;
+  }
+  DsaArrayIoStatus status = check_header(&header, (uint64_t)st.st_size,
+                                         &mapped->info);
+  if (status != DSA_ARRAY_IO_OK) {
+    close(fd);
+    return status;
+  }
+
+  // Projection privée sans DSA_ARRAY_MAP_WRITE : les pages modifiées sont
+  // copiées à la demande et le fichier reste intact
+  size_t length = DSA_ARRAY_FILE_HEADER_SIZE +
+                  (size_t)mapped->info.count * header.element_size;
+  void *base = mmap(NULL, length, PROT_READ | PROT_WRITE,
+                    writable ? MAP_SHARED : MAP_PRIVATE, fd, 0);
+  close(fd); // La projection garde le fichier ouvert
+  if (base == MAP_FAILED)
+    return DSA_ARRAY_IO_ERR_MEMORY;
+
+  mapped->base = base;
+  mapped->length = length;
+  mapped->writable = writable;
+  mapped->mapped = true;
+  mapped->data.array = (char *)base + DSA_ARRAY_FILE_HEADER_SIZE;
+  mapped->data.size = (size_t)mapped->info.count;
+  mapped->data.type = mapped->info.type;
+  return DSA_ARRAY_IO_OK;
+}
+
+DsaArrayIoStatus dsa_array_mapped_sync(DsaMappedArray *mapped) {
+  if (!mapped->base || !mapped->writable)
+    return DSA_ARRAY_IO_OK;
+  return msync(mapped->base, mapped->length, MS_SYNC) == 0
+             ? DSA_ARRAY_IO_OK
+             : DSA_ARRAY_IO_ERR_WRITE;
+}
+
+void dsa_array_unmap(DsaMappedArray *mapped) {
+  if (mapped->base)
+    munmap(mapped->base, mapped->length);
+  memset(mapped, 0, sizeof(*mapped));
+}
+
+#else // Repli sans mmap : lecture complète dans un tampon aligné
+
+DsaArrayIoStatus dsa_array_map_file(const char *path, unsigned flags,
+                                    DsaMappedArray *mapped) {
+  memset(mapped, 0, sizeof(*mapped));
+  FILE *f = fopen(path, "rb");
+  if (!f)
+    return DSA_ARRAY_IO_ERR_OPEN;
+  DsaArrayIoStatus status = read_header(f, &mapped->info);
+  size_t length = 0;
+  void *base = NULL;
+  if (status == DSA_ARRAY_IO_OK) {
+    length = DSA_ARRAY_FILE_HEADER_SIZE +
+             (size_t)mapped->info.count *
+                 dsa_array_element_size(mapped->info.type);
+    base = dsa_aligned_buffer_alloc(length);
+    if (!base)
+      status = DSA_ARRAY_IO_ERR_MEMORY;
+    else if (file_seek(f, 0, SEEK_SET) != 0 ||
+             fread(base, 1, length, f) != length)
+      status = DSA_ARRAY_IO_ERR_READ;
+  }
+  fclose(f);
+  if (status == DSA_ARRAY_IO_OK && (flags & DSA_ARRAY_MAP_WRITE)) {
+    mapped->path = strdup(path);
+    if (!mapped->path)
+      status = DSA_ARRAY_IO_ERR_MEMORY;
+  }
+  if (status != DSA_ARRAY_IO_OK) {
+    dsa_aligned_buffer_free(base);
+    return status;
+  }
+
+  mapped->base = base;
+  mapped->length = length;
+  mapped->writable = (flags & DSA_ARRAY_MAP_WRITE) != 0;
+  mapped->data.array = (char *)base + DSA_ARRAY_FILE_HEADER_SIZE;
+  mapped->data.size = (size_t)mapped->info.count;
+  mapped->data.type = mapped->info.type;
+  return DSA_ARRAY_IO_OK;
+}
+
+DsaArrayIoStatus dsa_array_mapped_sync(DsaMappedArray *mapped) {
+  if (!mapped->base || !mapped->writable)
+    return DSA_ARRAY_IO_OK;
+  FILE *f = fopen(mapped->path, "r+b");
+  if (!f)
+    return DSA_ARRAY_IO_ERR_OPEN;
+  size_t bytes = mapped->length - DSA_ARRAY_FILE_HEADER_SIZE;
+  bool ok = file_seek(f, DSA_ARRAY_FILE_HEADER_SIZE, SEEK_SET) == 0 &&
+            fwrite(mapped->data.array, 1, bytes, f) == bytes;
+  ok = fclose(f) == 0 && ok;
+  return ok ? DSA_ARRAY_IO_OK : DSA_ARRAY_IO_ERR_WRITE;
+}
+
+void dsa_array_unmap(DsaMappedArray *mapped) {
+  dsa_array_mapped_sync(mapped);
+  dsa_aligned_buffer_free(mapped->base);
+  free(mapped->path);
+  memset(mapped, 0, sizeof(*mapped));
+}
+
+#endif
+
+// --- Format CSV ---
+
+DsaArrayIoStatus dsa_array_import_csv(const char *path, DsaDataType type,
+                                      DsaArrayData *out, size_t *error_line) {
+  dsa_free_array_data(out);
+  out->type = type;
+
+  FILE *f = fopen(path, "rb");
+  if (!f)
+    return DSA_ARRAY_IO_ERR_OPEN;
+  char *chunk = malloc(CSV_CHUNK);
+  if (!chunk) {
+    fclose(f);
+    return DSA_ARRAY_IO_ERR_MEMORY;
+  }
+
+  // Une valeur coupée entre deux blocs est reprise par le parseur
+  DsaArrayParser parser;
+  dsa_array_parser_init(&parser, out, type, 0);
+  DsaArrayParseStatus parsed = DSA_ARRAY_PARSE_OK;
+  DsaArrayIoStatus status = DSA_ARRAY_IO_OK;
+  for (;;) {
+    size_t n = fread(chunk, 1, CSV_CHUNK, f);
+    if (n == 0) {
+      if (ferror(f))
+        status = DSA_ARRAY_IO_ERR_READ;
+      break;
+    }
+    parsed = dsa_array_parser_feed(&parser, chunk, n);
+    if (parsed != DSA_ARRAY_PARSE_OK)
+      break;
+  }
+  if (status == DSA_ARRAY_IO_OK && parsed == DSA_ARRAY_PARSE_OK)
+    parsed = dsa_array_parser_finish(&parser);
+  if (status == DSA_ARRAY_IO_OK && parsed != DSA_ARRAY_PARSE_OK)
+    status = parsed == DSA_ARRAY_PARSE_MEMORY ? DSA_ARRAY_IO_ERR_MEMORY
+                                              : DSA_ARRAY_IO_ERR_PARSE;
+
+  if (error_line && status == DSA_ARRAY_IO_ERR_PARSE)
+    *error_line = parser.error.line;
+  if (status != DSA_ARRAY_IO_OK)
+    dsa_free_array_data(out);
+  free(chunk);
+  fclose(f);
+  return status;
+}
+
+static bool write_chunk(const char *text, size_t length, void *context) {
+  return fwrite(text, 1, length, context) == length;
+}
+
+// Réels écrits avec FLT_DECIMAL_DIG chiffres significatifs, qui suffisent à
+// retrouver le même float à la relecture (le formateur de array_format.h,
+// fait pour l'affichage, arrondit à deux décimales). Le point décimal de la
+// locale est remplacé par '.' : une virgule serait lue comme séparateur.
+static bool export_floats(FILE *f, const DsaArrayData *data) {
+  const char *point = localeconv()->decimal_point;
+  size_t point_length = strlen(point);
+  bool c_point = point_length == 1 && point[0] == '.';
+  const float *values = (const float *)data->array;
+  for (size_t i = 0; i < data->size; i++) {
+    char text[48];
+    int written = snprintf(text, sizeof(text), "%.*g", FLT_DECIMAL_DIG,
+                           (double)values[i]);
+    if (written < 0 || (size_t)written >= sizeof(text))
+      return false;
+    size_t length = (size_t)written;
+    char *found = c_point || point_length == 0 ? NULL : strstr(text, point);
+    if (found) {
+      *found = '.';
+      memmove(found + 1, found + point_length,
+              length - (size_t)(found - text) - point_length + 1);
+      length -= point_length - 1;
+    }
+    text[length++] = '\n';
+    if (fwrite(text, 1, length, f) != length)
+      return false;
+  }
+  return true;
+}
+
+DsaArrayIoStatus dsa_array_export_csv(const char *path,
+                                      const DsaArrayData *data) {
+  FILE *f = fopen(path, "w");
+  if (!f)
+    return DSA_ARRAY_IO_ERR_OPEN;
+  bool ok = data->type == DSA_TYPE_FLOAT
+                ? export_floats(f, data)
+                : dsa_array_format_stream(data, 1, write_chunk, f) &&
+                      (data->size == 0 || fputc('\n', f) != EOF);
+  ok = fclose(f) == 0 && ok;
+  return ok ? DSA_ARRAY_IO_OK : DSA_ARRAY_IO_ERR_WRITE;
+}
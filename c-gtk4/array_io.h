@@ -0,0 +1,111 @@
+#ifndef ARRAY_IO_H
+#define ARRAY_IO_H
+
+#include "sort_algorithms.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Lecture et écriture de tableaux sur disque.
+//
+// Format binaire (.dsa) : un en-tête de DSA_ARRAY_FILE_HEADER_SIZE octets
+// (type, nombre d'éléments, graine) suivi des éléments bruts, dans l'ordre des
+// octets de la machine. Les données commencent à un multiple de 64 octets :
+// le fichier peut être projeté en mémoire (dsa_array_map_file) et servir
+// directement de DsaArrayData.array, sans lecture ni conversion. Les chaînes
+// n'ont pas de taille fixe et ne sont pas acceptées par ce format.
+//
+// Format texte (CSV) : valeurs séparées par des virgules, points-virgules,
+// espaces ou retours à la ligne, lues par blocs (dsa_array_import_csv, avec le
+// parseur de array_parse.h). Les caractères séparateurs ne peuvent donc pas
+// figurer comme valeurs.
+
+#define DSA_ARRAY_FILE_MAGIC "DSARRAY\0"
+#define DSA_ARRAY_FILE_VERSION 1
+#define DSA_ARRAY_FILE_HEADER_SIZE 64
+#define DSA_ARRAY_FILE_EXTENSION ".dsa"
+
+typedef enum {
+  DSA_ARRAY_IO_OK,
+  DSA_ARRAY_IO_ERR_OPEN,     // Fichier introuvable ou illisible
+  DSA_ARRAY_IO_ERR_READ,     // Erreur de lecture ou fichier tronqué
+  DSA_ARRAY_IO_ERR_WRITE,    // Erreur d'écriture (disque plein...)
+  DSA_ARRAY_IO_ERR_FORMAT,   // En-tête invalide ou autre ordre des octets
+  DSA_ARRAY_IO_ERR_TYPE,     // Type non pris en charge (chaînes en binaire)
+  DSA_ARRAY_IO_ERR_MEMORY,   // Mémoire insuffisante
+  DSA_ARRAY_IO_ERR_PARSE,    // Valeur invalide dans un CSV
+  DSA_ARRAY_IO_ERR_CANCELLED // Opération annulée (tri externe)
+} DsaArrayIoStatus;
+
+// Message d'erreur lisible
+const char *dsa_array_io_status_message(DsaArrayIoStatus status);
+
+// Contenu de l'en-tête d'un fichier binaire
+typedef struct {
+  DsaDataType type;
+  uint64_t count;
+  bool has_seed; // Données générées : graine enregistrée
+  uint64_t seed;
+} DsaArrayFileInfo;
+
+// Vrai si le nom se termine par DSA_ARRAY_FILE_EXTENSION
+bool dsa_array_file_is_binary(const char *path);
+
+// Écrit `data` au format binaire ; `seed` (facultatif) est la graine des
+// données générées
+DsaArrayIoStatus dsa_array_save_binary(const char *path,
+                                       const DsaArrayData *data,
+                                       const uint64_t *seed);
+
+// Lit uniquement l'en-tête
+DsaArrayIoStatus dsa_array_read_info(const char *path, DsaArrayFileInfo *info);
+
+// Accès séquentiel (fichiers plus grands que la mémoire) : ouvre un fichier
+// binaire en lecture, positionné sur le premier élément
+DsaArrayIoStatus dsa_array_open_binary(const char *path, DsaArrayFileInfo *info,
+                                       FILE **file);
+// Écrit l'en-tête d'un fichier binaire ; les `count` éléments doivent suivre
+DsaArrayIoStatus dsa_array_write_header(FILE *file, DsaDataType type,
+                                        uint64_t count, const uint64_t *seed);
+
+// Fichier binaire projeté en mémoire : `data.array` pointe sur les éléments
+// du fichier et ne doit pas être libéré par dsa_free_array_data.
+//
+// Sans DSA_ARRAY_MAP_WRITE, la projection est privée : le tableau peut être
+// trié, seules les pages modifiées sont copiées et le fichier ne change pas.
+// Avec DSA_ARRAY_MAP_WRITE, les modifications (un tri sur place) sont écrites
+// dans le fichier, au plus tard par dsa_array_mapped_sync ou dsa_array_unmap.
+// Sans mmap (Windows), repli sur une lecture complète en mémoire, réécrite
+// dans le fichier par dsa_array_mapped_sync si DSA_ARRAY_MAP_WRITE est demandé.
+typedef struct {
+  DsaArrayData data;
+  DsaArrayFileInfo info;
+  void *base;    // Début de la projection (ou du tampon de repli)
+  size_t length; // Octets projetés
+  bool writable;
+  bool mapped; // false : tampon de repli
+  char *path;  // Fichier à réécrire (repli en écriture)
+} DsaMappedArray;
+
+#define DSA_ARRAY_MAP_WRITE 1u
+
+DsaArrayIoStatus dsa_array_map_file(const char *path, unsigned flags,
+                                    DsaMappedArray *mapped);
+DsaArrayIoStatus dsa_array_mapped_sync(DsaMappedArray *mapped);
+void dsa_array_unmap(DsaMappedArray *mapped);
+
+// Lit un CSV par blocs, sans charger le fichier entier en mémoire. En cas
+// d'erreur de valeur, `error_line` (facultatif) reçoit le numéro de ligne
+// (à partir de 1) et `out` est vide.
+DsaArrayIoStatus dsa_array_import_csv(const char *path, DsaDataType type,
+                                      DsaArrayData *out, size_t *error_line);
+
+// Écrit le tableau en CSV (une valeur par ligne), par tranches. Les réels
+// sont écrits avec assez de chiffres pour être relus à l'identique : un CSV
+// exporté se relit sans perte par dsa_array_import_csv (hors caractères et
+// chaînes contenant un séparateur).
+DsaArrayIoStatus dsa_array_export_csv(const char *path,
+                                      const DsaArrayData *data);
+
+#endif
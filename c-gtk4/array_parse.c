@@ -0,0 +1,442 @@
+#include "array_parse.h"
+#include <float.h>
+#include <limits.h>
+#include <locale.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__GNUC__) && defined(__SSE2__)
+#define ARRAY_PARSE_SSE2
+#include <emmintrin.h>
+#endif
+
+static const bool SEPARATOR[256] = {
+    [','] = true, [';'] = true,  [' '] = true,
+    ['\t'] = true, ['\n'] = true, ['\r'] = true,
+};
+
+static inline bool is_separator(char c) {
+  return SEPARATOR[(unsigned char)c];
+}
+
+static inline bool is_digit(char c) { return (unsigned char)(c - '0') < 10; }
+
+// Premier séparateur de [p, end), ou `end`
+static const char *find_separator(const char *p, const char *end) {
+#ifdef ARRAY_PARSE_SSE2
+  const __m128i comma = _mm_set1_epi8(',');
+  const __m128i semicolon = _mm_set1_epi8(';');
+  const __m128i space = _mm_set1_epi8(' ');
+  const __m128i tab = _mm_set1_epi8('\t');
+  const __m128i newline = _mm_set1_epi8('\n');
+  const __m128i carriage = _mm_set1_epi8('\r');
+  while (end - p >= 16) {
+    __m128i block = _mm_loadu_si128((const __m128i *)p);
+    __m128i hit = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(block, comma),
+                     _mm_cmpeq_epi8(block, semicolon)),
+        _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(block, space),
+                         _mm_cmpeq_epi8(block, tab)),
+            _mm_or_si128(_mm_cmpeq_epi8(block, newline),
+                         _mm_cmpeq_epi8(block, carriage))));
+    int mask = _mm_movemask_epi8(hit);
+    if (mask)
+      return p + __builtin_ctz((unsigned)mask);
+    p += 16;
+  }
+#endif
+  while (p < end && !is_separator(*p))
+    p++;
+  return p;
+}
+
+// Sauts de ligne dans [p, p + length) (position d'une erreur seulement)
+static size_t count_newlines(const char *p, size_t length) {
+  size_t count = 0;
+  const char *end = p + length;
+  while ((p = memchr(p, '\n', (size_t)(end - p))) != NULL) {
+    count++;
+    p++;
+  }
+  return count;
+}
+
+// --- Conversion des valeurs ---
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define ARRAY_PARSE_SWAR
+// Huit chiffres convertis ensemble dans un entier 64 bits (SWAR) : trois
+// multiplications au lieu de huit étapes dépendantes
+static inline bool parse_eight_digits(const char *p, uint32_t *out) {
+  uint64_t v;
+  memcpy(&v, p, sizeof(v));
+  // Chaque octet entre '0' (0x30) et '9' (0x39)
+  if (((v & 0xF0F0F0F0F0F0F0F0u) |
+       (((v + 0x0606060606060606u) & 0xF0F0F0F0F0F0F0F0u) >> 4)) !=
+      0x3333333333333333u)
+    return false;
+  v -= 0x3030303030303030u;
+  v = v * 10 + (v >> 8); // Paires de chiffres
+  v = (((v & 0x000000FF000000FFu) * (100 + (1000000ull << 32))) +
+       (((v >> 16) & 0x000000FF000000FFu) * (1 + (10000ull << 32)))) >>
+      32;
+  *out = (uint32_t)v;
+  return true;
+}
+#endif
+
+static bool parse_int(const char *p, size_t n, int *out) {
+  const char *end = p + n;
+  bool negative = false;
+  if (p < end && (*p == '-' || *p == '+'))
+    negative = *p++ == '-';
+  if (p == end)
+    return false;
+
+  // Zéros de tête ignorés : il reste au plus 10 chiffres utiles, qui
+  // tiennent sur 64 bits sans test de dépassement dans la boucle
+  while (end - p > 1 && *p == '0')
+    p++;
+  if (end - p > 10)
+    return false;
+  uint64_t value = 0;
+  unsigned bad = 0;
+#ifdef ARRAY_PARSE_SWAR
+  const char *swar = end - p >= 8 ? end - 8 : end;
+#else
+  const char *swar = end;
+#endif
+  for (; p < swar; p++) {
+    unsigned digit = (unsigned char)*p - (unsigned)'0';
+    bad |= digit > 9;
+    value = value * 10 + digit;
+  }
+#ifdef ARRAY_PARSE_SWAR
+  if (swar != end) {
+    uint32_t low;
+    if (!parse_eight_digits(swar, &low))
+      return false;
+    value = value * 100000000 + low;
+  }
+#endif
+  uint64_t limit = negative ? (uint64_t)INT_MAX + 1 : (uint64_t)INT_MAX;
+  if (bad || value > limit)
+    return false;
+  *out = negative ? (int)(0 - (int64_t)value) : (int)value;
+  return true;
+}
+
+// Puissances de 10 exactes en float (5^10 < 2^24) et en double (5^22 < 2^53)
+static const float POW10_FLOAT[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f,
+                                    1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+static const double POW10_DOUBLE[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+// Conversion directe de [+-]chiffres[.chiffres][(e|E)[+-]chiffres] quand
+// elle est exacte : mantisse et puissance de 10 représentables exactement,
+// une seule opération arrondie (comme strtof). Retourne false pour les
+// autres cas, confiés à strtof.
+static bool parse_float_fast(const char *p, size_t n, float *out) {
+#if FLT_EVAL_METHOD == 0
+  const char *end = p + n;
+  bool negative = false;
+  if (p < end && (*p == '-' || *p == '+'))
+    negative = *p++ == '-';
+
+  uint64_t mantissa = 0;
+  int exponent = 0;
+  bool any_digit = false;
+  for (; p < end && is_digit(*p); p++) {
+    if (mantissa > (UINT64_MAX - 9) / 10)
+      return false;
+    mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+    any_digit = true;
+  }
+  if (p < end && *p == '.') {
+    for (p++; p < end && is_digit(*p); p++) {
+      if (mantissa > (UINT64_MAX - 9) / 10)
+        return false;
+      mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+      exponent--;
+      any_digit = true;
+    }
+  }
+  if (!any_digit)
+    return false;
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    p++;
+    bool exp_negative = false;
+    if (p < end && (*p == '-' || *p == '+'))
+      exp_negative = *p++ == '-';
+    if (p == end)
+      return false;
+    int value = 0;
+    for (; p < end && is_digit(*p); p++) {
+      if (value > 1000)
+        return false;
+      value = value * 10 + (*p - '0');
+    }
+    exponent += exp_negative ? -value : value;
+  }
+  if (p != end)
+    return false;
+
+  float result;
+  if (mantissa == 0) {
+    result = 0.0f;
+  } else if (mantissa <= (1u << 24) && exponent >= -10 && exponent <= 10) {
+    result = (float)mantissa;
+    result = exponent < 0 ? result / POW10_FLOAT[-exponent]
+                          : result * POW10_FLOAT[exponent];
+  } else if (mantissa <= (1ull << 53) && exponent >= -22 && exponent <= 22) {
+    // Double arrondi exact, puis arrondi au float : faux seulement si le
+    // double tombe pile au milieu de deux floats (29 bits de poids faible)
+    double value = (double)mantissa;
+    value = exponent < 0 ? value / POW10_DOUBLE[-exponent]
+                         : value * POW10_DOUBLE[exponent];
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    if ((bits & 0x1FFFFFFFu) == 0x10000000u)
+      return false;
+    result = (float)value;
+  } else {
+    return false;
+  }
+  *out = negative ? -result : result;
+  return true;
+#else
+  (void)p;
+  (void)n;
+  (void)out;
+  return false;
+#endif
+}
+
+// Repli : strtof sur une copie terminée par '\0', le point décimal étant
+// remplacé par celui de la locale (GTK installe la locale de l'utilisateur)
+static bool parse_float_slow(const char *p, size_t n, float *out) {
+  char buffer[DSA_ARRAY_PARSE_MAX_TOKEN + 8];
+  const char *point = localeconv()->decimal_point;
+  size_t point_length = strlen(point);
+  size_t length = 0;
+  for (size_t i = 0; i < n; i++) {
+    if (p[i] == '.' && point_length > 0) {
+      if (length + point_length >= sizeof(buffer))
+        return false;
+      memcpy(buffer + length, point, point_length);
+      length += point_length;
+    } else {
+      if (length + 1 >= sizeof(buffer))
+        return false;
+      buffer[length++] = p[i];
+    }
+  }
+  buffer[length] = '\0';
+
+  char *end;
+  float value = strtof(buffer, &end);
+  if (length == 0 || *end != '\0')
+    return false;
+  *out = value;
+  return true;
+}
+
+static bool parse_float(const char *p, size_t n, float *out) {
+  return parse_float_fast(p, n, out) || parse_float_slow(p, n, out);
+}
+
+// --- Lecture par blocs ---
+
+void dsa_array_parser_init(DsaArrayParser *parser, DsaArrayData *out,
+                           DsaDataType type, unsigned flags) {
+  dsa_free_array_data(out);
+  out->type = type;
+  memset(parser, 0, sizeof(*parser));
+  parser->out = out;
+  parser->flags = flags;
+  parser->line = 1;
+}
+
+bool dsa_array_parser_reserve(DsaArrayParser *parser, size_t count) {
+  DsaArrayData *out = parser->out;
+  if (out->size + count <= parser->capacity)
+    return true;
+  size_t capacity = out->size + count;
+  void *array =
+      realloc(out->array, capacity * dsa_array_element_size(out->type));
+  if (!array)
+    return false;
+  out->array = array;
+  parser->capacity = capacity;
+  return true;
+}
+
+// Ajoute la valeur [p, p + n) au tableau
+static DsaArrayParseStatus add_value(DsaArrayParser *parser, const char *p,
+                                     size_t n) {
+  DsaArrayData *out = parser->out;
+  if (out->size == parser->capacity &&
+      !dsa_array_parser_reserve(parser, parser->capacity ? parser->capacity
+                                                         : 1024))
+    return DSA_ARRAY_PARSE_MEMORY;
+
+  switch (out->type) {
+  case DSA_TYPE_INT:
+    if (!parse_int(p, n, &((int *)out->array)[out->size]))
+      return DSA_ARRAY_PARSE_INVALID;
+    break;
+  case DSA_TYPE_FLOAT:
+    if (!parse_float(p, n, &((float *)out->array)[out->size]))
+      return DSA_ARRAY_PARSE_INVALID;
+    break;
+  case DSA_TYPE_CHAR:
+    if (n != 1)
+      return DSA_ARRAY_PARSE_INVALID;
+    if ((parser->flags & DSA_ARRAY_PARSE_NO_NUMBERS) && is_digit(p[0]))
+      return DSA_ARRAY_PARSE_NUMBER;
+    ((char *)out->array)[out->size] = p[0];
+    break;
+  case DSA_TYPE_STRING: {
+    float number;
+    if ((parser->flags & DSA_ARRAY_PARSE_NO_NUMBERS) &&
+        parse_float(p, n, &number))
+      return DSA_ARRAY_PARSE_NUMBER;
+    char *copy = malloc(n + 1);
+    if (!copy)
+      return DSA_ARRAY_PARSE_MEMORY;
+    memcpy(copy, p, n);
+    copy[n] = '\0';
+    ((char **)out->array)[out->size] = copy;
+    break;
+  }
+  }
+  out->size++;
+  return DSA_ARRAY_PARSE_OK;
+}
+
+// Erreur sur la valeur [offset, offset + length) : le tableau est vidé
+static DsaArrayParseStatus fail(DsaArrayParser *parser,
+                                DsaArrayParseStatus status, size_t offset,
+                                size_t length, size_t line) {
+  parser->error.offset = offset;
+  parser->error.length = length;
+  parser->error.index = parser->out->size;
+  parser->error.line = line;
+  dsa_free_array_data(parser->out);
+  parser->capacity = 0;
+  parser->carry_length = 0;
+  return status;
+}
+
+DsaArrayParseStatus dsa_array_parser_feed(DsaArrayParser *parser,
+                                          const char *chunk, size_t length) {
+  const char *p = chunk;
+  const char *end = chunk + length;
+
+  // Fin d'une valeur commencée dans le bloc précédent
+  if (parser->carry_length > 0) {
+    const char *stop = find_separator(p, end);
+    size_t piece = (size_t)(stop - p);
+    size_t total = parser->carry_length + piece;
+    if (total > DSA_ARRAY_PARSE_MAX_TOKEN)
+      return fail(parser, DSA_ARRAY_PARSE_INVALID, parser->carry_offset, total,
+                  parser->carry_line);
+    memcpy(parser->carry + parser->carry_length, p, piece);
+    parser->carry_length = total;
+    if (stop == end) {
+      parser->consumed += length;
+      return DSA_ARRAY_PARSE_OK;
+    }
+    DsaArrayParseStatus status = add_value(parser, parser->carry, total);
+    if (status != DSA_ARRAY_PARSE_OK)
+      return fail(parser, status, parser->carry_offset, total,
+                  parser->carry_line);
+    parser->carry_length = 0;
+    p = stop;
+  }
+
+  for (;;) {
+    while (p < end && is_separator(*p))
+      p++;
+    if (p == end)
+      break;
+
+    const char *token = p;
+    p = find_separator(p, end);
+    size_t n = (size_t)(p - token);
+    size_t offset = parser->consumed + (size_t)(token - chunk);
+    if (n > DSA_ARRAY_PARSE_MAX_TOKEN)
+      return fail(parser, DSA_ARRAY_PARSE_INVALID, offset, n,
+                  parser->line +
+                      count_newlines(chunk, (size_t)(token - chunk)));
+    if (p == end) {
+      // Valeur peut-être coupée : terminée par le bloc suivant ou par
+      // dsa_array_parser_finish
+      memcpy(parser->carry, token, n);
+      parser->carry_length = n;
+      parser->carry_offset = offset;
+      parser->carry_line =
+          parser->line + count_newlines(chunk, (size_t)(token - chunk));
+      break;
+    }
+
+    DsaArrayParseStatus status = add_value(parser, token, n);
+    if (status != DSA_ARRAY_PARSE_OK)
+      return fail(parser, status, offset, n,
+                  parser->line +
+                      count_newlines(chunk, (size_t)(token - chunk)));
+  }
+
+  parser->consumed += length;
+  parser->line += count_newlines(chunk, length);
+  return DSA_ARRAY_PARSE_OK;
+}
+
+DsaArrayParseStatus dsa_array_parser_finish(DsaArrayParser *parser) {
+  if (parser->carry_length > 0) {
+    DsaArrayParseStatus status =
+        add_value(parser, parser->carry, parser->carry_length);
+    if (status != DSA_ARRAY_PARSE_OK)
+      return fail(parser, status, parser->carry_offset, parser->carry_length,
+                  parser->carry_line);
+    parser->carry_length = 0;
+  }
+
+  // Rend la réserve inutilisée
+  DsaArrayData *out = parser->out;
+  if (out->array && parser->capacity > out->size && out->size > 0) {
+    void *array =
+        realloc(out->array, out->size * dsa_array_element_size(out->type));
+    if (array) {
+      out->array = array;
+      parser->capacity = out->size;
+    }
+  }
+  return DSA_ARRAY_PARSE_OK;
+}
+
+DsaArrayParseStatus dsa_array_parse_text(const char *text, size_t length,
+                                         DsaDataType type, unsigned flags,
+                                         DsaArrayData *out,
+                                         DsaArrayParseError *error) {
+  DsaArrayParser parser;
+  dsa_array_parser_init(&parser, out, type, flags);
+
+  // Au plus une valeur pour deux caractères : une seule réservation (les
+  // pages jamais écrites ne sont pas chargées), ajustée par finish
+  DsaArrayParseStatus status = DSA_ARRAY_PARSE_OK;
+  if (!dsa_array_parser_reserve(&parser, length / 2 + 1))
+    status = DSA_ARRAY_PARSE_MEMORY;
+  if (status == DSA_ARRAY_PARSE_OK)
+    status = dsa_array_parser_feed(&parser, text, length);
+  if (status == DSA_ARRAY_PARSE_OK)
+    status = dsa_array_parser_finish(&parser);
+  if (status == DSA_ARRAY_PARSE_MEMORY)
+    dsa_free_array_data(out);
+  if (error)
+    *error = parser.error;
+  return status;
+}
@@ -0,0 +1,70 @@
+#ifndef ARRAY_PARSE_H
+#define ARRAY_PARSE_H
+
+#include "sort_algorithms.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+// Lecture rapide d'une liste de valeurs en texte (saisie manuelle, CSV), en
+// une seule passe et sans allocation hors du tableau produit : les
+// séparateurs sont repérés 16 octets à la fois (SSE2), les entiers et réels
+// sont convertis sans strtol / strtof (repli sur strtof pour les réels que
+// la conversion directe ne garantit pas au bit près).
+//
+// Séparateurs : virgule, point-virgule, espace, tabulation, retours à la
+// ligne. Les réels acceptent la même syntaxe que strtof.
+
+// Longueur maximale d'une valeur
+#define DSA_ARRAY_PARSE_MAX_TOKEN 4096
+
+// Refuse les nombres comme caractères ou chaînes (saisie manuelle)
+#define DSA_ARRAY_PARSE_NO_NUMBERS 1u
+
+typedef enum {
+  DSA_ARRAY_PARSE_OK,
+  DSA_ARRAY_PARSE_INVALID, // Valeur invalide pour le type (ou trop longue)
+  DSA_ARRAY_PARSE_NUMBER,  // Nombre refusé (DSA_ARRAY_PARSE_NO_NUMBERS)
+  DSA_ARRAY_PARSE_MEMORY
+} DsaArrayParseStatus;
+
+// Première valeur refusée
+typedef struct {
+  size_t offset; // Position de son premier octet dans le texte
+  size_t length;
+  size_t index; // Rang de la valeur (à partir de 0)
+  size_t line;  // Ligne (à partir de 1)
+} DsaArrayParseError;
+
+// Lecture par blocs successifs : une valeur peut être coupée entre deux
+// blocs. `out` est complété au fil des blocs et vidé en cas d'erreur.
+typedef struct {
+  DsaArrayData *out;
+  size_t capacity; // Éléments alloués dans out->array
+  unsigned flags;
+  size_t consumed; // Octets des blocs précédents
+  size_t line;     // Ligne au début du bloc courant
+  char carry[DSA_ARRAY_PARSE_MAX_TOKEN];
+  size_t carry_length; // Début de valeur en attente de la fin du bloc
+  size_t carry_offset;
+  size_t carry_line;
+  DsaArrayParseError error;
+} DsaArrayParser;
+
+// Vide `out` et le prépare pour des valeurs de type `type`
+void dsa_array_parser_init(DsaArrayParser *parser, DsaArrayData *out,
+                           DsaDataType type, unsigned flags);
+// Réserve la place de `count` éléments supplémentaires
+bool dsa_array_parser_reserve(DsaArrayParser *parser, size_t count);
+DsaArrayParseStatus dsa_array_parser_feed(DsaArrayParser *parser,
+                                          const char *chunk, size_t length);
+// Termine la dernière valeur et ajuste la mémoire du tableau à sa taille
+DsaArrayParseStatus dsa_array_parser_finish(DsaArrayParser *parser);
+
+// Lit tout le texte dans `out` ; `error` (facultatif) décrit la valeur
+// refusée
+DsaArrayParseStatus dsa_array_parse_text(const char *text, size_t length,
+                                         DsaDataType type, unsigned flags,
+                                         DsaArrayData *out,
+                                         DsaArrayParseError *error);
+
+#endif
@@ -0,0 +1,254 @@
+#include "array_viewer.h"
+#include "array_format.h"
+#include <stdio.h>
+#include <string.h>
+
+#define VIEWER_FONT "Monospace"
+#define VIEWER_FONT_SIZE 13
+#define VIEWER_PADDING 10
+// Lignes parcourues par cran de molette
+#define VIEWER_SCROLL_LINES 3
+// Éléments mesurés pour choisir la largeur des cellules
+#define VIEWER_SAMPLE 1024
+
+typedef struct {
+  GtkWidget *area;
+  GtkAdjustment *adjustment; // Position en lignes
+
+  // Texte libre ou en-tête, découpé en lignes
+  gchar **lines;
+  size_t line_count;
+
+  DsaArrayData data;   // Emprunté (array == NULL : pas de tableau)
+  size_t cell_chars;   // Largeur d'un élément et de son séparateur
+  size_t gutter_chars; // Largeur de la colonne des indices
+  size_t columns;      // Éléments par ligne, selon la largeur
+
+  double char_width;
+  double line_height;
+  double ascent;
+  int width;
+  int height;
+
+  DsaTextBuffer row; // Ligne en cours de formatage, réutilisée
+} ArrayViewer;
+
+static ArrayViewer *get_viewer(GtkWidget *widget) {
+  return g_object_get_data(G_OBJECT(widget), "array-viewer");
+}
+
+static void free_viewer(gpointer data) {
+  ArrayViewer *viewer = data;
+  g_strfreev(viewer->lines);
+  dsa_text_buffer_free(&viewer->row);
+  g_free(viewer);
+}
+
+static void select_font(cairo_t *cr) {
+  cairo_select_font_face(cr, VIEWER_FONT, CAIRO_FONT_SLANT_NORMAL,
+                         CAIRO_FONT_WEIGHT_NORMAL);
+  cairo_set_font_size(cr, VIEWER_FONT_SIZE);
+}
+
+// Police à chasse fixe : mesurée une fois, hors de toute fonction de dessin
+static void measure_font(ArrayViewer *viewer) {
+  cairo_surface_t *surface = cairo_image_surface_create(CAIRO_FORMAT_A8, 1, 1);
+  cairo_t *cr = cairo_create(surface);
+  select_font(cr);
+
+  cairo_font_extents_t font;
+  cairo_font_extents(cr, &font);
+  cairo_text_extents_t digit;
+  cairo_text_extents(cr, "0", &digit);
+  viewer->char_width = digit.x_advance > 0 ? digit.x_advance : 8;
+  viewer->line_height = font.height > 0 ? font.height : 16;
+  viewer->ascent = font.ascent;
+
+  cairo_destroy(cr);
+  cairo_surface_destroy(surface);
+}
+
+static size_t data_rows(const ArrayViewer *viewer) {
+  if (!viewer->data.array)
+    return 0;
+  return (viewer->data.size + viewer->columns - 1) / viewer->columns;
+}
+
+// En-tête, ligne vide puis lignes du tableau
+static size_t total_lines(const ArrayViewer *viewer) {
+  if (!viewer->data.array)
+    return viewer->line_count;
+  return viewer->line_count + 1 + data_rows(viewer);
+}
+
+// Colonnes et bornes du défilement d'après la taille de la zone. Le premier
+// élément visible reste visible quand le nombre de colonnes change.
+static void update_layout(ArrayViewer *viewer) {
+  size_t first_line = (size_t)gtk_adjustment_get_value(viewer->adjustment);
+  size_t first_element = 0;
+  if (viewer->data.array && first_line > viewer->line_count)
+    first_element = (first_line - viewer->line_count - 1) * viewer->columns;
+
+  double usable = viewer->width - 2 * VIEWER_PADDING;
+  size_t chars = usable > 0 ? (size_t)(usable / viewer->char_width) : 0;
+  size_t room = chars > viewer->gutter_chars ? chars - viewer->gutter_chars : 0;
+  viewer->columns = room / viewer->cell_chars;
+  if (viewer->columns == 0)
+    viewer->columns = 1;
+
+  if (first_element > 0)
+    first_line = viewer->line_count + 1 + first_element / viewer->columns;
+
+  double page = (viewer->height - 2 * VIEWER_PADDING) / viewer->line_height;
+  if (page < 1)
+    page = 1;
+  gtk_adjustment_configure(viewer->adjustment, (double)first_line, 0,
+                           (double)total_lines(viewer), VIEWER_SCROLL_LINES,
+                           page, page);
+  gtk_widget_queue_draw(viewer->area);
+}
+
+// Texte de la ligne `row` du tableau (indice du premier élément, puis les
+// éléments de la ligne), dans le tampon réutilisable viewer->row
+static const char *format_row(ArrayViewer *viewer, size_t row) {
+  size_t begin = row * viewer->columns;
+  size_t end = begin + viewer->columns;
+  if (end > viewer->data.size)
+    end = viewer->data.size;
+
+  char index[32];
+  int written = snprintf(index, sizeof(index), "%*zu | ",
+                         (int)viewer->gutter_chars - 3, begin);
+  dsa_text_buffer_clear(&viewer->row);
+  if (written < 0 ||
+      !dsa_text_buffer_append(&viewer->row, index, (size_t)written) ||
+      !dsa_array_format_append(&viewer->row, &viewer->data, begin, end, 0))
+    return "";
+  if (end < viewer->data.size && !dsa_text_buffer_append(&viewer->row, ",", 1))
+    return "";
+  return viewer->row.text;
+}
+
+static void on_draw(GtkDrawingArea *area, cairo_t *cr, int width, int height,
+                    gpointer data) {
+  ArrayViewer *viewer = data;
+
+  cairo_set_source_rgb(cr, 1.0, 1.0, 1.0);
+  cairo_paint(cr);
+  select_font(cr);
+  cairo_set_source_rgb(cr, 0.17, 0.24, 0.31);
+
+  // Seules les lignes visibles sont formatées
+  size_t line = (size_t)gtk_adjustment_get_value(viewer->adjustment);
+  size_t lines = total_lines(viewer);
+  for (double y = VIEWER_PADDING + viewer->ascent;
+       line < lines && y - viewer->ascent < height;
+       line++, y += viewer->line_height) {
+    const char *text;
+    if (line < viewer->line_count)
+      text = viewer->lines[line];
+    else if (line == viewer->line_count)
+      continue; // Ligne vide entre l'en-tête et le tableau
+    else
+      text = format_row(viewer, line - viewer->line_count - 1);
+    cairo_move_to(cr, VIEWER_PADDING, y);
+    cairo_show_text(cr, text);
+  }
+}
+
+static void on_resize(GtkDrawingArea *area, int width, int height,
+                      gpointer data) {
+  ArrayViewer *viewer = data;
+  viewer->width = width;
+  viewer->height = height;
+  update_layout(viewer);
+}
+
+static void on_scroll_changed(GtkAdjustment *adjustment, gpointer data) {
+  ArrayViewer *viewer = data;
+  gtk_widget_queue_draw(viewer->area);
+}
+
+static gboolean on_scroll(GtkEventControllerScroll *controller, double dx,
+                          double dy, gpointer data) {
+  ArrayViewer *viewer = data;
+  double value = gtk_adjustment_get_value(viewer->adjustment);
+  gtk_adjustment_set_value(viewer->adjustment,
+                           value + dy * VIEWER_SCROLL_LINES);
+  return TRUE;
+}
+
+// Remplace le texte affiché ; `data` (facultatif) est affiché à la suite
+static void set_content(ArrayViewer *viewer, const char *text,
+                        const DsaArrayData *data) {
+  g_strfreev(viewer->lines);
+  viewer->lines = g_strsplit(text ? text : "", "\n", -1);
+  viewer->line_count = g_strv_length(viewer->lines);
+
+  viewer->data = data ? *data : (DsaArrayData){0};
+  viewer->cell_chars = 1;
+  viewer->gutter_chars = 0;
+  if (data && data->array) {
+    // Largeur des cellules : élément le plus long d'un échantillon
+    size_t sample = data->size < VIEWER_SAMPLE ? data->size : VIEWER_SAMPLE;
+    for (size_t i = 0; i < sample; i++) {
+      dsa_text_buffer_clear(&viewer->row);
+      if (dsa_array_format_append(&viewer->row, data, i, i + 1, 0) &&
+          viewer->row.length + 2 > viewer->cell_chars)
+        viewer->cell_chars = viewer->row.length + 2;
+    }
+    char digits[32];
+    viewer->gutter_chars =
+        (size_t)snprintf(digits, sizeof(digits), "%zu", data->size) + 3;
+  }
+
+  gtk_adjustment_set_value(viewer->adjustment, 0);
+  update_layout(viewer);
+}
+
+GtkWidget *array_viewer_new(void) {
+  ArrayViewer *viewer = g_new0(ArrayViewer, 1);
+  measure_font(viewer);
+  viewer->columns = 1;
+  viewer->cell_chars = 1;
+
+  GtkWidget *box = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 0);
+  gtk_widget_add_css_class(box, "array-viewer");
+  g_object_set_data_full(G_OBJECT(box), "array-viewer", viewer, free_viewer);
+
+  viewer->area = gtk_drawing_area_new();
+  gtk_widget_set_hexpand(viewer->area, TRUE);
+  gtk_widget_set_vexpand(viewer->area, TRUE);
+  gtk_drawing_area_set_draw_func(GTK_DRAWING_AREA(viewer->area), on_draw,
+                                 viewer, NULL);
+  g_signal_connect(viewer->area, "resize", G_CALLBACK(on_resize), viewer);
+  gtk_box_append(GTK_BOX(box), viewer->area);
+
+  GtkEventController *scroll =
+      gtk_event_controller_scroll_new(GTK_EVENT_CONTROLLER_SCROLL_VERTICAL);
+  g_signal_connect(scroll, "scroll", G_CALLBACK(on_scroll), viewer);
+  gtk_widget_add_controller(viewer->area, scroll);
+
+  viewer->adjustment = gtk_adjustment_new(0, 0, 0, 1, 1, 1);
+  g_signal_connect(viewer->adjustment, "value-changed",
+                   G_CALLBACK(on_scroll_changed), viewer);
+  GtkWidget *scrollbar =
+      gtk_scrollbar_new(GTK_ORIENTATION_VERTICAL, viewer->adjustment);
+  gtk_box_append(GTK_BOX(box), scrollbar);
+
+  set_content(viewer, NULL, NULL);
+  return box;
+}
+
+void array_viewer_set_data(GtkWidget *widget, const char *header,
+                           const DsaArrayData *data) {
+  set_content(get_viewer(widget), header, data);
+}
+
+void array_viewer_set_text(GtkWidget *widget, const char *text) {
+  set_content(get_viewer(widget), text, NULL);
+}
+
+void array_viewer_clear(GtkWidget *widget) {
+  set_content(get_viewer(widget), NULL, NULL);
+}
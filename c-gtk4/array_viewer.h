@@ -0,0 +1,23 @@
+#ifndef ARRAY_VIEWER_H
+#define ARRAY_VIEWER_H
+
+#include "sort_algorithms.h"
+#include <gtk/gtk.h>
+
+// Affichage virtualisé d'un tableau : seules les lignes visibles sont mises
+// en texte, à chaque défilement ou redimensionnement, quelle que soit la
+// taille du tableau.
+GtkWidget *array_viewer_new(void);
+
+// Affiche `header` puis les éléments de `data`, précédés de leur indice. Le
+// tableau est emprunté : il doit rester valide jusqu'au prochain appel à
+// array_viewer_set_data, array_viewer_set_text ou array_viewer_clear.
+void array_viewer_set_data(GtkWidget *viewer, const char *header,
+                           const DsaArrayData *data);
+
+// Affiche un texte libre (messages, rapport de comparaison)
+void array_viewer_set_text(GtkWidget *viewer, const char *text);
+
+void array_viewer_clear(GtkWidget *viewer);
+
+#endif
@@ -1,30 +1,106 @@
 #include "arrays_window.h"
+#include "array_format.h"
+#include "array_generators.h"
+#include "array_io.h"
+#include "array_parse.h"
+#include "array_viewer.h"
 #include "curve_window.h"
+#include "external_sort.h"
+#include "prng.h"
 #include "sort_algorithms.h"
-#include <ctype.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+// Tri exécuté en arrière-plan (GTask) : une seule méthode, la comparaison
+// de toutes les méthodes ou le tri externe d'un fichier. Le thread de
+// travail ne touche à aucun widget ; le résultat est rendu au thread
+// principal par g_idle_add.
+typedef enum {
+  SORT_JOB_SINGLE,
+  SORT_JOB_COMPARE,
+  SORT_JOB_EXTERNAL
+} SortJobKind;
+
+typedef struct {
+  SortJobKind kind;
+  DsaSortAlgo algo;    // SORT_JOB_SINGLE
+  DsaArrayData source; // SORT_JOB_COMPARE : current_data, emprunté
+  DsaArrayData sorted; // SORT_JOB_SINGLE : tableau trié, dans le pool
+  DsaSortControl control;
+  atomic_int step; // SORT_JOB_COMPARE : méthode en cours
+  DsaTimingSample elapsed;
+  bool cancelled;
+  char report[2048]; // SORT_JOB_COMPARE : résultats
+  // SORT_JOB_EXTERNAL : fichiers, budget mémoire et résultat
+  char *input;
+  char *output;
+  size_t memory_budget;
+  DsaArrayIoStatus status;
+  DsaExternalSortStats stats;
+  guint progress_source;
+  bool orphaned; // Fenêtre fermée avant la fin du tri
+} SortJob;
+
+// Intervalle de rafraîchissement de la barre de progression (ms)
+#define SORT_PROGRESS_INTERVAL 100
+
+static const char *ALGO_SHORT_NAMES[DSA_SORT_ALGO_COUNT] = {
+    "Bulle",    "Insertion", "Shell",     "QuickSort",
+    "Radix",    "Comptage",  "Parallèle", "Fusion"};
+
 typedef struct {
   GtkWidget *dropdown_type;
   GtkWidget *dropdown_mode;
+  GtkWidget *dropdown_dist;
+  GtkWidget *entry_seed;
+  GtkWidget *box_random; // Distribution et graine : mode aléatoire seulement
   GtkWidget *dropdown_algo;
   GtkWidget *spin_size;
+  GtkWidget *spin_threads;
 
   // Champs de saisie manuelle
   GtkWidget *box_manual_input; // Conteneur pour cacher/montrer
   GtkWidget *entry_manual;
 
-  // Zones de texte pour l'affichage
-  GtkWidget *text_view_input;
-  GtkWidget *text_view_output;
+  // Mode fichier : chemin d'un .dsa (binaire) ou d'un CSV
+  GtkWidget *box_file;
+  GtkWidget *entry_file;
+  GtkWidget *spin_memory; // Budget du tri externe (Mio)
+  GtkWidget *btn_external;
+
+  // Affichage virtualisé des tableaux (voir array_viewer.h)
+  GtkWidget *viewer_input;
+  GtkWidget *viewer_output;
 
   GtkWidget *label_time;
+  GtkWidget *progress_bar;
+  GtkWidget *btn_trier;
+  GtkWidget *btn_compare;
+  GtkWidget *btn_cancel;
+  GtkWidget *btn_reset;
   GtkWidget *window; // Reference to main window
 
+  // Tri en cours (NULL si aucun) : les données ne doivent pas changer tant
+  // qu'il s'exécute, les chaînes étant partagées avec current_data
+  SortJob *job;
+
   // Données actuelles
-  ArrayData current_data;
+  DsaArrayData current_data;
+  uint64_t current_seed; // Graine des dernières données aléatoires
+  bool current_has_seed; // current_seed décrit current_data (export)
+  // Fichier binaire projeté en mémoire : current_data.array pointe dedans
+  DsaMappedArray mapped;
+  // Dernier tableau trié, affiché par viewer_output : il occupe le tampon
+  // DSA_SCRATCH_ARRAY du pool (les chaînes appartiennent à current_data)
+  DsaArrayData sorted_data;
+
+  // Tampons réutilisés d'un tri et d'une comparaison à l'autre (copie du
+  // tableau à trier, tampons internes des tris)
+  DsaScratchPool scratch;
 
   // Flag pour savoir si un tri a été effectué
   int has_sorted;
@@ -34,115 +110,131 @@ static ArraysAppWidgets widgets_data = {0};
 
 // --- Helpers ---
 
-// Valide et parse une chaîne séparée par espaces en ArrayData
-// Retourne 1 si valide, 0 si erreur (et remplit error_msg)
-static int parse_manual_input_with_validation(const char *text, DataType type,
-                                              char *error_msg,
+static void show_error_dialog(const char *message) {
+  GtkWidget *dialog = gtk_message_dialog_new(
+      GTK_WINDOW(widgets_data.window), GTK_DIALOG_MODAL, GTK_MESSAGE_ERROR,
+      GTK_BUTTONS_OK, "%s", message);
+  gtk_window_present(GTK_WINDOW(dialog));
+  g_signal_connect_swapped(dialog, "response", G_CALLBACK(gtk_window_destroy),
+                           dialog);
+}
+
+// Libère current_data : projection d'un fichier binaire ou tableau alloué
+static void release_current_data(void) {
+  if (widgets_data.mapped.base) {
+    dsa_array_unmap(&widgets_data.mapped);
+    widgets_data.current_data = (DsaArrayData){0};
+  } else {
+    dsa_free_array_data(&widgets_data.current_data);
+  }
+  widgets_data.current_has_seed = false;
+}
+
+// Vide les affichages et oublie le tableau trié, avant que current_data ou
+// le pool ne soient modifiés (les affichages ne font qu'emprunter les
+// tableaux)
+static void clear_displays(void) {
+  if (widgets_data.viewer_input)
+    array_viewer_clear(widgets_data.viewer_input);
+  if (widgets_data.viewer_output)
+    array_viewer_clear(widgets_data.viewer_output);
+  widgets_data.sorted_data = (DsaArrayData){0};
+}
+
+// Valide et parse la saisie (valeurs séparées par espaces, virgules ou
+// retours à la ligne) directement dans current_data, en une passe
+// (array_parse.h). Retourne 1 si valide, 0 si erreur (et remplit error_msg
+// avec la première valeur refusée et sa position).
+static int parse_manual_input_with_validation(const char *text,
+                                              DsaDataType type, char *error_msg,
                                               size_t error_size) {
-  if (!text || strlen(text) == 0) {
+  if (!text || text[0] == '\0') {
     snprintf(error_msg, error_size, "Aucune valeur saisie.");
     return 0;
   }
 
-  // Compter les tokens
-  char *copy = strdup(text);
-  char *token = strtok(copy, " \n\t");
-  int count = 0;
-  while (token) {
-    count++;
-    token = strtok(NULL, " \n\t");
+  release_current_data();
+  DsaArrayParseError error;
+  DsaArrayParseStatus status =
+      dsa_array_parse_text(text, strlen(text), type, DSA_ARRAY_PARSE_NO_NUMBERS,
+                           &widgets_data.current_data, &error);
+  if (status == DSA_ARRAY_PARSE_MEMORY) {
+    snprintf(error_msg, error_size, "Mémoire insuffisante.");
+    return 0;
   }
-  free(copy);
-
-  if (count == 0) {
+  if (status != DSA_ARRAY_PARSE_OK) {
+    static const char *EXPECTED[DSA_DATA_TYPE_COUNT] = {
+        "n'est pas un entier valide", "n'est pas un nombre réel valide",
+        "n'est pas un caractère unique", "n'est pas une chaîne valide"};
+    const char *reason = EXPECTED[type];
+    if (status == DSA_ARRAY_PARSE_NUMBER)
+      reason = type == DSA_TYPE_CHAR ? "est un nombre, pas un caractère"
+                                     : "est un nombre, pas une chaîne";
+    // Valeur citée sur 40 octets au plus, sans couper un caractère UTF-8
+    const char *value = text + error.offset;
+    int shown = error.length > 40 ? 40 : (int)error.length;
+    while (shown < (int)error.length && shown > 0 &&
+           (value[shown] & 0xC0) == 0x80)
+      shown--;
+    snprintf(error_msg, error_size,
+             "Erreur: '%.*s%s' %s (valeur n° %zu, ligne %zu, position %zu).",
+             shown, value, shown < (int)error.length ? "..." : "",
+             reason, error.index + 1, error.line, error.offset + 1);
+    return 0;
+  }
+  if (widgets_data.current_data.size == 0) {
     snprintf(error_msg, error_size, "Aucune valeur valide trouvée.");
     return 0;
   }
+  return 1;
+}
 
-  // Allouer le tableau
-  if (widgets_data.current_data.array)
-    free(widgets_data.current_data.array);
-
-  widgets_data.current_data.type = type;
-  widgets_data.current_data.size = count;
-  widgets_data.current_data.array = malloc(
-      count * sizeof(double)); // Utiliser double pour tous les types numériques
-
-  // Valider et parser
-  copy = strdup(text);
-  token = strtok(copy, " \n\t");
-  int i = 0;
-
-  while (token && i < count) {
-    char *endptr;
-
-    switch (type) {
-    case TYPE_INT: {
-      long val = strtol(token, &endptr, 10);
-      if (*endptr != '\0') {
-        snprintf(error_msg, error_size,
-                 "Erreur: '%s' n'est pas un entier valide.", token);
-        free(copy);
-        return 0;
-      }
-      ((int *)widgets_data.current_data.array)[i] = (int)val;
-      break;
-    }
-    case TYPE_FLOAT: {
-      double val = strtod(token, &endptr);
-      if (*endptr != '\0') {
-        snprintf(error_msg, error_size,
-                 "Erreur: '%s' n'est pas un nombre réel valide.", token);
-        free(copy);
-        return 0;
-      }
-      ((double *)widgets_data.current_data.array)[i] = val;
-      break;
-    }
-    case TYPE_CHAR: {
-      if (strlen(token) != 1) {
-        snprintf(error_msg, error_size,
-                 "Erreur: '%s' n'est pas un caractère unique.", token);
-        free(copy);
-        return 0;
-      }
-      if (isdigit(token[0])) {
-        snprintf(error_msg, error_size,
-                 "Erreur: '%s' est un nombre, pas un caractère.", token);
-        free(copy);
-        return 0;
-      }
-      ((char *)widgets_data.current_data.array)[i] = token[0];
-      break;
-    }
-    case TYPE_STRING: {
-      // Vérifier si c'est un nombre
-      double val = strtod(token, &endptr);
-      (void)val; // Supprimer warning unused
-      if (*endptr == '\0') {
-        snprintf(error_msg, error_size,
-                 "Erreur: '%s' est un nombre, pas une chaîne.", token);
-        free(copy);
-        return 0;
-      }
-      // Pour les strings, on stocke des pointeurs (simplifié ici)
-      ((char **)widgets_data.current_data.array)[i] = strdup(token);
-      break;
-    }
+// Charge le fichier choisi : un .dsa est projeté en mémoire tel quel (son
+// type remplace celui du menu), tout autre fichier est lu comme un CSV du
+// type choisi
+static int load_file_data(DsaDataType type) {
+  const char *path =
+      gtk_editable_get_text(GTK_EDITABLE(widgets_data.entry_file));
+  if (path[0] == '\0') {
+    show_error_dialog("Aucun fichier choisi.");
+    return 0;
+  }
+
+  release_current_data();
+  DsaArrayIoStatus status;
+  size_t line = 0;
+  if (dsa_array_file_is_binary(path)) {
+    status = dsa_array_map_file(path, 0, &widgets_data.mapped);
+    if (status == DSA_ARRAY_IO_OK) {
+      widgets_data.current_data = widgets_data.mapped.data;
+      widgets_data.current_has_seed = widgets_data.mapped.info.has_seed;
+      widgets_data.current_seed = widgets_data.mapped.info.seed;
+      gtk_drop_down_set_selected(GTK_DROP_DOWN(widgets_data.dropdown_type),
+                                 (guint)widgets_data.current_data.type);
     }
-    i++;
-    token = strtok(NULL, " \n\t");
+  } else {
+    status =
+        dsa_array_import_csv(path, type, &widgets_data.current_data, &line);
   }
 
-  widgets_data.current_data.size = i;
-  free(copy);
+  if (status != DSA_ARRAY_IO_OK) {
+    char message[512];
+    if (status == DSA_ARRAY_IO_ERR_PARSE)
+      snprintf(message, sizeof(message), "%s : %s (ligne %zu).", path,
+               dsa_array_io_status_message(status), line);
+    else
+      snprintf(message, sizeof(message), "%s : %s.", path,
+               dsa_array_io_status_message(status));
+    show_error_dialog(message);
+    return 0;
+  }
   return 1;
 }
 
 // Ancienne fonction pour compatibilité
 static void parse_manual_input(const char *text) {
   char error_msg[256];
-  parse_manual_input_with_validation(text, TYPE_INT, error_msg,
+  parse_manual_input_with_validation(text, DSA_TYPE_INT, error_msg,
                                      sizeof(error_msg));
 }
 
@@ -151,39 +243,57 @@ static int prepare_data() {
       gtk_spin_button_get_value_as_int(GTK_SPIN_BUTTON(widgets_data.spin_size));
   int type_idx =
       gtk_drop_down_get_selected(GTK_DROP_DOWN(widgets_data.dropdown_type));
-  int mode_idx = gtk_drop_down_get_selected(
-      GTK_DROP_DOWN(widgets_data.dropdown_mode)); // 0=Aleatoire, 1=Manuel
+  int mode_idx = gtk_drop_down_get_selected(GTK_DROP_DOWN(
+      widgets_data.dropdown_mode)); // 0=Aleatoire, 1=Manuel, 2=Fichier
 
-  // Récupérer la string du mode pour être sûr (ou utiliser l'index 0/1)
-  // Ici on utilise l'index : 0 = Aléatoire, 1 = Manuel
+  // Récupérer la string du mode pour être sûr (ou utiliser l'index)
+  // Ici on utilise l'index : 0 = Aléatoire, 1 = Manuel, 2 = Fichier
 
   if (mode_idx == 0) { // Aléatoire
-    generate_random_data(&widgets_data.current_data, size, (DataType)type_idx);
+    // Graine saisie pour rejouer un tirage, sinon nouvelle graine
+    const char *seed_text =
+        gtk_editable_get_text(GTK_EDITABLE(widgets_data.entry_seed));
+    uint64_t seed = dsa_prng_fresh_seed();
+    if (seed_text[0] != '\0') {
+      char *end;
+      seed = g_ascii_strtoull(seed_text, &end, 10);
+      if (*end != '\0') {
+        GtkWidget *dialog = gtk_message_dialog_new(
+            GTK_WINDOW(widgets_data.window), GTK_DIALOG_MODAL,
+            GTK_MESSAGE_ERROR, GTK_BUTTONS_OK,
+            "Graine invalide : entier positif attendu.");
+        gtk_window_present(GTK_WINDOW(dialog));
+        g_signal_connect_swapped(dialog, "response",
+                                 G_CALLBACK(gtk_window_destroy), dialog);
+        return 0;
+      }
+    }
+    clear_displays();
+    release_current_data();
+    widgets_data.current_seed = seed;
+    widgets_data.current_has_seed = true;
+
+    DsaArrayGenOptions options = dsa_array_gen_options(
+        (DsaArrayDistribution)gtk_drop_down_get_selected(
+            GTK_DROP_DOWN(widgets_data.dropdown_dist)),
+        seed);
+    dsa_generate_array(&widgets_data.current_data, size, (DsaDataType)type_idx,
+                       &options);
+  } else if (mode_idx == 2) { // Fichier
+    clear_displays();
+    if (!load_file_data((DsaDataType)type_idx))
+      return 0;
   } else { // Manuel
     GtkEntryBuffer *buf =
         gtk_entry_get_buffer(GTK_ENTRY(widgets_data.entry_manual));
     const char *text = gtk_entry_buffer_get_text(buf);
+    clear_displays();
 
     char error_msg[256] = "";
-    if (!parse_manual_input_with_validation(text, (DataType)type_idx, error_msg,
-                                            sizeof(error_msg))) {
-      // Clear displays on error
-      GtkTextBuffer *empty_buf = gtk_text_buffer_new(NULL);
-      gtk_text_view_set_buffer(GTK_TEXT_VIEW(widgets_data.text_view_input),
-                               empty_buf);
-      g_object_unref(empty_buf);
-
-      empty_buf = gtk_text_buffer_new(NULL);
-      gtk_text_view_set_buffer(GTK_TEXT_VIEW(widgets_data.text_view_output),
-                               empty_buf);
-      g_object_unref(empty_buf);
-
-      // Clear internal data
-      if (widgets_data.current_data.array) {
-        free(widgets_data.current_data.array);
-        widgets_data.current_data.array = NULL;
-      }
-      widgets_data.current_data.size = 0;
+    if (!parse_manual_input_with_validation(text, (DsaDataType)type_idx,
+                                            error_msg, sizeof(error_msg))) {
+      // Clear internal data (displays already cleared)
+      release_current_data();
       widgets_data.has_sorted = 0;
       gtk_label_set_text(GTK_LABEL(widgets_data.label_time), "Temps: -");
 
@@ -198,23 +308,44 @@ static int prepare_data() {
     }
   }
 
-  // Afficher input
-  char *str = array_to_string(&widgets_data.current_data);
-  char *full_text = g_strdup_printf("Tableau avant tri :\n\n%s", str);
-  GtkTextBuffer *buffer =
-      gtk_text_view_get_buffer(GTK_TEXT_VIEW(widgets_data.text_view_input));
-  gtk_text_buffer_set_text(buffer, full_text, -1);
-  g_free(full_text);
-  free(str);
+  // Afficher input (seules les lignes visibles sont mises en texte)
+  char *header;
+  if (mode_idx == 2) {
+    char *name = g_path_get_basename(
+        gtk_editable_get_text(GTK_EDITABLE(widgets_data.entry_file)));
+    header = g_strdup_printf("Tableau avant tri (%s, %zu éléments) :", name,
+                             widgets_data.current_data.size);
+    g_free(name);
+  } else if (mode_idx == 0) {
+    header = g_strdup_printf("Tableau avant tri (graine %llu) :",
+                             (unsigned long long)widgets_data.current_seed);
+  } else {
+    header = g_strdup("Tableau avant tri :");
+  }
+  array_viewer_set_data(widgets_data.viewer_input, header,
+                        &widgets_data.current_data);
+  g_free(header);
   return 1;
 }
 
+// Transmet le nombre de threads choisi au tri parallèle
+static void apply_thread_count(void) {
+  dsa_sort_set_thread_count(gtk_spin_button_get_value_as_int(
+      GTK_SPIN_BUTTON(widgets_data.spin_threads)));
+}
+
 // Handler pour changement de mode (montrer/cacher champ manuel)
 static void on_mode_changed(GtkDropDown *dropdown, GParamSpec *pspec,
                             gpointer data) {
   int selected = gtk_drop_down_get_selected(dropdown);
-  if (selected == 1) { // Manuel
+  gtk_widget_set_visible(widgets_data.box_file, selected == 2);
+  if (selected == 2) { // Fichier : la taille est celle du fichier
+    gtk_widget_set_visible(widgets_data.box_manual_input, FALSE);
+    gtk_widget_set_visible(widgets_data.box_random, FALSE);
+    gtk_widget_set_visible(widgets_data.spin_size, FALSE);
+  } else if (selected == 1) { // Manuel
     gtk_widget_set_visible(widgets_data.box_manual_input, TRUE);
+    gtk_widget_set_visible(widgets_data.box_random, FALSE);
     gtk_widget_set_visible(
         widgets_data.spin_size,
         FALSE); // Cacher taille car déterminé par input ? Ou garder ?
@@ -223,132 +354,283 @@ static void on_mode_changed(GtkDropDown *dropdown, GParamSpec *pspec,
     // une partie taille". On laisse les deux visibles.
   } else {
     gtk_widget_set_visible(widgets_data.box_manual_input, FALSE);
+    gtk_widget_set_visible(widgets_data.box_random, TRUE);
     gtk_widget_set_visible(widgets_data.spin_size, TRUE);
   }
 }
 
 // --- Callbacks Boutons ---
 
-static void on_trier_clicked(GtkWidget *btn, gpointer data) {
-  if (!prepare_data())
-    return; // Stop si erreur
+// --- Tri en arrière-plan ---
 
-  if (widgets_data.current_data.array == NULL)
-    return;
+static void set_sort_running(bool running) {
+  gtk_widget_set_sensitive(widgets_data.btn_trier, !running);
+  gtk_widget_set_sensitive(widgets_data.btn_compare, !running);
+  gtk_widget_set_sensitive(widgets_data.btn_reset, !running);
+  gtk_widget_set_sensitive(widgets_data.btn_external, !running);
+  gtk_widget_set_sensitive(widgets_data.btn_cancel, running);
+  gtk_widget_set_visible(widgets_data.progress_bar, running);
+}
 
-  int algo_idx =
-      gtk_drop_down_get_selected(GTK_DROP_DOWN(widgets_data.dropdown_algo));
+// Copie pour tri dans le tampon DSA_SCRATCH_ARRAY du pool, réutilisé d'un tri
+// à l'autre (pour les chaînes, seuls les pointeurs sont copiés : les
+// chaînes restent possédées par current_data)
+static bool copy_array_to_scratch(const DsaArrayData *src, DsaArrayData *dst) {
+  size_t bytes = src->size * dsa_array_element_size(src->type);
+  dst->size = src->size;
+  dst->type = src->type;
+  dst->payload = NULL;
+  dst->payload_size = 0;
+  dst->array =
+      dsa_scratch_pool_get(&widgets_data.scratch, DSA_SCRATCH_ARRAY, bytes);
+  if (!dst->array)
+    return false;
+  memcpy(dst->array, src->array, bytes);
+  return true;
+}
 
-  // Avertissement pour les tris lents sur grands tableaux
-  if (widgets_data.current_data.size > 20000 &&
-      (algo_idx == 0 || algo_idx == 1)) {
-    GtkWidget *dialog = gtk_message_dialog_new(
-        GTK_WINDOW(widgets_data.window), GTK_DIALOG_MODAL, GTK_MESSAGE_ERROR,
-        GTK_BUTTONS_OK,
-        "Erreur: Ce tri (O(N²)) est trop lent pour %zu éléments.\n"
-        "Veuillez choisir 'Tri Shell' ou 'QuickSort' pour éviter de geler "
-        "l'interface.",
-        widgets_data.current_data.size);
+// Le tableau trié et la source sont empruntés (pool, current_data)
+static void free_sort_job(SortJob *job) {
+  g_free(job->input);
+  g_free(job->output);
+  g_free(job);
+}
 
-    gtk_widget_show(dialog);
-    g_signal_connect_swapped(dialog, "response", G_CALLBACK(gtk_window_destroy),
-                             dialog);
-    return; // On arrête tout
+static void append_report(SortJob *job, const char *format, ...)
+    G_GNUC_PRINTF(2, 3);
+
+static void append_report(SortJob *job, const char *format, ...) {
+  size_t len = strlen(job->report);
+  va_list args;
+  va_start(args, format);
+  vsnprintf(job->report + len, sizeof(job->report) - len, format, args);
+  va_end(args);
+}
+
+// Thread de travail : comparaison de toutes les méthodes sur la même copie
+static void run_comparison(SortJob *job) {
+  snprintf(job->report, sizeof(job->report), "Comparaison des Méthodes :\n\n");
+
+  for (int i = 0; i < DSA_SORT_ALGO_COUNT; i++) {
+    atomic_store(&job->step, i);
+
+    DsaArrayData temp;
+    if (!copy_array_to_scratch(&job->source, &temp)) {
+      append_report(job, "%s : mémoire insuffisante\n", ALGO_SHORT_NAMES[i]);
+      continue;
+    }
+
+    DsaTimingSample elapsed;
+    bool done = dsa_sort_array_controlled(&temp, (DsaSortAlgo)i, &job->control,
+                                          &elapsed);
+
+    if (!done) {
+      append_report(job, "%s : annulé\n", ALGO_SHORT_NAMES[i]);
+      job->cancelled = true;
+      break;
+    }
+    append_report(job, "%s : %.3f ms\n", ALGO_SHORT_NAMES[i],
+                  dsa_timing_ns_to_ms(elapsed.ns));
+  }
+}
+
+// Thread de travail : tri externe du fichier, sans le charger en mémoire
+static void run_external_sort(SortJob *job) {
+  DsaExternalSortOptions options;
+  dsa_external_sort_default_options(&options);
+  options.memory_budget = job->memory_budget;
+  options.control = &job->control;
+  // Fichiers temporaires à côté du résultat plutôt que dans /tmp, souvent
+  // en mémoire
+  char *dir = g_path_get_dirname(job->output);
+  options.temp_dir = dir;
+
+  uint64_t start = dsa_timing_now_ns();
+  job->status = dsa_external_sort_file(job->input, job->output, &options,
+                                       &job->stats);
+  job->elapsed.ns = dsa_timing_now_ns() - start;
+  job->cancelled = job->status == DSA_ARRAY_IO_ERR_CANCELLED;
+  g_free(dir);
+}
+
+// Résumé du tri externe ; le fichier trié devient le fichier choisi
+static void show_external_result(SortJob *job) {
+  if (job->status != DSA_ARRAY_IO_OK) {
+    char message[512];
+    snprintf(message, sizeof(message), "Tri externe : %s.",
+             dsa_array_io_status_message(job->status));
+    gtk_label_set_text(GTK_LABEL(widgets_data.label_time), message);
+    return;
   }
 
-  // Copie pour tri
-  ArrayData data_to_sort;
-  data_to_sort.size = widgets_data.current_data.size;
-  data_to_sort.type = widgets_data.current_data.type;
-  data_to_sort.array =
-      malloc(data_to_sort.size * sizeof(int)); // TODO: Fix type generic
-
-  // Correction pour malloc selon type
-  size_t elem_size = sizeof(int);
-  if (data_to_sort.type == TYPE_FLOAT)
-    elem_size = sizeof(float);
-  else if (data_to_sort.type == TYPE_CHAR)
-    elem_size = sizeof(char);
-
-  free(data_to_sort.array); // Free le malloc int par defaut
-  data_to_sort.array = malloc(data_to_sort.size * elem_size);
-
-  memcpy(data_to_sort.array, widgets_data.current_data.array,
-         data_to_sort.size * elem_size);
-
-  double time_taken = sort_array(&data_to_sort, (SortAlgo)algo_idx);
-
-  // Affichage
-  char *str = array_to_string(&data_to_sort);
-  char *full_text = g_strdup_printf("Tableau après tri :\n\n%s", str);
-  GtkTextBuffer *buffer =
-      gtk_text_view_get_buffer(GTK_TEXT_VIEW(widgets_data.text_view_output));
-  gtk_text_buffer_set_text(buffer, full_text, -1);
-  g_free(full_text);
-  free(str);
+  char *report = g_strdup_printf(
+      "Tri externe de %s\nvers %s\n\n"
+      "%llu éléments, %zu tranches triées en mémoire\n"
+      "%zu passages de fusion (%zu tranches à la fois)\n"
+      "%.1f Mio lus, %.1f Mio écrits",
+      job->input, job->output, (unsigned long long)job->stats.elements,
+      job->stats.runs, job->stats.merge_passes, job->stats.fan_in,
+      job->stats.bytes_read / 1048576.0, job->stats.bytes_written / 1048576.0);
+  array_viewer_set_text(widgets_data.viewer_output, report);
+  g_free(report);
 
   char time_str[64];
-  snprintf(time_str, 64, "Temps: %.3f ms", time_taken * 1000.0);
+  snprintf(time_str, sizeof(time_str), "Tri externe : %.3f s",
+           dsa_timing_ns_to_s(job->elapsed.ns));
   gtk_label_set_text(GTK_LABEL(widgets_data.label_time), time_str);
+  gtk_editable_set_text(GTK_EDITABLE(widgets_data.entry_file), job->output);
+}
+
+// Résultat rendu au thread principal (g_idle_add)
+static gboolean on_sort_finished(gpointer user_data) {
+  SortJob *job = user_data;
+
+  if (job->progress_source)
+    g_source_remove(job->progress_source);
+  widgets_data.job = NULL;
+  if (widgets_data.window)
+    set_sort_running(false);
+
+  if (job->orphaned) {
+    free_sort_job(job);
+    if (!widgets_data.window)
+      dsa_scratch_pool_release(&widgets_data.scratch);
+    return G_SOURCE_REMOVE;
+  }
 
-  // Marquer qu'un tri a été effectué
-  widgets_data.has_sorted = 1;
+  if (job->kind == SORT_JOB_SINGLE) {
+    if (job->cancelled) {
+      array_viewer_set_text(widgets_data.viewer_output, "Tri annulé.");
+      gtk_label_set_text(GTK_LABEL(widgets_data.label_time), "Tri annulé.");
+    } else {
+      // Affichage sans copie : la vue lit le tableau trié dans le pool
+      widgets_data.sorted_data = job->sorted;
+      array_viewer_set_data(widgets_data.viewer_output, "Tableau après tri :",
+                            &widgets_data.sorted_data);
+
+      char time_str[64];
+      snprintf(time_str, 64, "Temps: %.3f ms",
+               dsa_timing_ns_to_ms(job->elapsed.ns));
+      gtk_label_set_text(GTK_LABEL(widgets_data.label_time), time_str);
+
+      // Marquer qu'un tri a été effectué
+      widgets_data.has_sorted = 1;
+    }
+  } else if (job->kind == SORT_JOB_COMPARE) {
+    // Afficher dans Output View
+    array_viewer_set_text(widgets_data.viewer_output, job->report);
+    gtk_label_set_text(GTK_LABEL(widgets_data.label_time),
+                       job->cancelled ? "Comparaison annulée."
+                                      : "Comparaison terminée.");
+    if (!job->cancelled)
+      widgets_data.has_sorted = 1;
+  } else {
+    show_external_result(job);
+  }
 
-  free_array_data(&data_to_sort);
+  free_sort_job(job);
+  return G_SOURCE_REMOVE;
 }
 
-static void on_compare_clicked(GtkWidget *btn, gpointer data) {
+static void sort_job_thread(GTask *task, gpointer source_object,
+                            gpointer task_data, GCancellable *cancellable) {
+  SortJob *job = task_data;
+
+  if (job->kind == SORT_JOB_SINGLE)
+    job->cancelled = !dsa_sort_array_controlled(&job->sorted, job->algo,
+                                                &job->control, &job->elapsed);
+  else if (job->kind == SORT_JOB_COMPARE)
+    run_comparison(job);
+  else
+    run_external_sort(job);
+
+  g_idle_add(on_sort_finished, job);
+  g_task_return_boolean(task, !job->cancelled);
+}
+
+static gboolean on_sort_progress(gpointer user_data) {
+  SortJob *job = user_data;
+  double fraction = dsa_sort_control_progress(&job->control);
+  if (job->kind == SORT_JOB_COMPARE)
+    fraction = (atomic_load(&job->step) + fraction) / DSA_SORT_ALGO_COUNT;
+  gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(widgets_data.progress_bar),
+                                fraction);
+  return G_SOURCE_CONTINUE;
+}
+
+static void start_sort_job(SortJob *job) {
+  dsa_sort_control_init(&job->control);
+  job->control.scratch = &widgets_data.scratch;
+  atomic_init(&job->step, 0);
+  widgets_data.job = job;
+
+  set_sort_running(true);
+  gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(widgets_data.progress_bar),
+                                0.0);
+  gtk_label_set_text(GTK_LABEL(widgets_data.label_time), "Tri en cours...");
+  job->progress_source =
+      g_timeout_add(SORT_PROGRESS_INTERVAL, on_sort_progress, job);
+
+  GTask *task = g_task_new(NULL, NULL, NULL, NULL);
+  g_task_set_task_data(task, job, NULL); // Libéré par on_sort_finished
+  g_task_run_in_thread(task, sort_job_thread);
+  g_object_unref(task);
+}
+
+// --- Callbacks Boutons ---
+
+static void on_trier_clicked(GtkWidget *btn, gpointer data) {
+  if (widgets_data.job)
+    return; // Un tri est déjà en cours
+
   if (!prepare_data())
     return; // Stop si erreur
 
   if (widgets_data.current_data.array == NULL)
     return;
 
-  char result_buffer[2048] = "Comparaison des Méthodes :\n\n";
-  const char *algo_names[] = {"Bulle", "Insertion", "Shell", "QuickSort"};
-
-  for (int i = 0; i < 4; i++) {
-    // Skip slow sorts for large data
-    if (widgets_data.current_data.size > 20000 && (i == 0 || i == 1)) {
-      char line[128];
-      snprintf(line, 128, "%s : Skippé (>20k éléments)\n", algo_names[i]);
-      strcat(result_buffer, line);
-      continue;
-    }
-
-    // Copie fraiche
-    ArrayData temp;
-    temp.type = widgets_data.current_data.type;
-    temp.size = widgets_data.current_data.size;
+  int algo_idx =
+      gtk_drop_down_get_selected(GTK_DROP_DOWN(widgets_data.dropdown_algo));
+  apply_thread_count();
 
-    size_t elem_size = sizeof(int);
-    if (temp.type == TYPE_FLOAT)
-      elem_size = sizeof(float);
-    else if (temp.type == TYPE_CHAR)
-      elem_size = sizeof(char);
+  SortJob *job = g_new0(SortJob, 1);
+  job->kind = SORT_JOB_SINGLE;
+  job->algo = (DsaSortAlgo)algo_idx;
+  if (!copy_array_to_scratch(&widgets_data.current_data, &job->sorted)) {
+    free_sort_job(job);
+    return;
+  }
+  start_sort_job(job);
+}
 
-    temp.array = malloc(temp.size * elem_size);
-    memcpy(temp.array, widgets_data.current_data.array, temp.size * elem_size);
+static void on_compare_clicked(GtkWidget *btn, gpointer data) {
+  if (widgets_data.job)
+    return; // Un tri est déjà en cours
 
-    double t = sort_array(&temp, (SortAlgo)i);
+  if (!prepare_data())
+    return; // Stop si erreur
 
-    char line[128];
-    snprintf(line, 128, "%s : %.3f ms\n", algo_names[i], t * 1000.0);
-    strcat(result_buffer, line);
+  if (widgets_data.current_data.array == NULL)
+    return;
 
-    free_array_data(&temp);
-  }
+  apply_thread_count();
 
-  // Afficher dans Output View
-  GtkTextBuffer *buffer =
-      gtk_text_view_get_buffer(GTK_TEXT_VIEW(widgets_data.text_view_output));
-  gtk_text_buffer_set_text(buffer, result_buffer, -1);
+  SortJob *job = g_new0(SortJob, 1);
+  job->kind = SORT_JOB_COMPARE;
+  // Les données ne changent pas pendant le tri : pas de copie de la source
+  job->source = widgets_data.current_data;
+  start_sort_job(job);
+}
 
-  gtk_label_set_text(GTK_LABEL(widgets_data.label_time),
-                     "Comparaison terminée.");
+static void on_cancel_clicked(GtkWidget *btn, gpointer data) {
+  if (!widgets_data.job)
+    return;
+  dsa_sort_control_cancel(&widgets_data.job->control);
+  gtk_label_set_text(GTK_LABEL(widgets_data.label_time), "Annulation...");
+}
 
-  // Marquer qu'un tri a été effectué
-  widgets_data.has_sorted = 1;
+static bool write_to_file(const char *text, size_t length, void *context) {
+  return fwrite(text, 1, length, context) == length;
 }
 
 static void save_results_to_file(const char *filename) {
@@ -361,10 +643,13 @@ static void save_results_to_file(const char *filename) {
   fprintf(f, "Rapport de Tri\n");
   fprintf(f, "--------------\n");
 
-  // Input
-  char *in_str = array_to_string(&widgets_data.current_data);
-  fprintf(f, "Donnees Originales: %s\n", in_str);
-  free(in_str);
+  // Input, écrit par tranches (pas de copie texte du tableau entier)
+  fprintf(f, "Donnees Originales: ");
+  dsa_array_format_stream(
+      &widgets_data.current_data,
+      dsa_array_format_line_length(widgets_data.current_data.type),
+      write_to_file, f);
+  fprintf(f, "\n");
 
   fprintf(f, "\n(Voir l'interface pour les résultats détaillés lors de la "
              "comparaison)\n");
@@ -415,24 +700,162 @@ static void on_save_clicked(GtkWidget *btn, gpointer data) {
   gtk_native_dialog_show(GTK_NATIVE_DIALOG(native));
 }
 
-static void on_reset_clicked(GtkWidget *btn, gpointer data) {
-  // 1. Vider les données
-  if (widgets_data.current_data.array) {
-    free(widgets_data.current_data.array);
-    widgets_data.current_data.array = NULL;
-    widgets_data.current_data.size = 0;
+// Export des données initiales : binaire si le nom finit par .dsa (avec la
+// graine des données générées), CSV sinon
+static void export_data_to_file(const char *filename) {
+  const DsaArrayData *data = &widgets_data.current_data;
+  if (!data->array) {
+    gtk_label_set_text(GTK_LABEL(widgets_data.label_time),
+                       "Aucune donnée à exporter.");
+    return;
   }
 
-  // 2. Vider les affichages
-  GtkTextBuffer *empty_buf = gtk_text_buffer_new(NULL);
-  gtk_text_view_set_buffer(GTK_TEXT_VIEW(widgets_data.text_view_input),
-                           empty_buf);
-  g_object_unref(empty_buf);
+  DsaArrayIoStatus status =
+      dsa_array_file_is_binary(filename)
+          ? dsa_array_save_binary(filename, data,
+                                  widgets_data.current_has_seed
+                                      ? &widgets_data.current_seed
+                                      : NULL)
+          : dsa_array_export_csv(filename, data);
+  if (status != DSA_ARRAY_IO_OK) {
+    char message[512];
+    snprintf(message, sizeof(message), "%s : %s.", filename,
+             dsa_array_io_status_message(status));
+    show_error_dialog(message);
+    return;
+  }
 
-  empty_buf = gtk_text_buffer_new(NULL);
-  gtk_text_view_set_buffer(GTK_TEXT_VIEW(widgets_data.text_view_output),
-                           empty_buf);
-  g_object_unref(empty_buf);
+  char msg[256];
+  snprintf(msg, sizeof(msg), "Exporté dans %s", filename);
+  gtk_label_set_text(GTK_LABEL(widgets_data.label_time), msg);
+}
+
+// Chemin choisi dans un sélecteur de fichier (à libérer par g_free)
+static char *chooser_path(GtkNativeDialog *dialog) {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  GFile *file = gtk_file_chooser_get_file(GTK_FILE_CHOOSER(dialog));
+#pragma GCC diagnostic pop
+  char *path = g_file_get_path(file);
+  g_object_unref(file);
+  return path;
+}
+
+static void on_export_response(GtkNativeDialog *dialog, int response,
+                               gpointer user_data) {
+  if (response == GTK_RESPONSE_ACCEPT) {
+    char *filename = chooser_path(dialog);
+    export_data_to_file(filename);
+    g_free(filename);
+  }
+  g_object_unref(dialog);
+}
+
+static void on_export_clicked(GtkWidget *btn, gpointer data) {
+  GtkWindow *parent = GTK_WINDOW(gtk_widget_get_native(btn));
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  GtkFileChooserNative *native = gtk_file_chooser_native_new(
+      "Exporter les données", parent, GTK_FILE_CHOOSER_ACTION_SAVE,
+      "_Exporter", "_Annuler");
+  gtk_file_chooser_set_current_name(GTK_FILE_CHOOSER(native),
+                                    "donnees" DSA_ARRAY_FILE_EXTENSION);
+#pragma GCC diagnostic pop
+
+  g_signal_connect(native, "response", G_CALLBACK(on_export_response), NULL);
+  gtk_native_dialog_show(GTK_NATIVE_DIALOG(native));
+}
+
+static void on_browse_response(GtkNativeDialog *dialog, int response,
+                               gpointer user_data) {
+  if (response == GTK_RESPONSE_ACCEPT) {
+    char *filename = chooser_path(dialog);
+    gtk_editable_set_text(GTK_EDITABLE(widgets_data.entry_file), filename);
+    g_free(filename);
+  }
+  g_object_unref(dialog);
+}
+
+static void on_browse_clicked(GtkWidget *btn, gpointer data) {
+  GtkWindow *parent = GTK_WINDOW(gtk_widget_get_native(btn));
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  GtkFileChooserNative *native = gtk_file_chooser_native_new(
+      "Ouvrir un tableau", parent, GTK_FILE_CHOOSER_ACTION_OPEN, "_Ouvrir",
+      "_Annuler");
+#pragma GCC diagnostic pop
+
+  g_signal_connect(native, "response", G_CALLBACK(on_browse_response), NULL);
+  gtk_native_dialog_show(GTK_NATIVE_DIALOG(native));
+}
+
+// Tri externe du fichier choisi vers `output`
+static void start_external_sort(const char *output) {
+  if (widgets_data.job)
+    return; // Un tri est déjà en cours
+
+  const char *input =
+      gtk_editable_get_text(GTK_EDITABLE(widgets_data.entry_file));
+  if (!dsa_array_file_is_binary(input)) {
+    show_error_dialog("Le tri externe s'applique à un fichier "
+                      DSA_ARRAY_FILE_EXTENSION " (exporter d'abord les données "
+                      "dans ce format).");
+    return;
+  }
+
+  // La sortie peut remplacer le fichier affiché : il n'est plus emprunté
+  clear_displays();
+  release_current_data();
+  widgets_data.has_sorted = 0;
+
+  SortJob *job = g_new0(SortJob, 1);
+  job->kind = SORT_JOB_EXTERNAL;
+  job->input = g_strdup(input);
+  job->output = g_strdup(output);
+  job->memory_budget = (size_t)gtk_spin_button_get_value_as_int(
+                           GTK_SPIN_BUTTON(widgets_data.spin_memory))
+                       << 20;
+  start_sort_job(job);
+}
+
+static void on_external_response(GtkNativeDialog *dialog, int response,
+                                 gpointer user_data) {
+  if (response == GTK_RESPONSE_ACCEPT) {
+    char *filename = chooser_path(dialog);
+    start_external_sort(filename);
+    g_free(filename);
+  }
+  g_object_unref(dialog);
+}
+
+static void on_external_clicked(GtkWidget *btn, gpointer data) {
+  GtkWindow *parent = GTK_WINDOW(gtk_widget_get_native(btn));
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  GtkFileChooserNative *native = gtk_file_chooser_native_new(
+      "Enregistrer le tableau trié", parent, GTK_FILE_CHOOSER_ACTION_SAVE,
+      "_Trier", "_Annuler");
+  gtk_file_chooser_set_current_name(GTK_FILE_CHOOSER(native),
+                                    "trie" DSA_ARRAY_FILE_EXTENSION);
+#pragma GCC diagnostic pop
+
+  g_signal_connect(native, "response", G_CALLBACK(on_external_response),
+                   NULL);
+  gtk_native_dialog_show(GTK_NATIVE_DIALOG(native));
+}
+
+static void on_reset_clicked(GtkWidget *btn, gpointer data) {
+  if (widgets_data.job)
+    return; // Données en cours de tri
+
+  // 1. Vider les affichages (avant les données qu'ils empruntent)
+  clear_displays();
+
+  // 2. Vider les données
+  release_current_data();
 
   // 3. Reset labels et flags
   gtk_label_set_text(GTK_LABEL(widgets_data.label_time), "Temps: -");
@@ -473,7 +896,32 @@ static void on_curve_clicked(GtkWidget *btn, gpointer data) {
   if (size < 10)
     size = 10;
 
-  open_curve_window(GTK_WINDOW(gtk_widget_get_native(btn)), size);
+  DsaArrayDistribution distribution =
+      (DsaArrayDistribution)gtk_drop_down_get_selected(
+          GTK_DROP_DOWN(widgets_data.dropdown_dist));
+  open_curve_window(GTK_WINDOW(gtk_widget_get_native(btn)), size,
+                    distribution, widgets_data.current_seed);
+}
+
+// Fermeture de la fenêtre : un tri en cours est annulé et son résultat
+// sera ignoré
+static void on_window_destroy(GtkWidget *window, gpointer data) {
+  SortJob *job = widgets_data.job;
+  if (job) {
+    dsa_sort_control_cancel(&job->control);
+    job->orphaned = true;
+    if (job->progress_source) {
+      g_source_remove(job->progress_source);
+      job->progress_source = 0;
+    }
+  }
+  widgets_data.window = NULL;
+  widgets_data.viewer_input = NULL;
+  widgets_data.viewer_output = NULL;
+  widgets_data.sorted_data = (DsaArrayData){0};
+  // Un tri orphelin utilise encore le pool : il le libérera en se terminant
+  if (!job)
+    dsa_scratch_pool_release(&widgets_data.scratch);
 }
 
 // helper widget
@@ -510,6 +958,7 @@ void open_arrays_window(GtkWindow *parent) {
 
   // Stocker la référence à la fenêtre
   widgets_data.window = window;
+  g_signal_connect(window, "destroy", G_CALLBACK(on_window_destroy), NULL);
 
   // Main container (Horizontal Box)
   box_main = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 0);
@@ -541,7 +990,7 @@ void open_arrays_window(GtkWindow *parent) {
       create_labeled_widget("Type de tableau :", widgets_data.dropdown_type));
 
   // 2. Mode
-  const char *modes[] = {"Aléatoire", "Manuel", NULL};
+  const char *modes[] = {"Aléatoire", "Manuel", "Fichier", NULL};
   widgets_data.dropdown_mode = gtk_drop_down_new_from_strings(modes);
   g_signal_connect(widgets_data.dropdown_mode, "notify::selected",
                    G_CALLBACK(on_mode_changed), NULL);
@@ -549,6 +998,23 @@ void open_arrays_window(GtkWindow *parent) {
                  create_labeled_widget("Mode de remplissage :",
                                        widgets_data.dropdown_mode));
 
+  // 2a. Distribution et graine des valeurs aléatoires
+  widgets_data.box_random = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
+  const char *dists[DSA_ARRAY_DISTRIBUTION_COUNT + 1];
+  for (int d = 0; d < DSA_ARRAY_DISTRIBUTION_COUNT; d++)
+    dists[d] = dsa_array_distribution_label((DsaArrayDistribution)d);
+  dists[DSA_ARRAY_DISTRIBUTION_COUNT] = NULL;
+  widgets_data.dropdown_dist = gtk_drop_down_new_from_strings(dists);
+  gtk_box_append(
+      GTK_BOX(widgets_data.box_random),
+      create_labeled_widget("Distribution :", widgets_data.dropdown_dist));
+  widgets_data.entry_seed = gtk_entry_new();
+  gtk_entry_set_placeholder_text(GTK_ENTRY(widgets_data.entry_seed),
+                                 "Vide = nouvelle graine");
+  gtk_box_append(GTK_BOX(widgets_data.box_random),
+                 create_labeled_widget("Graine :", widgets_data.entry_seed));
+  gtk_box_append(GTK_BOX(left_panel), widgets_data.box_random);
+
   // 2b. Zone Manuelle (cachée par défaut)
   widgets_data.box_manual_input = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
   widgets_data.entry_manual = gtk_entry_new();
@@ -562,6 +1028,33 @@ void open_arrays_window(GtkWindow *parent) {
   gtk_widget_set_visible(widgets_data.box_manual_input,
                          FALSE); // Caché car défaut = Aléatoire
 
+  // 2c. Fichier : .dsa projeté en mémoire ou CSV lu par blocs (caché)
+  widgets_data.box_file = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
+  widgets_data.entry_file = gtk_entry_new();
+  gtk_entry_set_placeholder_text(GTK_ENTRY(widgets_data.entry_file),
+                                 "tableau.dsa ou valeurs.csv");
+  gtk_box_append(GTK_BOX(widgets_data.box_file),
+                 create_labeled_widget("Fichier (.dsa ou CSV) :",
+                                       widgets_data.entry_file));
+  GtkWidget *btn_browse = gtk_button_new_with_label("📂 Parcourir...");
+  g_signal_connect(btn_browse, "clicked", G_CALLBACK(on_browse_clicked), NULL);
+  gtk_box_append(GTK_BOX(widgets_data.box_file), btn_browse);
+
+  // Tri externe : le fichier est trié par tranches sans être chargé
+  widgets_data.spin_memory = gtk_spin_button_new_with_range(1, 65536, 64);
+  gtk_spin_button_set_value(GTK_SPIN_BUTTON(widgets_data.spin_memory),
+                            DSA_EXTERNAL_SORT_DEFAULT_BUDGET >> 20);
+  gtk_box_append(GTK_BOX(widgets_data.box_file),
+                 create_labeled_widget("Mémoire du tri externe (Mio) :",
+                                       widgets_data.spin_memory));
+  widgets_data.btn_external =
+      gtk_button_new_with_label("🗄 Tri externe vers...");
+  g_signal_connect(widgets_data.btn_external, "clicked",
+                   G_CALLBACK(on_external_clicked), NULL);
+  gtk_box_append(GTK_BOX(widgets_data.box_file), widgets_data.btn_external);
+  gtk_box_append(GTK_BOX(left_panel), widgets_data.box_file);
+  gtk_widget_set_visible(widgets_data.box_file, FALSE);
+
   // 3. Taille
   widgets_data.spin_size = gtk_spin_button_new_with_range(0, 1000000, 1);
   gtk_spin_button_set_value(GTK_SPIN_BUTTON(widgets_data.spin_size), 0);
@@ -570,41 +1063,69 @@ void open_arrays_window(GtkWindow *parent) {
       create_labeled_widget("Taille du tableau :", widgets_data.spin_size));
 
   // 4. Algo
-  const char *algos[] = {"Tri à bulle", "Tri par insertion", "Tri Shell",
-                         "QuickSort", NULL};
+  const char *algos[] = {"Tri à bulle",
+                         "Tri par insertion",
+                         "Tri Shell",
+                         "QuickSort",
+                         "Tri par base (Radix)",
+                         "Tri par comptage",
+                         "Tri parallèle",
+                         "Tri fusion (stable)",
+                         NULL};
   widgets_data.dropdown_algo = gtk_drop_down_new_from_strings(algos);
   gtk_box_append(
       GTK_BOX(left_panel),
       create_labeled_widget("Méthode de tri :", widgets_data.dropdown_algo));
 
+  // 4b. Threads du tri parallèle
+  widgets_data.spin_threads =
+      gtk_spin_button_new_with_range(0, 64, 1); // 0 = automatique
+  gtk_spin_button_set_value(GTK_SPIN_BUTTON(widgets_data.spin_threads), 0);
+  gtk_box_append(GTK_BOX(left_panel),
+                 create_labeled_widget("Threads (tri parallèle, 0 = auto) :",
+                                       widgets_data.spin_threads));
+
   gtk_box_append(GTK_BOX(left_panel),
                  gtk_separator_new(GTK_ORIENTATION_HORIZONTAL));
 
   // 5. Boutons
-  GtkWidget *btn_trier = gtk_button_new_with_label("▶ Trier");
-  gtk_widget_add_css_class(btn_trier, "success-btn");
-  g_signal_connect(btn_trier, "clicked", G_CALLBACK(on_trier_clicked), NULL);
-  gtk_box_append(GTK_BOX(left_panel), btn_trier);
-
-  GtkWidget *btn_compare = gtk_button_new_with_label("⚖ Comparer méthodes");
-  gtk_widget_add_css_class(btn_compare, "info-btn");
-  g_signal_connect(btn_compare, "clicked", G_CALLBACK(on_compare_clicked),
-                   NULL);
-  gtk_box_append(GTK_BOX(left_panel), btn_compare);
+  widgets_data.btn_trier = gtk_button_new_with_label("▶ Trier");
+  gtk_widget_add_css_class(widgets_data.btn_trier, "success-btn");
+  g_signal_connect(widgets_data.btn_trier, "clicked",
+                   G_CALLBACK(on_trier_clicked), NULL);
+  gtk_box_append(GTK_BOX(left_panel), widgets_data.btn_trier);
+
+  widgets_data.btn_compare =
+      gtk_button_new_with_label("⚖ Comparer méthodes");
+  gtk_widget_add_css_class(widgets_data.btn_compare, "info-btn");
+  g_signal_connect(widgets_data.btn_compare, "clicked",
+                   G_CALLBACK(on_compare_clicked), NULL);
+  gtk_box_append(GTK_BOX(left_panel), widgets_data.btn_compare);
+
+  widgets_data.btn_cancel = gtk_button_new_with_label("⏹ Annuler le tri");
+  g_signal_connect(widgets_data.btn_cancel, "clicked",
+                   G_CALLBACK(on_cancel_clicked), NULL);
+  gtk_box_append(GTK_BOX(left_panel), widgets_data.btn_cancel);
 
   GtkWidget *btn_save = gtk_button_new_with_label("💾 Enregistrer résultats");
   gtk_widget_add_css_class(btn_save, "save-btn");
   g_signal_connect(btn_save, "clicked", G_CALLBACK(on_save_clicked), NULL);
   gtk_box_append(GTK_BOX(left_panel), btn_save);
 
+  GtkWidget *btn_export = gtk_button_new_with_label("📦 Exporter données");
+  gtk_widget_add_css_class(btn_export, "save-btn");
+  g_signal_connect(btn_export, "clicked", G_CALLBACK(on_export_clicked), NULL);
+  gtk_box_append(GTK_BOX(left_panel), btn_export);
+
   GtkWidget *btn_curve = gtk_button_new_with_label("📈 Générer courbe");
   gtk_widget_add_css_class(btn_curve, "accent-btn");
   g_signal_connect(btn_curve, "clicked", G_CALLBACK(on_curve_clicked), NULL);
   gtk_box_append(GTK_BOX(left_panel), btn_curve);
 
-  GtkWidget *btn_reset = gtk_button_new_with_label("🔄 Réinitialiser");
-  g_signal_connect(btn_reset, "clicked", G_CALLBACK(on_reset_clicked), NULL);
-  gtk_box_append(GTK_BOX(left_panel), btn_reset);
+  widgets_data.btn_reset = gtk_button_new_with_label("🔄 Réinitialiser");
+  g_signal_connect(widgets_data.btn_reset, "clicked",
+                   G_CALLBACK(on_reset_clicked), NULL);
+  gtk_box_append(GTK_BOX(left_panel), widgets_data.btn_reset);
 
   // Espacement
   gtk_box_append(GTK_BOX(left_panel),
@@ -637,6 +1158,12 @@ void open_arrays_window(GtkWindow *parent) {
   gtk_widget_add_css_class(widgets_data.label_time, "result-label");
   gtk_box_append(GTK_BOX(right_panel), widgets_data.label_time);
 
+  // Avancement du tri en arrière-plan (visible pendant le tri)
+  widgets_data.progress_bar = gtk_progress_bar_new();
+  gtk_progress_bar_set_show_text(GTK_PROGRESS_BAR(widgets_data.progress_bar),
+                                 TRUE);
+  gtk_box_append(GTK_BOX(right_panel), widgets_data.progress_bar);
+
   // Paned split for Before/After
   GtkWidget *paned = gtk_paned_new(GTK_ORIENTATION_VERTICAL);
   gtk_widget_set_vexpand(paned, TRUE);
@@ -648,17 +1175,10 @@ void open_arrays_window(GtkWindow *parent) {
   GtkWidget *vbox_input = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
   gtk_box_append(GTK_BOX(vbox_input), gtk_label_new("Données Initiales:"));
 
-  widgets_data.text_view_input = gtk_text_view_new();
-  gtk_text_view_set_editable(GTK_TEXT_VIEW(widgets_data.text_view_input),
-                             FALSE);
-  gtk_text_view_set_wrap_mode(GTK_TEXT_VIEW(widgets_data.text_view_input),
-                              GTK_WRAP_WORD_CHAR);
-  GtkWidget *s1 = gtk_scrolled_window_new();
-  gtk_scrolled_window_set_child(GTK_SCROLLED_WINDOW(s1),
-                                widgets_data.text_view_input);
-  gtk_widget_set_vexpand(s1, TRUE);
-  gtk_widget_set_hexpand(s1, TRUE);
-  gtk_box_append(GTK_BOX(vbox_input), s1);
+  widgets_data.viewer_input = array_viewer_new();
+  gtk_widget_set_vexpand(widgets_data.viewer_input, TRUE);
+  gtk_widget_set_hexpand(widgets_data.viewer_input, TRUE);
+  gtk_box_append(GTK_BOX(vbox_input), widgets_data.viewer_input);
 
   gtk_paned_set_start_child(GTK_PANED(paned), vbox_input);
   gtk_paned_set_resize_start_child(GTK_PANED(paned), TRUE);
@@ -667,20 +1187,16 @@ void open_arrays_window(GtkWindow *parent) {
   GtkWidget *vbox_output = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
   gtk_box_append(GTK_BOX(vbox_output), gtk_label_new("Résultat du Tri:"));
 
-  widgets_data.text_view_output = gtk_text_view_new();
-  gtk_text_view_set_editable(GTK_TEXT_VIEW(widgets_data.text_view_output),
-                             FALSE);
-  gtk_text_view_set_wrap_mode(GTK_TEXT_VIEW(widgets_data.text_view_output),
-                              GTK_WRAP_WORD_CHAR);
-  GtkWidget *s2 = gtk_scrolled_window_new();
-  gtk_scrolled_window_set_child(GTK_SCROLLED_WINDOW(s2),
-                                widgets_data.text_view_output);
-  gtk_widget_set_vexpand(s2, TRUE);
-  gtk_widget_set_hexpand(s2, TRUE);
-  gtk_box_append(GTK_BOX(vbox_output), s2);
+  widgets_data.viewer_output = array_viewer_new();
+  gtk_widget_set_vexpand(widgets_data.viewer_output, TRUE);
+  gtk_widget_set_hexpand(widgets_data.viewer_output, TRUE);
+  gtk_box_append(GTK_BOX(vbox_output), widgets_data.viewer_output);
 
   gtk_paned_set_end_child(GTK_PANED(paned), vbox_output);
   gtk_paned_set_resize_end_child(GTK_PANED(paned), TRUE);
 
+  // Un tri lancé depuis une fenêtre précédente peut encore se terminer
+  set_sort_running(widgets_data.job != NULL);
+
   gtk_window_present(GTK_WINDOW(window));
 }
@@ -0,0 +1,59 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "array_generators.h"
+#include "ds_types.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Banc d'essai en ligne de commande (cible ds_bench, sans GTK).
+// Chaque suite est dans son propre fichier bench_*.c.
+
+#define BENCH_MAX_SIZES 32
+
+typedef enum { BENCH_FORMAT_CSV, BENCH_FORMAT_JSON } BenchFormat;
+
+typedef struct {
+  size_t sizes[BENCH_MAX_SIZES];
+  int num_sizes;
+  int repetitions;
+  bool types[DSA_DATA_TYPE_COUNT]; // Types d'éléments sélectionnés
+  // Distributions de la suite "sort" et distribution des mesures en cours
+  bool distributions[DSA_ARRAY_DISTRIBUTION_COUNT];
+  DsaArrayDistribution distribution;
+  size_t quadratic_limit; // Taille maximale des algorithmes O(n²)
+  uint64_t seed;          // Graine des données (colonne "seed")
+  // Fichier (.dsa ou CSV) trié par la suite "sort" à la place des données
+  // générées ; distribution "file"
+  const char *input;
+  // Suite "external" : budget mémoire (octets, 0 : défaut) et répertoire
+  // des fichiers temporaires (NULL : répertoire courant)
+  size_t memory_budget;
+  const char *temp_dir;
+  BenchFormat format;
+  FILE *out;
+  int records;  // Nombre de mesures déjà écrites
+  int failures; // Vérifications échouées : ds_bench se termine avec 1
+} BenchConfig;
+
+// Écrit une mesure (ligne CSV ou objet JSON) à partir des durées brutes de
+// chaque répétition ; `samples_ns` est trié en place. La colonne
+// "distribution" reprend config->distribution (ou "file" avec
+// config->input) et "seed" config->seed.
+void bench_report(BenchConfig *config, const char *suite, const char *name,
+                  DsaDataType type, size_t size, uint64_t *samples_ns,
+                  int count);
+
+const char *bench_type_name(DsaDataType type);
+
+// Suites disponibles
+void bench_suite_sort(BenchConfig *config);
+void bench_suite_lists(BenchConfig *config);
+void bench_suite_trees(BenchConfig *config);
+void bench_suite_graphs(BenchConfig *config);
+void bench_suite_external(BenchConfig *config);
+void bench_suite_parse(BenchConfig *config);
+
+#endif
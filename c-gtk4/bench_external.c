@@ -0,0 +1,103 @@
+#include "array_generators.h"
+#include "array_io.h"
+#include "bench.h"
+#include "external_sort.h"
+#include "timing.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- Suite "external" : tri externe d'un fichier .dsa ---
+//
+// Les données générées sont enregistrées dans config->temp_dir avant chaque
+// répétition (hors mesure) ; la durée couvre la lecture, les tranches, les
+// fusions et l'écriture du résultat.
+
+#define BENCH_EXTERNAL_INPUT "ds_bench_external.dsa"
+#define BENCH_EXTERNAL_OUTPUT "ds_bench_external_sorted.dsa"
+
+// Chemin `dir`/`name`, à libérer par free
+static char *temp_path(const BenchConfig *config, const char *name) {
+  const char *dir = config->temp_dir ? config->temp_dir : ".";
+  size_t length = strlen(dir) + 1 + strlen(name) + 1;
+  char *path = malloc(length);
+  if (path)
+    snprintf(path, length, "%s/%s", dir, name);
+  return path;
+}
+
+static DsaArrayIoStatus bench_external_file(BenchConfig *config,
+                                            const char *input,
+                                            const char *output,
+                                            DsaDataType type, size_t size,
+                                            const DsaArrayData *regenerate,
+                                            uint64_t *samples) {
+  DsaExternalSortOptions options;
+  dsa_external_sort_default_options(&options);
+  if (config->memory_budget)
+    options.memory_budget = config->memory_budget;
+  options.temp_dir = config->temp_dir;
+
+  DsaExternalSortStats stats = {0};
+  for (int r = 0; r < config->repetitions; r++) {
+    DsaArrayIoStatus status = DSA_ARRAY_IO_OK;
+    if (regenerate)
+      status = dsa_array_save_binary(input, regenerate, NULL);
+    uint64_t start = dsa_timing_now_ns();
+    if (status == DSA_ARRAY_IO_OK)
+      status = dsa_external_sort_file(input, output, &options, &stats);
+    samples[r] = dsa_timing_now_ns() - start;
+    if (status != DSA_ARRAY_IO_OK)
+      return status;
+  }
+  bench_report(config, "external", "external", type, size, samples,
+               config->repetitions);
+  fprintf(stderr, "external %s %zu : %zu tranches, %zu passages (k = %zu)\n",
+          bench_type_name(type), size, stats.runs, stats.merge_passes,
+          stats.fan_in);
+  return DSA_ARRAY_IO_OK;
+}
+
+void bench_suite_external(BenchConfig *config) {
+  uint64_t *samples = malloc(config->repetitions * sizeof(uint64_t));
+  char *input = temp_path(config, BENCH_EXTERNAL_INPUT);
+  char *output = temp_path(config, BENCH_EXTERNAL_OUTPUT);
+  DsaArrayIoStatus status = DSA_ARRAY_IO_OK;
+  if (!samples || !input || !output)
+    status = DSA_ARRAY_IO_ERR_MEMORY;
+
+  if (status == DSA_ARRAY_IO_OK && config->input) {
+    // Fichier existant (.dsa uniquement), laissé intact
+    DsaArrayFileInfo info;
+    status = dsa_array_read_info(config->input, &info);
+    if (status == DSA_ARRAY_IO_OK) {
+      config->seed = info.has_seed ? info.seed : 0;
+      status = bench_external_file(config, config->input, output, info.type,
+                                   (size_t)info.count, NULL, samples);
+    }
+  } else if (status == DSA_ARRAY_IO_OK) {
+    for (int t = 0; status == DSA_ARRAY_IO_OK && t < DSA_DATA_TYPE_COUNT; t++) {
+      if (!config->types[t] || t == DSA_TYPE_STRING)
+        continue;
+      for (int s = 0; status == DSA_ARRAY_IO_OK && s < config->num_sizes; s++) {
+        DsaArrayData base = {0};
+        DsaArrayGenOptions options =
+            dsa_array_gen_options(config->distribution, config->seed);
+        if (dsa_generate_array(&base, config->sizes[s], (DsaDataType)t,
+                               &options))
+          status = bench_external_file(config, input, output, (DsaDataType)t,
+                                       base.size, &base, samples);
+        dsa_free_array_data(&base);
+      }
+    }
+    remove(input);
+  }
+
+  if (status != DSA_ARRAY_IO_OK)
+    fprintf(stderr, "external : %s\n", dsa_array_io_status_message(status));
+  if (output)
+    remove(output);
+  free(output);
+  free(input);
+  free(samples);
+}
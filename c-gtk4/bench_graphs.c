@@ -0,0 +1,72 @@
+#include "bench.h"
+#include "graph_algorithms.h"
+#include "prng.h"
+#include <stdlib.h>
+
+// --- Suite "graphs" : plus courts chemins sur graphes aléatoires ---
+// Le nombre de sommets est borné par DSA_GRAPH_MAX_VERTICES : les tailles plus
+// grandes sont ramenées à cette borne (et mesurées une seule fois).
+
+// Probabilité (en %) d'une arête entre deux sommets
+#define BENCH_GRAPH_DENSITY 30
+
+static DsaGraph *build_random_graph(int vertices) {
+  DsaPrng *rng = dsa_prng_thread();
+  DsaGraph *graph = dsa_graph_create(vertices, DSA_TYPE_INT);
+  if (!graph)
+    return NULL;
+
+  for (int i = 0; i < vertices; i++)
+    dsa_graph_set_node_value_int(graph, i, i);
+
+  // Chaîne 0 - 1 - ... - n-1 pour garantir un chemin, puis arêtes aléatoires
+  for (int i = 0; i + 1 < vertices; i++)
+    dsa_graph_add_edge(graph, i, i + 1, 1 + (int)dsa_prng_bounded(rng, 100));
+  for (int u = 0; u < vertices; u++) {
+    for (int v = u + 2; v < vertices; v++) {
+      if (dsa_prng_bounded(rng, 100) < BENCH_GRAPH_DENSITY)
+        dsa_graph_add_edge(graph, u, v, 1 + (int)dsa_prng_bounded(rng, 100));
+    }
+  }
+  return graph;
+}
+
+void bench_suite_graphs(BenchConfig *config) {
+  static const struct {
+    const char *name;
+    DsaAlgorithmType algo;
+  } CASES[] = {{"dijkstra", DSA_ALGO_DIJKSTRA},
+               {"bellman_ford", DSA_ALGO_BELLMAN_FORD},
+               {"floyd_warshall", DSA_ALGO_FLOYD_WARSHALL}};
+
+  uint64_t *samples = malloc(config->repetitions * sizeof(uint64_t));
+  if (!samples)
+    return;
+
+  dsa_prng_thread_reseed(config->seed);
+  int previous = 0;
+  for (int s = 0; s < config->num_sizes; s++) {
+    int vertices = config->sizes[s] > DSA_GRAPH_MAX_VERTICES
+                       ? DSA_GRAPH_MAX_VERTICES
+                       : (int)config->sizes[s];
+    if (vertices < 2 || vertices == previous)
+      continue;
+    previous = vertices;
+
+    DsaGraph *graph = build_random_graph(vertices);
+    if (!graph)
+      continue;
+
+    for (size_t c = 0; c < sizeof(CASES) / sizeof(CASES[0]); c++) {
+      for (int r = 0; r < config->repetitions; r++) {
+        DsaPathResult result =
+            dsa_execute_algorithm(graph, 0, vertices - 1, CASES[c].algo);
+        samples[r] = result.timing.ns;
+      }
+      bench_report(config, "graphs", CASES[c].name, DSA_TYPE_INT,
+                   (size_t)vertices, samples, config->repetitions);
+    }
+    dsa_graph_destroy(graph);
+  }
+  free(samples);
+}
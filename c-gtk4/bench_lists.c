@@ -0,0 +1,409 @@
+#include "bench.h"
+#include "list_algorithms.h"
+#include "prng.h"
+#include "timing.h"
+#include "unrolled_list.h"
+#include <stdlib.h>
+
+// --- Suite "lists" : tris des listes simples, doubles et déroulées ---
+// Cas supplémentaires, pour chaque genre de liste ("simple_*", "double_*",
+// "unrolled_*") : construction par ajouts en fin ("build"), copie profonde
+// ("copy"), parcours dans l'ordre de création puis après un tri fusion
+// ("traverse", "traverse_sorted"), LIST_GET_COUNT accès par position
+// ("get") et destruction ("destroy"). Avec --list-alloc malloc, tous les
+// noms de cas prennent le suffixe "_malloc" (les listes déroulées gardent
+// leur réserve de blocs) ; avec --list-index off, ceux des listes simples
+// et doubles prennent le suffixe "_walk".
+
+// Accès par position mesurés ensemble, aux mêmes positions tirées pour
+// toutes les listes d'une taille
+#define LIST_GET_COUNT 1000
+
+// Les listes déroulées sont triées par l'algorithme de tableau
+// correspondant (sans équivalent pour le tri par sélection)
+typedef struct {
+  const char *name;
+  void (*sort_simple)(DsaSimpleList *list);
+  void (*sort_double)(DsaDoubleList *list);
+  bool quadratic;
+  bool has_unrolled;
+  DsaSortAlgo unrolled_algo;
+} ListSortCase;
+
+static const ListSortCase LIST_CASES[] = {
+    {"bubble", dsa_bubble_sort_simple, dsa_bubble_sort_double, true, true,
+     DSA_ALGO_BUBBLE},
+    {"insertion", dsa_insertion_sort_simple, dsa_insertion_sort_double, true,
+     true, DSA_ALGO_INSERTION},
+    {"selection", dsa_selection_sort_simple, dsa_selection_sort_double, true,
+     false, DSA_ALGO_BUBBLE},
+    {"merge", dsa_merge_sort_simple, dsa_merge_sort_double, false, true,
+     DSA_ALGO_MERGE},
+    {"quick", dsa_quick_sort_simple, dsa_quick_sort_double, false, true,
+     DSA_ALGO_QUICK},
+};
+
+#define LIST_CASE_COUNT (sizeof(LIST_CASES) / sizeof(LIST_CASES[0]))
+
+// Copie profonde des valeurs (les listes libèrent leurs chaînes)
+static DsaSimpleList *build_simple_list(const DsaNodeData *values, size_t count,
+                                        DsaDataType type) {
+  DsaSimpleList *list = dsa_create_simple_list(type);
+  for (size_t i = 0; list && i < count; i++)
+    dsa_insert_simple_at_end(list, dsa_copy_node_data(values[i], type));
+  return list;
+}
+
+static DsaDoubleList *build_double_list(const DsaNodeData *values, size_t count,
+                                        DsaDataType type) {
+  DsaDoubleList *list = dsa_create_double_list(type);
+  for (size_t i = 0; list && i < count; i++)
+    dsa_insert_double_at_end(list, dsa_copy_node_data(values[i], type));
+  return list;
+}
+
+static DsaUnrolledList *build_unrolled_list(const DsaNodeData *values,
+                                            size_t count, DsaDataType type) {
+  DsaUnrolledList *list = dsa_create_unrolled_list(type);
+  for (size_t i = 0; list && i < count; i++)
+    dsa_insert_unrolled_at_end(list, dsa_copy_node_data(values[i], type));
+  return list;
+}
+
+// Nom de cas "<kind>_<op>", suffixé par l'allocation des nœuds et
+// l'absence d'index par position
+static void list_case_name(char *name, size_t length, const char *kind,
+                           const char *op) {
+  snprintf(name, length, "%s_%s%s%s", kind, op,
+           dsa_list_get_node_pool() ? "" : "_malloc",
+           dsa_list_get_position_index() ? "" : "_walk");
+}
+
+// Résultat des parcours, lu pour qu'ils ne soient pas éliminés
+static volatile uintptr_t list_traversal_sink;
+
+static uint64_t traverse_simple_list(const DsaSimpleList *list) {
+  uintptr_t sum = 0;
+  DsaTimingMark start = dsa_timing_mark();
+  for (const DsaSimpleNode *node = list->head; node; node = node->next)
+    sum += (uintptr_t)node->data.int_val;
+  uint64_t ns = dsa_timing_since(start).ns;
+  list_traversal_sink = sum;
+  return ns;
+}
+
+static uint64_t traverse_double_list(const DsaDoubleList *list) {
+  uintptr_t sum = 0;
+  DsaTimingMark start = dsa_timing_mark();
+  for (const DsaDoubleNode *node = list->head; node; node = node->next)
+    sum += (uintptr_t)node->data.int_val;
+  uint64_t ns = dsa_timing_since(start).ns;
+  list_traversal_sink = sum;
+  return ns;
+}
+
+static uint64_t traverse_unrolled_list(const DsaUnrolledList *list) {
+  uintptr_t sum = 0;
+  DsaTimingMark start = dsa_timing_mark();
+  for (const DsaUnrolledBlock *block = list->head; block; block = block->next) {
+    for (int i = 0; i < block->count; i++)
+      sum += (uintptr_t)dsa_unrolled_block_value(list, block, i).int_val;
+  }
+  uint64_t ns = dsa_timing_since(start).ns;
+  list_traversal_sink = sum;
+  return ns;
+}
+
+static uint64_t get_simple_positions(DsaSimpleList *list,
+                                     const int *positions) {
+  uintptr_t sum = 0;
+  DsaTimingMark start = dsa_timing_mark();
+  for (int i = 0; i < LIST_GET_COUNT; i++)
+    sum += (uintptr_t)dsa_get_simple_node_at(list, positions[i])->data.int_val;
+  uint64_t ns = dsa_timing_since(start).ns;
+  list_traversal_sink = sum;
+  return ns;
+}
+
+static uint64_t get_double_positions(DsaDoubleList *list,
+                                     const int *positions) {
+  uintptr_t sum = 0;
+  DsaTimingMark start = dsa_timing_mark();
+  for (int i = 0; i < LIST_GET_COUNT; i++)
+    sum += (uintptr_t)dsa_get_double_node_at(list, positions[i])->data.int_val;
+  uint64_t ns = dsa_timing_since(start).ns;
+  list_traversal_sink = sum;
+  return ns;
+}
+
+static uint64_t get_unrolled_positions(const DsaUnrolledList *list,
+                                       const int *positions) {
+  uintptr_t sum = 0;
+  DsaTimingMark start = dsa_timing_mark();
+  for (int i = 0; i < LIST_GET_COUNT; i++) {
+    DsaNodeData data;
+    if (dsa_get_unrolled_at(list, positions[i], &data))
+      sum += (uintptr_t)data.int_val;
+  }
+  uint64_t ns = dsa_timing_since(start).ns;
+  list_traversal_sink = sum;
+  return ns;
+}
+
+// Construction, copie, parcours et destruction (mémoire des nœuds)
+static void bench_simple_memory(BenchConfig *config, const DsaNodeData *values,
+                                size_t size, DsaDataType type,
+                                const int *positions, uint64_t *samples) {
+  char name[64];
+  DsaSimpleList *list = NULL;
+  for (int r = 0; r < config->repetitions; r++) {
+    dsa_free_simple_list(list);
+    DsaTimingMark start = dsa_timing_mark();
+    list = build_simple_list(values, size, type);
+    samples[r] = dsa_timing_since(start).ns;
+  }
+  list_case_name(name, sizeof(name), "simple", "build");
+  bench_report(config, "lists", name, type, size, samples,
+               config->repetitions);
+  if (!list)
+    return;
+
+  for (int r = 0; r < config->repetitions; r++) {
+    DsaTimingMark start = dsa_timing_mark();
+    DsaSimpleList *copy = dsa_copy_simple_list(list);
+    samples[r] = dsa_timing_since(start).ns;
+    dsa_free_simple_list(copy);
+  }
+  list_case_name(name, sizeof(name), "simple", "copy");
+  bench_report(config, "lists", name, type, size, samples,
+               config->repetitions);
+
+  for (int r = 0; r < config->repetitions; r++)
+    samples[r] = traverse_simple_list(list);
+  list_case_name(name, sizeof(name), "simple", "traverse");
+  bench_report(config, "lists", name, type, size, samples,
+               config->repetitions);
+
+  for (int r = 0; r < config->repetitions; r++)
+    samples[r] = get_simple_positions(list, positions);
+  list_case_name(name, sizeof(name), "simple", "get");
+  bench_report(config, "lists", name, type, size, samples,
+               config->repetitions);
+
+  dsa_merge_sort_simple(list);
+  for (int r = 0; r < config->repetitions; r++)
+    samples[r] = traverse_simple_list(list);
+  list_case_name(name, sizeof(name), "simple", "traverse_sorted");
+  bench_report(config, "lists", name, type, size, samples,
+               config->repetitions);
+  dsa_free_simple_list(list);
+
+  for (int r = 0; r < config->repetitions; r++) {
+    list = build_simple_list(values, size, type);
+    DsaTimingMark start = dsa_timing_mark();
+    dsa_free_simple_list(list);
+    samples[r] = dsa_timing_since(start).ns;
+  }
+  list_case_name(name, sizeof(name), "simple", "destroy");
+  bench_report(config, "lists", name, type, size, samples,
+               config->repetitions);
+}
+
+static void bench_double_memory(BenchConfig *config, const DsaNodeData *values,
+                                size_t size, DsaDataType type,
+                                const int *positions, uint64_t *samples) {
+  char name[64];
+  DsaDoubleList *list = NULL;
+  for (int r = 0; r < config->repetitions; r++) {
+    dsa_free_double_list(list);
+    DsaTimingMark start = dsa_timing_mark();
+    list = build_double_list(values, size, type);
+    samples[r] = dsa_timing_since(start).ns;
+  }
+  list_case_name(name, sizeof(name), "double", "build");
+  bench_report(config, "lists", name, type, size, samples,
+               config->repetitions);
+  if (!list)
+    return;
+
+  for (int r = 0; r < config->repetitions; r++) {
+    DsaTimingMark start = dsa_timing_mark();
+    DsaDoubleList *copy = dsa_copy_double_list(list);
+    samples[r] = dsa_timing_since(start).ns;
+    dsa_free_double_list(copy);
+  }
+  list_case_name(name, sizeof(name), "double", "copy");
+  bench_report(config, "lists", name, type, size, samples,
+               config->repetitions);
+
+  for (int r = 0; r < config->repetitions; r++)
+    samples[r] = traverse_double_list(list);
+  list_case_name(name, sizeof(name), "double", "traverse");
+  bench_report(config, "lists", name, type, size, samples,
+               config->repetitions);
+
+  for (int r = 0; r < config->repetitions; r++)
+    samples[r] = get_double_positions(list, positions);
+  list_case_name(name, sizeof(name), "double", "get");
+  bench_report(config, "lists", name, type, size, samples,
+               config->repetitions);
+
+  dsa_merge_sort_double(list);
+  for (int r = 0; r < config->repetitions; r++)
+    samples[r] = traverse_double_list(list);
+  list_case_name(name, sizeof(name), "double", "traverse_sorted");
+  bench_report(config, "lists", name, type, size, samples,
+               config->repetitions);
+  dsa_free_double_list(list);
+
+  for (int r = 0; r < config->repetitions; r++) {
+    list = build_double_list(values, size, type);
+    DsaTimingMark start = dsa_timing_mark();
+    dsa_free_double_list(list);
+    samples[r] = dsa_timing_since(start).ns;
+  }
+  list_case_name(name, sizeof(name), "double", "destroy");
+  bench_report(config, "lists", name, type, size, samples,
+               config->repetitions);
+}
+
+// Mêmes mesures pour la liste déroulée (blocs toujours pris dans sa
+// réserve : noms sans suffixe)
+static void bench_unrolled_memory(BenchConfig *config,
+                                  const DsaNodeData *values, size_t size,
+                                  DsaDataType type, const int *positions,
+                                  uint64_t *samples) {
+  DsaUnrolledList *list = NULL;
+  for (int r = 0; r < config->repetitions; r++) {
+    dsa_free_unrolled_list(list);
+    DsaTimingMark start = dsa_timing_mark();
+    list = build_unrolled_list(values, size, type);
+    samples[r] = dsa_timing_since(start).ns;
+  }
+  bench_report(config, "lists", "unrolled_build", type, size, samples,
+               config->repetitions);
+  if (!list)
+    return;
+
+  for (int r = 0; r < config->repetitions; r++) {
+    DsaTimingMark start = dsa_timing_mark();
+    DsaUnrolledList *copy = dsa_copy_unrolled_list(list);
+    samples[r] = dsa_timing_since(start).ns;
+    dsa_free_unrolled_list(copy);
+  }
+  bench_report(config, "lists", "unrolled_copy", type, size, samples,
+               config->repetitions);
+
+  for (int r = 0; r < config->repetitions; r++)
+    samples[r] = traverse_unrolled_list(list);
+  bench_report(config, "lists", "unrolled_traverse", type, size, samples,
+               config->repetitions);
+
+  for (int r = 0; r < config->repetitions; r++)
+    samples[r] = get_unrolled_positions(list, positions);
+  bench_report(config, "lists", "unrolled_get", type, size, samples,
+               config->repetitions);
+
+  dsa_sort_unrolled_list(list, DSA_ALGO_MERGE);
+  for (int r = 0; r < config->repetitions; r++)
+    samples[r] = traverse_unrolled_list(list);
+  bench_report(config, "lists", "unrolled_traverse_sorted", type, size,
+               samples, config->repetitions);
+  dsa_free_unrolled_list(list);
+
+  for (int r = 0; r < config->repetitions; r++) {
+    list = build_unrolled_list(values, size, type);
+    DsaTimingMark start = dsa_timing_mark();
+    dsa_free_unrolled_list(list);
+    samples[r] = dsa_timing_since(start).ns;
+  }
+  bench_report(config, "lists", "unrolled_destroy", type, size, samples,
+               config->repetitions);
+}
+
+void bench_suite_lists(BenchConfig *config) {
+  uint64_t *samples = malloc(config->repetitions * sizeof(uint64_t));
+  int *positions = malloc(LIST_GET_COUNT * sizeof(int));
+  if (!samples || !positions) {
+    free(positions);
+    free(samples);
+    return;
+  }
+
+  // Valeurs tirées par dsa_generate_random_node_data (générateur du thread)
+  dsa_prng_thread_reseed(config->seed);
+  for (int t = 0; t < DSA_DATA_TYPE_COUNT; t++) {
+    if (!config->types[t])
+      continue;
+    DsaDataType type = (DsaDataType)t;
+
+    for (int s = 0; s < config->num_sizes; s++) {
+      size_t size = config->sizes[s];
+      DsaNodeData *values = malloc(size * sizeof(DsaNodeData));
+      if (!size || !values) {
+        free(values);
+        continue;
+      }
+      for (size_t i = 0; i < size; i++)
+        values[i] = dsa_generate_random_node_data(type);
+      DsaPrng rng;
+      dsa_prng_seed(&rng, config->seed + size);
+      for (int i = 0; i < LIST_GET_COUNT; i++)
+        positions[i] = (int)dsa_prng_bounded(&rng, (uint32_t)size);
+
+      bench_simple_memory(config, values, size, type, positions, samples);
+      bench_double_memory(config, values, size, type, positions, samples);
+      bench_unrolled_memory(config, values, size, type, positions, samples);
+
+      for (size_t c = 0; c < LIST_CASE_COUNT; c++) {
+        const ListSortCase *sort_case = &LIST_CASES[c];
+        if (sort_case->quadratic && size > config->quadratic_limit)
+          continue;
+
+        char name[64];
+        list_case_name(name, sizeof(name), "simple", sort_case->name);
+        for (int r = 0; r < config->repetitions; r++) {
+          DsaSimpleList *list = build_simple_list(values, size, type);
+          DsaTimingMark start = dsa_timing_mark();
+          sort_case->sort_simple(list);
+          samples[r] = dsa_timing_since(start).ns;
+          dsa_free_simple_list(list);
+        }
+        bench_report(config, "lists", name, type, size, samples,
+                     config->repetitions);
+
+        list_case_name(name, sizeof(name), "double", sort_case->name);
+        for (int r = 0; r < config->repetitions; r++) {
+          DsaDoubleList *list = build_double_list(values, size, type);
+          DsaTimingMark start = dsa_timing_mark();
+          sort_case->sort_double(list);
+          samples[r] = dsa_timing_since(start).ns;
+          dsa_free_double_list(list);
+        }
+        bench_report(config, "lists", name, type, size, samples,
+                     config->repetitions);
+
+        if (!sort_case->has_unrolled)
+          continue;
+        snprintf(name, sizeof(name), "unrolled_%s", sort_case->name);
+        for (int r = 0; r < config->repetitions; r++) {
+          DsaUnrolledList *list = build_unrolled_list(values, size, type);
+          DsaTimingMark start = dsa_timing_mark();
+          dsa_sort_unrolled_list(list, sort_case->unrolled_algo);
+          samples[r] = dsa_timing_since(start).ns;
+          dsa_free_unrolled_list(list);
+        }
+        bench_report(config, "lists", name, type, size, samples,
+                     config->repetitions);
+      }
+
+      if (type == DSA_TYPE_STRING) {
+        for (size_t i = 0; i < size; i++)
+          free(values[i].string_val);
+      }
+      free(values);
+    }
+  }
+  free(positions);
+  free(samples);
+}
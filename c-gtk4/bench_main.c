@@ -0,0 +1,314 @@
+#include "bench.h"
+#include "list_algorithms.h"
+#include "prng.h"
+#include "sort_algorithms.h"
+#include "timing.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Banc d'essai headless : ds_bench [options]
+// Exécute les suites demandées et écrit une mesure par (suite, cas, type,
+// taille) en CSV ou JSON, avec les durées en nanosecondes.
+
+typedef struct {
+  const char *name;
+  void (*run)(BenchConfig *config);
+} BenchSuite;
+
+static const BenchSuite SUITES[] = {
+    {"sort", bench_suite_sort},
+    {"lists", bench_suite_lists},
+    {"trees", bench_suite_trees},
+    {"graphs", bench_suite_graphs},
+    {"external", bench_suite_external},
+    {"parse", bench_suite_parse},
+};
+
+#define SUITE_COUNT (sizeof(SUITES) / sizeof(SUITES[0]))
+
+static const char *TYPE_NAMES[DSA_DATA_TYPE_COUNT] = {"int", "float", "char",
+                                                       "string"};
+
+const char *bench_type_name(DsaDataType type) { return TYPE_NAMES[type]; }
+
+// --- Sortie ---
+
+void bench_report(BenchConfig *config, const char *suite, const char *name,
+                  DsaDataType type, size_t size, uint64_t *samples_ns,
+                  int count) {
+  DsaTimingStats stats = dsa_timing_stats(samples_ns, (size_t)count);
+
+  const char *distribution =
+      config->input ? "file"
+                    : dsa_array_distribution_name(config->distribution);
+
+  if (config->format == BENCH_FORMAT_JSON) {
+    fprintf(config->out,
+            "%s  {\"suite\": \"%s\", \"case\": \"%s\", \"type\": \"%s\", "
+            "\"distribution\": \"%s\", \"seed\": %llu, \"size\": %zu, "
+            "\"repetitions\": %d, \"min_ns\": %llu, \"median_ns\": %llu, "
+            "\"p99_ns\": %llu, \"max_ns\": %llu, \"mean_ns\": %.1f, "
+            "\"ci_low_ns\": %llu, \"ci_high_ns\": %llu}",
+            config->records ? ",\n" : "", suite, name, bench_type_name(type),
+            distribution, (unsigned long long)config->seed, size, count,
+            (unsigned long long)stats.min_ns,
+            (unsigned long long)stats.median_ns,
+            (unsigned long long)stats.p99_ns, (unsigned long long)stats.max_ns,
+            stats.mean_ns, (unsigned long long)stats.ci_low_ns,
+            (unsigned long long)stats.ci_high_ns);
+  } else {
+    fprintf(config->out,
+            "%s,%s,%s,%s,%llu,%zu,%d,%llu,%llu,%llu,%llu,%.1f,%llu,%llu\n",
+            suite, name, bench_type_name(type), distribution,
+            (unsigned long long)config->seed, size, count,
+            (unsigned long long)stats.min_ns,
+            (unsigned long long)stats.median_ns,
+            (unsigned long long)stats.p99_ns, (unsigned long long)stats.max_ns,
+            stats.mean_ns, (unsigned long long)stats.ci_low_ns,
+            (unsigned long long)stats.ci_high_ns);
+  }
+  fflush(config->out);
+  config->records++;
+}
+
+// --- Ligne de commande ---
+
+static void print_usage(const char *program) {
+  fprintf(stderr,
+          "Usage : %s [options]\n"
+          "  --suite NOM         sort, lists, trees, graphs, external, parse "
+          "ou all\n"
+          "                      (défaut : all ; option répétable)\n"
+          "  --sizes N,N,...     tailles testées (défaut : 1000,10000,100000)\n"
+          "  --reps N            répétitions par mesure (défaut : 5)\n"
+          "  --type T            int, float, char, string ou all (défaut : "
+          "int)\n"
+          "  --dist D,D,...      distributions de la suite sort : uniform, "
+          "sorted,\n"
+          "                      reversed, perturbed, organ-pipe, few-unique, "
+          "zipf,\n"
+          "                      full-range ou all (défaut : uniform)\n"
+          "  --seed N            graine des données (défaut : nouvelle graine, "
+          "reportée\n"
+          "                      dans la colonne seed)\n"
+          "  --input FICHIER     suite sort : trie ce tableau (.dsa projeté en "
+          "mémoire,\n"
+          "                      sinon CSV du type --type) au lieu de "
+          "données générées ;\n"
+          "                      suite external : trie ce .dsa\n"
+          "  --memory-budget N   suite external : mémoire du tri externe en "
+          "Mio\n"
+          "                      (défaut : 256)\n"
+          "  --temp-dir DIR      suite external : fichiers temporaires "
+          "(défaut : .)\n"
+          "  --quadratic-limit N taille maximale des tris O(n²) (défaut : "
+          "20000)\n"
+          "  --threads N         threads du tri parallèle (0 = auto)\n"
+          "  --list-alloc A      suite lists : nœuds pris dans une réserve "
+          "par liste\n"
+          "                      (pool, défaut) ou alloués un à un (malloc)\n"
+          "  --list-index I      suite lists : accès par position par "
+          "l'index\n"
+          "                      (on, défaut) ou par parcours (off)\n"
+          "  --format F          csv ou json (défaut : csv)\n"
+          "  --output FICHIER    fichier de sortie (défaut : sortie "
+          "standard)\n",
+          program);
+}
+
+static bool parse_sizes(const char *text, BenchConfig *config) {
+  config->num_sizes = 0;
+  const char *p = text;
+  while (*p) {
+    char *end;
+    unsigned long long value = strtoull(p, &end, 10);
+    if (end == p || value == 0 || config->num_sizes >= BENCH_MAX_SIZES)
+      return false;
+    config->sizes[config->num_sizes++] = (size_t)value;
+    if (*end == ',')
+      end++;
+    else if (*end != '\0')
+      return false;
+    p = end;
+  }
+  return config->num_sizes > 0;
+}
+
+static bool parse_type(const char *text, BenchConfig *config) {
+  memset(config->types, 0, sizeof(config->types));
+  if (strcmp(text, "all") == 0) {
+    for (int t = 0; t < DSA_DATA_TYPE_COUNT; t++)
+      config->types[t] = true;
+    return true;
+  }
+  for (int t = 0; t < DSA_DATA_TYPE_COUNT; t++) {
+    if (strcmp(text, TYPE_NAMES[t]) == 0) {
+      config->types[t] = true;
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool parse_distributions(const char *text, BenchConfig *config) {
+  memset(config->distributions, 0, sizeof(config->distributions));
+  if (strcmp(text, "all") == 0) {
+    for (int d = 0; d < DSA_ARRAY_DISTRIBUTION_COUNT; d++)
+      config->distributions[d] = true;
+    return true;
+  }
+
+  char name[32];
+  const char *p = text;
+  while (*p) {
+    size_t len = strcspn(p, ",");
+    if (len == 0 || len >= sizeof(name))
+      return false;
+    memcpy(name, p, len);
+    name[len] = '\0';
+    int d = dsa_array_distribution_from_name(name);
+    if (d < 0)
+      return false;
+    config->distributions[d] = true;
+    p += len;
+    if (*p == ',')
+      p++;
+  }
+  return true;
+}
+
+static int find_suite(const char *name) {
+  for (size_t i = 0; i < SUITE_COUNT; i++) {
+    if (strcmp(name, SUITES[i].name) == 0)
+      return (int)i;
+  }
+  return -1;
+}
+
+int main(int argc, char **argv) {
+  BenchConfig config = {0};
+  config.sizes[0] = 1000;
+  config.sizes[1] = 10000;
+  config.sizes[2] = 100000;
+  config.num_sizes = 3;
+  config.repetitions = 5;
+  config.types[DSA_TYPE_INT] = true;
+  config.distributions[DSA_DIST_UNIFORM] = true;
+  config.distribution = DSA_DIST_UNIFORM;
+  config.seed = dsa_prng_fresh_seed();
+  config.quadratic_limit = 20000;
+  config.format = BENCH_FORMAT_CSV;
+  config.out = stdout;
+
+  bool selected[SUITE_COUNT] = {false};
+  bool any_selected = false;
+  const char *output_path = NULL;
+
+  for (int i = 1; i < argc; i++) {
+    const char *arg = argv[i];
+    const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+    bool ok = true;
+
+    if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0) {
+      print_usage(argv[0]);
+      return 0;
+    } else if (!value) {
+      ok = false;
+    } else if (strcmp(arg, "--suite") == 0) {
+      if (strcmp(value, "all") == 0) {
+        for (size_t s = 0; s < SUITE_COUNT; s++)
+          selected[s] = true;
+      } else {
+        int s = find_suite(value);
+        ok = s >= 0;
+        if (ok)
+          selected[s] = true;
+      }
+      any_selected = true;
+    } else if (strcmp(arg, "--sizes") == 0) {
+      ok = parse_sizes(value, &config);
+    } else if (strcmp(arg, "--reps") == 0) {
+      config.repetitions = atoi(value);
+      ok = config.repetitions > 0;
+    } else if (strcmp(arg, "--type") == 0) {
+      ok = parse_type(value, &config);
+    } else if (strcmp(arg, "--dist") == 0) {
+      ok = parse_distributions(value, &config);
+    } else if (strcmp(arg, "--seed") == 0) {
+      char *end;
+      config.seed = strtoull(value, &end, 10);
+      ok = end != value && *end == '\0';
+    } else if (strcmp(arg, "--input") == 0) {
+      config.input = value;
+    } else if (strcmp(arg, "--memory-budget") == 0) {
+      char *end;
+      unsigned long long mib = strtoull(value, &end, 10);
+      ok = end != value && *end == '\0' && mib > 0;
+      config.memory_budget = (size_t)mib << 20;
+    } else if (strcmp(arg, "--temp-dir") == 0) {
+      config.temp_dir = value;
+    } else if (strcmp(arg, "--quadratic-limit") == 0) {
+      config.quadratic_limit = (size_t)strtoull(value, NULL, 10);
+    } else if (strcmp(arg, "--threads") == 0) {
+      dsa_sort_set_thread_count(atoi(value));
+    } else if (strcmp(arg, "--list-alloc") == 0) {
+      ok = strcmp(value, "pool") == 0 || strcmp(value, "malloc") == 0;
+      dsa_list_set_node_pool(strcmp(value, "malloc") != 0);
+    } else if (strcmp(arg, "--list-index") == 0) {
+      ok = strcmp(value, "on") == 0 || strcmp(value, "off") == 0;
+      dsa_list_set_position_index(strcmp(value, "off") != 0);
+    } else if (strcmp(arg, "--format") == 0) {
+      if (strcmp(value, "csv") == 0)
+        config.format = BENCH_FORMAT_CSV;
+      else if (strcmp(value, "json") == 0)
+        config.format = BENCH_FORMAT_JSON;
+      else
+        ok = false;
+    } else if (strcmp(arg, "--output") == 0) {
+      output_path = value;
+    } else {
+      ok = false;
+    }
+
+    if (!ok) {
+      fprintf(stderr, "Option invalide : %s%s%s\n", arg, value ? " " : "",
+              value ? value : "");
+      print_usage(argv[0]);
+      return 2;
+    }
+    i++; // Valeur consommée
+  }
+
+  if (!any_selected) {
+    for (size_t s = 0; s < SUITE_COUNT; s++)
+      selected[s] = true;
+  }
+
+  if (output_path) {
+    config.out = fopen(output_path, "w");
+    if (!config.out) {
+      perror(output_path);
+      return 1;
+    }
+  }
+
+  if (config.format == BENCH_FORMAT_JSON)
+    fprintf(config.out, "[\n");
+  else
+    fprintf(config.out, "suite,case,type,distribution,seed,size,repetitions,"
+                        "min_ns,median_ns,p99_ns,max_ns,mean_ns,ci_low_ns,"
+                        "ci_high_ns\n");
+
+  for (size_t s = 0; s < SUITE_COUNT; s++) {
+    if (selected[s])
+      SUITES[s].run(&config);
+  }
+
+  if (config.format == BENCH_FORMAT_JSON)
+    fprintf(config.out, "\n]\n");
+
+  if (config.out != stdout)
+    fclose(config.out);
+  return config.failures ? 1 : 0;
+}
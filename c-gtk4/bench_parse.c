@@ -0,0 +1,118 @@
+#include "array_format.h"
+#include "array_generators.h"
+#include "array_parse.h"
+#include "bench.h"
+#include "timing.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- Suite "parse" : lecture d'un tableau saisi en texte ---
+//
+// Le tableau généré est mis en texte (valeurs séparées par ", "), puis relu
+// par dsa_array_parse_text ("parse") et, pour comparaison, par une boucle
+// strtol / strtof ("strtol", "strtof"). Le résultat de dsa_array_parse_text est
+// vérifié : mêmes valeurs que la boucle de la bibliothèque C pour les
+// nombres, que le tableau d'origine pour les caractères et les chaînes.
+// Une différence est signalée et fait échouer ds_bench.
+
+// Relecture par la bibliothèque C, sans validation ni allocation ; retourne
+// le nombre de valeurs lues
+static size_t parse_libc(const char *text, DsaDataType type, void *out) {
+  const char *p = text;
+  size_t i = 0;
+  while (*p) {
+    char *end;
+    if (type == DSA_TYPE_INT)
+      ((int *)out)[i] = (int)strtol(p, &end, 10);
+    else
+      ((float *)out)[i] = strtof(p, &end);
+    if (end == p) { // Séparateur
+      p++;
+      continue;
+    }
+    i++;
+    p = end;
+  }
+  return i;
+}
+
+// Valeurs identiques, élément par élément
+static bool same_values(const DsaArrayData *parsed, const void *expected,
+                        size_t size) {
+  if (parsed->size != size)
+    return false;
+  if (parsed->type != DSA_TYPE_STRING)
+    return memcmp(parsed->array, expected,
+                  size * dsa_array_element_size(parsed->type)) == 0;
+  for (size_t i = 0; i < size; i++) {
+    if (strcmp(((char **)parsed->array)[i], ((char *const *)expected)[i]))
+      return false;
+  }
+  return true;
+}
+
+static void bench_parse_array(BenchConfig *config, const DsaArrayData *base,
+                              uint64_t *samples) {
+  DsaTextBuffer text = {0};
+  if (!dsa_array_format_append(&text, base, 0, base->size, 0))
+    return;
+
+  DsaArrayData parsed = {0};
+  DsaArrayParseStatus status = DSA_ARRAY_PARSE_OK;
+  for (int r = 0; r < config->repetitions; r++) {
+    uint64_t start = dsa_timing_now_ns();
+    status = dsa_array_parse_text(text.text, text.length, base->type, 0,
+                                  &parsed, NULL);
+    samples[r] = dsa_timing_now_ns() - start;
+  }
+  bench_report(config, "parse", "parse", base->type, base->size, samples,
+               config->repetitions);
+
+  bool ok = status == DSA_ARRAY_PARSE_OK;
+  if (base->type == DSA_TYPE_INT || base->type == DSA_TYPE_FLOAT) {
+    void *out = malloc(base->size * dsa_array_element_size(base->type) + 1);
+    if (out) {
+      size_t count = 0;
+      for (int r = 0; r < config->repetitions; r++) {
+        uint64_t start = dsa_timing_now_ns();
+        count = parse_libc(text.text, base->type, out);
+        samples[r] = dsa_timing_now_ns() - start;
+      }
+      bench_report(config, "parse",
+                   base->type == DSA_TYPE_INT ? "strtol" : "strtof", base->type,
+                   base->size, samples, config->repetitions);
+      ok = ok && count == base->size && same_values(&parsed, out, count);
+      free(out);
+    }
+  } else {
+    ok = ok && same_values(&parsed, base->array, base->size);
+  }
+  if (!ok) {
+    fprintf(stderr, "parse %s %zu : valeurs relues différentes\n",
+            bench_type_name(base->type), base->size);
+    config->failures++;
+  }
+  dsa_free_array_data(&parsed);
+  dsa_text_buffer_free(&text);
+}
+
+void bench_suite_parse(BenchConfig *config) {
+  uint64_t *samples = malloc(config->repetitions * sizeof(uint64_t));
+  if (!samples)
+    return;
+
+  for (int t = 0; t < DSA_DATA_TYPE_COUNT; t++) {
+    if (!config->types[t])
+      continue;
+    for (int s = 0; s < config->num_sizes; s++) {
+      DsaArrayData base = {0};
+      DsaArrayGenOptions options =
+          dsa_array_gen_options(config->distribution, config->seed);
+      if (dsa_generate_array(&base, config->sizes[s], (DsaDataType)t, &options))
+        bench_parse_array(config, &base, samples);
+      dsa_free_array_data(&base);
+    }
+  }
+  free(samples);
+}
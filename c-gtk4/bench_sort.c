@@ -0,0 +1,381 @@
+#include "array_generators.h"
+#include "array_io.h"
+#include "bench.h"
+#include "prng.h"
+#include "sort_algorithms.h"
+#include "timing.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- Suite "sort" : dsa_sort_array() pour chaque algorithme ---
+//
+// Le résultat de la dernière répétition est vérifié : tableau trié et mêmes
+// valeurs que l'entrée (comparées au tableau trié par qsort) ; pour les
+// enregistrements et le tri indirect, indices formant une permutation, clé
+// toujours associée à son indice et éléments égaux dans l'ordre d'origine.
+// Une erreur est signalée et fait échouer ds_bench. Avec le type float, les
+// tris sont aussi vérifiés sur des réels particuliers (NaN, ±0, infinis),
+// sans mesure.
+
+static const char *SORT_CASES[DSA_SORT_ALGO_COUNT] = {
+    "bubble", "insertion", "shell",    "quick",
+    "radix",  "counting",  "parallel", "merge"};
+
+static bool is_quadratic(DsaSortAlgo algo) {
+  return algo == DSA_ALGO_BUBBLE || algo == DSA_ALGO_INSERTION;
+}
+
+// --- Vérification des résultats ---
+
+// Réels rangés par leur représentation : ordre total (-0 avant +0, NaN aux
+// extrémités), qui distingue deux multiensembles de bits différents
+static uint32_t float_order_key(float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits & 0x80000000u ? ~bits : bits | 0x80000000u;
+}
+
+static int compare_int_values(const void *a, const void *b) {
+  int x = *(const int *)a, y = *(const int *)b;
+  return (x > y) - (x < y);
+}
+
+static int compare_float_values(const void *a, const void *b) {
+  uint32_t x = float_order_key(*(const float *)a);
+  uint32_t y = float_order_key(*(const float *)b);
+  return (x > y) - (x < y);
+}
+
+static int compare_char_values(const void *a, const void *b) {
+  char x = *(const char *)a, y = *(const char *)b;
+  return (x > y) - (x < y);
+}
+
+static int compare_string_values(const void *a, const void *b) {
+  return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+static int (
+    *const VALUE_ORDER[DSA_DATA_TYPE_COUNT])(const void *, const void *) = {
+    [DSA_TYPE_INT] = compare_int_values,
+    [DSA_TYPE_FLOAT] = compare_float_values,
+    [DSA_TYPE_CHAR] = compare_char_values,
+    [DSA_TYPE_STRING] = compare_string_values};
+
+// Copie des `size` valeurs triée par qsort ; NULL si la mémoire manque
+static void *sorted_values(DsaDataType type, const void *values, size_t size) {
+  size_t element = dsa_array_element_size(type);
+  void *sorted = malloc(size * element + 1);
+  if (sorted) {
+    memcpy(sorted, values, size * element);
+    qsort(sorted, size, element, VALUE_ORDER[type]);
+  }
+  return sorted;
+}
+
+static bool has_nan(DsaDataType type, const void *values, size_t size) {
+  for (size_t i = 0; type == DSA_TYPE_FLOAT && i < size; i++) {
+    if (isnan(((const float *)values)[i]))
+      return true;
+  }
+  return false;
+}
+
+// Comparaisons des tris (LESS_NUM, LESS_STR) : -0 et +0 sont égaux
+static bool value_less(DsaDataType type, const void *values, size_t i,
+                       size_t j) {
+  switch (type) {
+  case DSA_TYPE_INT:
+    return ((const int *)values)[i] < ((const int *)values)[j];
+  case DSA_TYPE_FLOAT:
+    return ((const float *)values)[i] < ((const float *)values)[j];
+  case DSA_TYPE_CHAR:
+    return ((const char *)values)[i] < ((const char *)values)[j];
+  case DSA_TYPE_STRING:
+    return strcmp(((char *const *)values)[i], ((char *const *)values)[j]) < 0;
+  }
+  return false;
+}
+
+// Valeurs en ordre croissant ; avec `order`, les valeurs égales gardent
+// l'ordre croissant de leurs indices d'origine (tris stables). Sans objet
+// en présence de NaN, que les tris ne savent pas ranger.
+static bool is_sorted(DsaDataType type, const void *values, size_t size,
+                      const size_t *order) {
+  if (has_nan(type, values, size))
+    return true;
+  for (size_t i = 1; i < size; i++) {
+    if (value_less(type, values, i, i - 1))
+      return false;
+    if (order && !value_less(type, values, i - 1, i) && order[i] < order[i - 1])
+      return false;
+  }
+  return true;
+}
+
+// Même multiensemble de valeurs que `reference` (déjà trié par qsort)
+static bool same_values(DsaDataType type, const void *values,
+                        const void *reference, size_t size) {
+  void *sorted = sorted_values(type, values, size);
+  if (!sorted)
+    return true; // Mémoire insuffisante : vérification abandonnée
+  size_t element = dsa_array_element_size(type);
+  bool same = true;
+  for (size_t i = 0; same && i < size; i++)
+    same = VALUE_ORDER[type]((char *)sorted + i * element,
+                             (const char *)reference + i * element) == 0;
+  free(sorted);
+  return same;
+}
+
+// `order` est une permutation de [0, size) et keys[i] a les mêmes octets que
+// l'élément order[i] de `base`
+static bool is_permutation(const DsaArrayData *base, const size_t *order,
+                           const void *keys) {
+  bool *seen = calloc(base->size + 1, sizeof(bool));
+  if (!seen)
+    return true; // Mémoire insuffisante : vérification abandonnée
+  size_t element = dsa_array_element_size(base->type);
+  bool ok = true;
+  for (size_t i = 0; ok && i < base->size; i++) {
+    size_t from = order[i];
+    ok = from < base->size && !seen[from] &&
+         memcmp((const char *)keys + i * element,
+                (const char *)base->array + from * element, element) == 0;
+    if (ok)
+      seen[from] = true;
+  }
+  free(seen);
+  return ok;
+}
+
+static void report_failure(BenchConfig *config, const char *name,
+                           const DsaArrayData *base) {
+  fprintf(stderr, "sort %s %s %zu : résultat incorrect\n", name,
+          bench_type_name(base->type), base->size);
+  config->failures++;
+}
+
+// Tous les algorithmes sur `base`, recopié avant chaque répétition
+static void bench_array(BenchConfig *config, const DsaArrayData *base,
+                        uint64_t *samples) {
+  size_t bytes = base->size * dsa_array_element_size(base->type);
+
+  // Copie superficielle : les chaînes restent la propriété de `base`
+  DsaArrayData copy = *base;
+  copy.array = malloc(bytes ? bytes : 1);
+  void *reference = sorted_values(base->type, base->array, base->size);
+  if (!copy.array || !reference) {
+    free(reference);
+    free(copy.array);
+    return;
+  }
+
+  for (int a = 0; a < DSA_SORT_ALGO_COUNT; a++) {
+    if (is_quadratic((DsaSortAlgo)a) && base->size > config->quadratic_limit)
+      continue;
+
+    for (int r = 0; r < config->repetitions; r++) {
+      memcpy(copy.array, base->array, bytes);
+      samples[r] = dsa_sort_array_timed(&copy, (DsaSortAlgo)a).ns;
+    }
+    bench_report(config, "sort", SORT_CASES[a], base->type, base->size,
+                 samples, config->repetitions);
+
+    if (!is_sorted(copy.type, copy.array, copy.size, NULL) ||
+        !same_values(copy.type, copy.array, reference, copy.size))
+      report_failure(config, SORT_CASES[a], base);
+  }
+  free(reference);
+  free(copy.array);
+}
+
+// Enregistrements : les clés de `base` avec leur indice d'origine en données
+// associées, triés par fusion puis par radix ("record_*"), et tri indirect
+// seul ("argsort_*")
+static void bench_records(BenchConfig *config, const DsaArrayData *base,
+                          uint64_t *samples) {
+  static const struct {
+    DsaSortAlgo algo;
+    const char *record;
+    const char *argsort;
+  } CASES[] = {{DSA_ALGO_MERGE, "record_merge", "argsort_merge"},
+               {DSA_ALGO_RADIX, "record_radix", "argsort_radix"}};
+
+  size_t bytes = base->size * dsa_array_element_size(base->type);
+  size_t count = base->size ? base->size : 1;
+  DsaArrayData copy = *base;
+  copy.array = malloc(bytes ? bytes : 1);
+  copy.payload = malloc(count * sizeof(size_t));
+  copy.payload_size = sizeof(size_t);
+  size_t *order = malloc(count * sizeof(size_t));
+  void *keys = malloc(bytes ? bytes : 1);
+  if (copy.array && copy.payload && order && keys) {
+    for (size_t c = 0; c < sizeof(CASES) / sizeof(CASES[0]); c++) {
+      for (int r = 0; r < config->repetitions; r++) {
+        memcpy(copy.array, base->array, bytes);
+        for (size_t i = 0; i < base->size; i++)
+          ((size_t *)copy.payload)[i] = i;
+        samples[r] = dsa_sort_array_timed(&copy, CASES[c].algo).ns;
+      }
+      bench_report(config, "sort", CASES[c].record, base->type, base->size,
+                   samples, config->repetitions);
+      if (!is_permutation(base, copy.payload, copy.array) ||
+          !is_sorted(copy.type, copy.array, copy.size, copy.payload))
+        report_failure(config, CASES[c].record, base);
+
+      for (int r = 0; r < config->repetitions; r++) {
+        uint64_t start = dsa_timing_now_ns();
+        dsa_sort_argsort(base, CASES[c].algo, order);
+        samples[r] = dsa_timing_now_ns() - start;
+      }
+      bench_report(config, "sort", CASES[c].argsort, base->type, base->size,
+                   samples, config->repetitions);
+
+      // Clés dans l'ordre indiqué
+      size_t element = dsa_array_element_size(base->type);
+      bool valid = true;
+      for (size_t i = 0; valid && i < base->size; i++) {
+        valid = order[i] < base->size;
+        if (valid)
+          memcpy((char *)keys + i * element,
+                 (const char *)base->array + order[i] * element, element);
+      }
+      if (!valid || !is_permutation(base, order, keys) ||
+          !is_sorted(base->type, keys, base->size, order))
+        report_failure(config, CASES[c].argsort, base);
+    }
+  }
+  free(keys);
+  free(order);
+  free(copy.payload);
+  free(copy.array);
+}
+
+// Réels particuliers mêlés à des petits entiers (nombreux doublons), avec
+// ou sans NaN, à des tailles qui passent par les réseaux de tri, les tris
+// récursifs et le tri parallèle : aucune valeur ne doit être perdue ni
+// dupliquée
+static void check_special_floats(BenchConfig *config) {
+  static const float SPECIALS[] = {NAN, -0.0f, 0.0f, INFINITY, -INFINITY};
+  static const size_t SIZES[] = {20, 64, 1000, 150000};
+  DsaPrng rng;
+  dsa_prng_seed(&rng, config->seed);
+
+  for (size_t s = 0; s < sizeof(SIZES) / sizeof(SIZES[0]); s++) {
+    for (int with_nan = 0; with_nan < 2; with_nan++) {
+      size_t size = SIZES[s];
+      DsaArrayData base = {.size = size, .type = DSA_TYPE_FLOAT};
+      DsaArrayData copy = base;
+      base.array = malloc(size * sizeof(float));
+      copy.array = malloc(size * sizeof(float));
+      float *values = base.array;
+      for (size_t i = 0; values && i < size; i++) {
+        uint32_t pick = dsa_prng_bounded(&rng, 8);
+        values[i] = pick < 5 ? SPECIALS[pick]
+                             : (float)((int)dsa_prng_bounded(&rng, 21) - 10);
+        if (!with_nan && isnan(values[i]))
+          values[i] = -0.0f;
+      }
+      void *reference =
+          values ? sorted_values(DSA_TYPE_FLOAT, values, size) : NULL;
+
+      for (int a = 0; reference && copy.array && a < DSA_SORT_ALGO_COUNT; a++) {
+        if (is_quadratic((DsaSortAlgo)a) && size > config->quadratic_limit)
+          continue;
+        memcpy(copy.array, base.array, size * sizeof(float));
+        dsa_sort_array(&copy, (DsaSortAlgo)a);
+        if (is_sorted(DSA_TYPE_FLOAT, copy.array, size, NULL) &&
+            same_values(DSA_TYPE_FLOAT, copy.array, reference, size))
+          continue;
+        char name[64];
+        snprintf(name, sizeof(name), "%s_special", SORT_CASES[a]);
+        report_failure(config, name, &base);
+      }
+      free(reference);
+      free(copy.array);
+      free(base.array);
+    }
+  }
+}
+
+// Tous les algorithmes, types et tailles pour config->distribution
+static void bench_distribution(BenchConfig *config, uint64_t *samples) {
+  for (int t = 0; t < DSA_DATA_TYPE_COUNT; t++) {
+    if (!config->types[t])
+      continue;
+
+    for (int s = 0; s < config->num_sizes; s++) {
+      DsaArrayData base = {0};
+      DsaArrayGenOptions options =
+          dsa_array_gen_options(config->distribution, config->seed);
+      if (dsa_generate_array(&base, config->sizes[s], (DsaDataType)t,
+                             &options)) {
+        bench_array(config, &base, samples);
+        bench_records(config, &base, samples);
+      }
+      dsa_free_array_data(&base);
+    }
+  }
+}
+
+// Tableau lu dans config->input : un .dsa est projeté en mémoire (type et
+// graine de son en-tête), un CSV est lu avec le premier type sélectionné
+static void bench_input(BenchConfig *config, uint64_t *samples) {
+  DsaArrayIoStatus status;
+  if (dsa_array_file_is_binary(config->input)) {
+    DsaMappedArray mapped;
+    status = dsa_array_map_file(config->input, 0, &mapped);
+    if (status == DSA_ARRAY_IO_OK) {
+      config->seed = mapped.info.has_seed ? mapped.info.seed : 0;
+      bench_array(config, &mapped.data, samples);
+      dsa_array_unmap(&mapped);
+    }
+  } else {
+    DsaDataType type = DSA_TYPE_INT;
+    for (int t = DSA_DATA_TYPE_COUNT - 1; t >= 0; t--) {
+      if (config->types[t])
+        type = (DsaDataType)t;
+    }
+    DsaArrayData base = {0};
+    size_t line = 0;
+    status = dsa_array_import_csv(config->input, type, &base, &line);
+    if (status == DSA_ARRAY_IO_OK) {
+      config->seed = 0;
+      bench_array(config, &base, samples);
+    } else if (status == DSA_ARRAY_IO_ERR_PARSE) {
+      fprintf(stderr, "%s:%zu : %s\n", config->input, line,
+              dsa_array_io_status_message(status));
+      status = DSA_ARRAY_IO_OK; // Déjà signalé
+    }
+    dsa_free_array_data(&base);
+  }
+  if (status != DSA_ARRAY_IO_OK)
+    fprintf(stderr, "%s : %s\n", config->input,
+            dsa_array_io_status_message(status));
+}
+
+void bench_suite_sort(BenchConfig *config) {
+  uint64_t *samples = malloc(config->repetitions * sizeof(uint64_t));
+  if (!samples)
+    return;
+
+  if (config->input) {
+    bench_input(config, samples);
+    free(samples);
+    return;
+  }
+
+  for (int d = 0; d < DSA_ARRAY_DISTRIBUTION_COUNT; d++) {
+    if (!config->distributions[d])
+      continue;
+    config->distribution = (DsaArrayDistribution)d;
+    bench_distribution(config, samples);
+  }
+  config->distribution = DSA_DIST_UNIFORM;
+  if (config->types[DSA_TYPE_FLOAT])
+    check_special_floats(config);
+  free(samples);
+}
@@ -0,0 +1,67 @@
+#include "bench.h"
+#include "prng.h"
+#include "timing.h"
+#include "tree_algorithms.h"
+#include <stdlib.h>
+
+// --- Suite "trees" : arbre binaire de recherche (valeurs entières) ---
+
+void bench_suite_trees(BenchConfig *config) {
+  uint64_t *samples = malloc(config->repetitions * sizeof(uint64_t));
+  if (!samples)
+    return;
+
+  DsaPrng rng;
+  dsa_prng_seed(&rng, config->seed);
+  for (int s = 0; s < config->num_sizes; s++) {
+    size_t size = config->sizes[s];
+    int *values = malloc(size * sizeof(int));
+    if (!values)
+      continue;
+    for (size_t i = 0; i < size; i++)
+      values[i] = (int)(dsa_prng_next32(&rng) >> 1); // comme rand() : >= 0
+
+    // Construction complète de l'arbre
+    DsaBinaryNode *root = NULL;
+    for (int r = 0; r < config->repetitions; r++) {
+      dsa_free_binary_tree(root);
+      root = NULL;
+      DsaTimingMark start = dsa_timing_mark();
+      for (size_t i = 0; i < size; i++)
+        root = dsa_bst_insert(root, values[i]);
+      samples[r] = dsa_timing_since(start).ns;
+    }
+    bench_report(config, "trees", "bst_insert", DSA_TYPE_INT, size, samples,
+                 config->repetitions);
+
+    // Recherche de chaque valeur insérée
+    for (int r = 0; r < config->repetitions; r++) {
+      size_t found = 0;
+      DsaTimingMark start = dsa_timing_mark();
+      for (size_t i = 0; i < size; i++)
+        found += dsa_bst_search(root, values[i]) != NULL;
+      samples[r] = dsa_timing_since(start).ns;
+      if (found != size) {
+        fprintf(stderr, "bst_search : %zu valeurs introuvables\n",
+                size - found);
+        config->failures++;
+      }
+    }
+    bench_report(config, "trees", "bst_search", DSA_TYPE_INT, size, samples,
+                 config->repetitions);
+
+    // Parcours infixe
+    for (int r = 0; r < config->repetitions; r++) {
+      DsaTimingMark start = dsa_timing_mark();
+      DsaTraversalResult res = dsa_bst_traverse_inorder(root);
+      samples[r] = dsa_timing_since(start).ns;
+      dsa_free_traversal_result(&res);
+    }
+    bench_report(config, "trees", "bst_inorder", DSA_TYPE_INT, size,
+                 samples, config->repetitions);
+
+    dsa_free_binary_tree(root);
+    free(values);
+  }
+  free(samples);
+}
@@ -1,9 +1,23 @@
+#ifdef __linux__
+#define _GNU_SOURCE // pthread_setaffinity_np, CPU_SET
+#endif
+
 #include "curve_window.h"
+#include "array_generators.h"
 #include "sort_algorithms.h"
+#include "sort_network.h"
 #include <gtk/gtk.h>
 #include <math.h>
+#include <stdatomic.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -11,55 +25,303 @@
 
 // --- Data for Plotting ---
 #define NUM_POINTS 10
-int TEST_SIZES[NUM_POINTS];
-double BENCH_RESULTS[4][NUM_POINTS]; // 4 algos
-char CHART_TITLE[128] = "Comparaison des Algorithmes de Tri (Type: Entier)";
+// One series per algorithm, plus QuickSort without the SIMD sorting networks
+#define SERIES_QUICK_SCALAR DSA_SORT_ALGO_COUNT
+#define NUM_SERIES (DSA_SORT_ALGO_COUNT + 1)
+
+const char *ALGO_NAMES[] = {"Tri à bulle", "Tri par insertion",
+                            "Tri Shell",   "Tri rapide",
+                            "Tri radix",   "Tri par comptage",
+                            "Tri parallèle", "Tri fusion",
+                            "Tri rapide (scalaire)"};
+
+// Every cell is measured on each input distribution (array_generators.h);
+// the chart shows one distribution at a time
+#define NUM_DISTRIBUTIONS DSA_ARRAY_DISTRIBUTION_COUNT
+
+// --- Measurement protocol ---
+// One untimed warm-up run, then repeated trials on fresh copies of the same
+// input until both the minimum count and the time budget are reached.
+#define CURVE_WARMUP_RUNS 1
+#define CURVE_MIN_TRIALS 5
+#define CURVE_MAX_TRIALS 31
+#define CURVE_CELL_BUDGET_NS 500000000ULL
+
+// Median and 95% confidence interval of one cell, in seconds
+typedef struct {
+  double median;
+  double ci_low;
+  double ci_high;
+  int trials;
+} CurveStat;
+
+// Per-window state, shared with the benchmark workers. It is reference
+// counted: one reference for the window, one per queued cell and one per
+// pending result, so late workers never touch freed memory.
+typedef struct {
+  gint ref_count;
+  int sizes[NUM_POINTS];
+  // Results are only written on the main thread (see on_cell_done)
+  CurveStat results[NUM_DISTRIBUTIONS][NUM_SERIES][NUM_POINTS];
+  bool measured[NUM_DISTRIBUTIONS][NUM_SERIES][NUM_POINTS];
+  int cells_done;
+  int distribution; // distribution currently plotted
+  DsaSortControl controls[NUM_DISTRIBUTIONS][NUM_SERIES][NUM_POINTS];
+  atomic_bool closed;
+  uint64_t seed;
+  atomic_int next_cpu;
+  GThreadPool *pool;
+  GtkWidget *area; // NULL once the window is destroyed
+  char title[160];
+} CurveState;
+
+typedef struct {
+  CurveState *state;
+  int distribution;
+  int series;
+  int point;
+  CurveStat stat;
+} CurveCell;
+
+static CurveState *curve_state_ref(CurveState *state) {
+  g_atomic_int_inc(&state->ref_count);
+  return state;
+}
+
+static void curve_state_unref(CurveState *state) {
+  if (g_atomic_int_dec_and_test(&state->ref_count))
+    g_free(state);
+}
+
+static void update_title(CurveState *state) {
+  int total = NUM_DISTRIBUTIONS * NUM_SERIES * NUM_POINTS;
+  int n = snprintf(state->title, sizeof(state->title),
+                   "Comparaison des Algorithmes de Tri (Entier, %s, graine "
+                   "%llu)",
+                   dsa_array_distribution_label(state->distribution),
+                   (unsigned long long)state->seed);
+  if (state->cells_done < total && n > 0 && (size_t)n < sizeof(state->title))
+    snprintf(state->title + n, sizeof(state->title) - n, " - %d/%d",
+             state->cells_done, total);
+}
+
+// --- Core pinning ---
+// Each pool thread is pinned to its own core so that cells do not migrate
+// mid-measurement. The parallel sort spawns its own threads, which inherit
+// the affinity of the caller, so its cells run unpinned.
+#ifdef __linux__
+static _Thread_local int worker_cpu = -1;
+static _Thread_local cpu_set_t worker_cpus;
+
+static void pin_worker(CurveState *state, bool pinned) {
+  pthread_t self = pthread_self();
+  if (worker_cpu < 0) {
+    if (pthread_getaffinity_np(self, sizeof(worker_cpus), &worker_cpus) != 0)
+      return;
+    int count = CPU_COUNT(&worker_cpus);
+    if (count == 0)
+      return;
+    int slot = atomic_fetch_add(&state->next_cpu, 1) % count;
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+      if (CPU_ISSET(cpu, &worker_cpus) && slot-- == 0) {
+        worker_cpu = cpu;
+        break;
+      }
+    }
+  }
 
-const char *ALGO_NAMES[] = {"Tri à bulle", "Tri par insertion", "Tri Shell",
-                            "Tri rapide"};
+  if (!pinned) {
+    pthread_setaffinity_np(self, sizeof(worker_cpus), &worker_cpus);
+    return;
+  }
+  cpu_set_t one;
+  CPU_ZERO(&one);
+  CPU_SET(worker_cpu, &one);
+  pthread_setaffinity_np(self, sizeof(one), &one);
+}
+#else
+static void pin_worker(CurveState *state, bool pinned) {
+  (void)state;
+  (void)pinned;
+}
+#endif
 
 // --- Benchmarking ---
-#define SLOW_ALGO_THRESHOLD 20000
+// Runs on the main thread: stores one result and redraws the chart.
+static gboolean on_cell_done(gpointer data) {
+  CurveCell *cell = data;
+  CurveState *state = cell->state;
+
+  state->results[cell->distribution][cell->series][cell->point] = cell->stat;
+  state->measured[cell->distribution][cell->series][cell->point] = true;
+  state->cells_done++;
+  update_title(state);
+  if (state->area)
+    gtk_widget_queue_draw(state->area);
+
+  curve_state_unref(state);
+  g_free(cell);
+  return G_SOURCE_REMOVE;
+}
 
-static void run_benchmarks(int max_size) {
-  if (max_size < NUM_POINTS)
-    max_size = NUM_POINTS;
+// One timed run of the cell's algorithm on a fresh copy of `input`
+static bool run_trial(CurveCell *cell, const int *input, int *work, int size,
+                      uint64_t *ns) {
+  DsaSortControl *control =
+      &cell->state->controls[cell->distribution][cell->series][cell->point];
+  memcpy(work, input, size * sizeof(int));
+  DsaArrayData data = {
+      .array = work, .size = (size_t)size, .type = DSA_TYPE_INT};
+
+  DsaTimingSample sample;
+  bool done;
+  if (cell->series == SERIES_QUICK_SCALAR) {
+    dsa_sort_network_set_enabled(false);
+    done = dsa_sort_array_controlled(&data, DSA_ALGO_QUICK, control, &sample);
+    dsa_sort_network_set_enabled(true);
+  } else {
+    done = dsa_sort_array_controlled(&data, (DsaSortAlgo)cell->series, control,
+                                     &sample);
+  }
+  *ns = sample.ns;
+  return done;
+}
 
-  for (int i = 0; i < NUM_POINTS; i++) {
-    TEST_SIZES[i] = (max_size / NUM_POINTS) * (i + 1);
+// Runs on a pool thread: one isolated (distribution, series, size) cell.
+// Every series sorts the same input for a given distribution and size,
+// generated from the window seed.
+static void run_cell(gpointer data, gpointer user_data) {
+  (void)user_data;
+  CurveCell *cell = data;
+  CurveState *state = cell->state;
+
+  if (atomic_load(&state->closed)) {
+    curve_state_unref(state);
+    g_free(cell);
+    return;
   }
-  TEST_SIZES[NUM_POINTS - 1] = max_size;
 
-  for (int s = 0; s < NUM_POINTS; s++) {
-    int size = TEST_SIZES[s];
+  bool parallel = cell->series == DSA_ALGO_PARALLEL;
+  pin_worker(state, !parallel);
+
+  int size = state->sizes[cell->point];
+  DsaArrayData base = {0};
+  DsaArrayGenOptions options = dsa_array_gen_options(
+      (DsaArrayDistribution)cell->distribution,
+      state->seed + (uint64_t)(cell->distribution * NUM_POINTS + cell->point));
+  int *work = malloc(size * sizeof(int));
+  bool done = work && dsa_generate_array(&base, size, DSA_TYPE_INT, &options);
+  const int *input = base.array;
+
+  uint64_t samples[CURVE_MAX_TRIALS];
+  int trials = 0;
+  uint64_t spent = 0;
+  bool single = false;
+
+  // Warm-up: caches, page faults and branch predictors. A cell whose single
+  // run already exceeds the budget keeps it as its only measurement.
+  for (int w = 0; w < CURVE_WARMUP_RUNS && done; w++) {
+    uint64_t ns = 0;
+    done = run_trial(cell, input, work, size, &ns);
+    if (done && ns > CURVE_CELL_BUDGET_NS) {
+      samples[trials++] = ns;
+      single = true;
+      break;
+    }
+  }
 
-    ArrayData base = {0};
-    generate_random_data(&base, size, TYPE_INT);
+  while (done && !single && trials < CURVE_MAX_TRIALS &&
+         (trials < CURVE_MIN_TRIALS || spent < CURVE_CELL_BUDGET_NS)) {
+    uint64_t ns = 0;
+    done = run_trial(cell, input, work, size, &ns);
+    if (done) {
+      samples[trials++] = ns;
+      spent += ns;
+    }
+  }
+  dsa_free_array_data(&base);
+  free(work);
 
-    for (int algo = 0; algo < 4; algo++) {
-      if (size > SLOW_ALGO_THRESHOLD && (algo == 0 || algo == 1)) {
-        BENCH_RESULTS[algo][s] = 0.0;
-        continue;
-      }
+  if (!done) {
+    curve_state_unref(state);
+    g_free(cell);
+    return;
+  }
 
-      ArrayData copy;
-      copy.size = size;
-      copy.type = TYPE_INT;
-      copy.array = malloc(size * sizeof(int));
-      memcpy(copy.array, base.array, size * sizeof(int));
+  DsaTimingStats stats = dsa_timing_stats(samples, (size_t)trials);
+  cell->stat.median = dsa_timing_ns_to_s(stats.median_ns);
+  cell->stat.ci_low = dsa_timing_ns_to_s(stats.ci_low_ns);
+  cell->stat.ci_high = dsa_timing_ns_to_s(stats.ci_high_ns);
+  cell->stat.trials = trials;
+  g_idle_add(on_cell_done, cell); // the reference travels with the cell
+}
 
-      double t = sort_array(&copy, (SortAlgo)algo);
-      BENCH_RESULTS[algo][s] = t;
+static bool is_quadratic(int series) {
+  return series == DSA_ALGO_BUBBLE || series == DSA_ALGO_INSERTION;
+}
 
-      free_array_data(&copy);
-    }
-    free_array_data(&base);
+static void queue_cell(CurveState *state, int distribution, int series,
+                       int point) {
+  CurveCell *cell = g_new0(CurveCell, 1);
+  cell->state = curve_state_ref(state);
+  cell->distribution = distribution;
+  cell->series = series;
+  cell->point = point;
+  g_thread_pool_push(state->pool, cell, NULL);
+}
+
+// Queues the whole sweep, fast series first so that the chart fills in
+// quickly; the O(N^2) series are measured last.
+static void start_benchmarks(CurveState *state, int max_size) {
+  if (max_size < NUM_POINTS)
+    max_size = NUM_POINTS;
+
+  for (int i = 0; i < NUM_POINTS; i++) {
+    state->sizes[i] = (max_size / NUM_POINTS) * (i + 1);
   }
+  state->sizes[NUM_POINTS - 1] = max_size;
+
+  for (int d = 0; d < NUM_DISTRIBUTIONS; d++)
+    for (int series = 0; series < NUM_SERIES; series++)
+      for (int s = 0; s < NUM_POINTS; s++)
+        dsa_sort_control_init(&state->controls[d][series][s]);
+
+  guint threads = g_get_num_processors();
+  state->pool = g_thread_pool_new(run_cell, NULL, (gint)threads, TRUE, NULL);
+
+  // The plotted distribution is measured first
+  for (int pass = 0; pass < 2; pass++)
+    for (int k = 0; k < NUM_DISTRIBUTIONS; k++) {
+      int d = (state->distribution + k) % NUM_DISTRIBUTIONS;
+      for (int s = 0; s < NUM_POINTS; s++)
+        for (int series = 0; series < NUM_SERIES; series++)
+          if (is_quadratic(series) == (pass == 1))
+            queue_cell(state, d, series, s);
+    }
+}
+
+// Window closed: running cells are cancelled, queued ones return at once and
+// the pool frees itself once they are drained.
+static void on_window_destroy(GtkWidget *window, gpointer user_data) {
+  (void)window;
+  CurveState *state = user_data;
+
+  atomic_store(&state->closed, true);
+  for (int d = 0; d < NUM_DISTRIBUTIONS; d++)
+    for (int series = 0; series < NUM_SERIES; series++)
+      for (int s = 0; s < NUM_POINTS; s++)
+        dsa_sort_control_cancel(&state->controls[d][series][s]);
+  state->area = NULL;
+  g_thread_pool_free(state->pool, FALSE, FALSE);
+  state->pool = NULL;
+  curve_state_unref(state);
 }
 
 // --- Modern Drawing ---
 static void on_draw(GtkDrawingArea *area, cairo_t *cr, int width, int height,
                     gpointer data) {
+  CurveState *state = data;
+
   // 1. White Background
   cairo_set_source_rgb(cr, 0.98, 0.98, 0.98);
   cairo_paint(cr);
@@ -79,16 +341,18 @@ static void on_draw(GtkDrawingArea *area, cairo_t *cr, int width, int height,
   cairo_set_source_rgb(cr, 0.2, 0.2, 0.2);
 
   cairo_text_extents_t title_extents;
-  cairo_text_extents(cr, CHART_TITLE, &title_extents);
+  cairo_text_extents(cr, state->title, &title_extents);
   cairo_move_to(cr, (width - title_extents.width) / 2, 30);
-  cairo_show_text(cr, CHART_TITLE);
+  cairo_show_text(cr, state->title);
 
-  // Find Max Time for scaling
+  // Find Max Time for scaling (top of the error bars)
+  bool(*measured)[NUM_POINTS] = state->measured[state->distribution];
+  CurveStat(*results)[NUM_POINTS] = state->results[state->distribution];
   double max_time = 0;
-  for (int a = 0; a < 4; a++) {
+  for (int a = 0; a < NUM_SERIES; a++) {
     for (int s = 0; s < NUM_POINTS; s++) {
-      if (BENCH_RESULTS[a][s] > max_time)
-        max_time = BENCH_RESULTS[a][s];
+      if (measured[a][s] && results[a][s].ci_high > max_time)
+        max_time = results[a][s].ci_high;
     }
   }
   if (max_time <= 0)
@@ -147,7 +411,7 @@ static void on_draw(GtkDrawingArea *area, cairo_t *cr, int width, int height,
   for (int i = 0; i < NUM_POINTS; i++) {
     double x = margin_left + (double)i / (NUM_POINTS - 1) * graph_w;
     char num[16];
-    snprintf(num, sizeof(num), "%d", TEST_SIZES[i]);
+    snprintf(num, sizeof(num), "%d", state->sizes[i]);
 
     cairo_text_extents_t extents;
     cairo_text_extents(cr, num, &extents);
@@ -167,7 +431,7 @@ static void on_draw(GtkDrawingArea *area, cairo_t *cr, int width, int height,
   cairo_show_text(cr, xlabel);
 
   // Y-Axis Title (rotated)
-  const char *ylabel = "Temps d'exécution (secondes / s)";
+  const char *ylabel = "Temps médian, IC 95 % (secondes / s)";
   cairo_save(cr);
   cairo_translate(cr, 20, margin_top + graph_h / 2);
   cairo_rotate(cr, -M_PI / 2);
@@ -177,28 +441,35 @@ static void on_draw(GtkDrawingArea *area, cairo_t *cr, int width, int height,
   cairo_restore(cr);
 
   // 8. Plot Lines with Markers
-  // Colors: Red (Bubble), Orange (Insertion), Green (Shell), Blue (Quick)
-  double colors[4][3] = {
-      {0.9, 0.2, 0.2},  // Rouge - Bubble
-      {0.95, 0.6, 0.1}, // Orange - Insertion
-      {0.2, 0.7, 0.3},  // Vert - Shell
-      {0.2, 0.4, 0.9}   // Bleu - Quick
+  // Colors: Red (Bubble), Orange (Insertion), Green (Shell), Blue (Quick),
+  // Purple (Radix), Teal (Counting), Grey (Parallel), Brown (Merge),
+  // Light blue (scalar Quick)
+  double colors[NUM_SERIES][3] = {
+      {0.9, 0.2, 0.2},   // Rouge - Bubble
+      {0.95, 0.6, 0.1},  // Orange - Insertion
+      {0.2, 0.7, 0.3},   // Vert - Shell
+      {0.2, 0.4, 0.9},   // Bleu - Quick
+      {0.6, 0.3, 0.8},   // Violet - Radix
+      {0.1, 0.65, 0.65}, // Turquoise - Counting
+      {0.4, 0.4, 0.4},   // Gris - Parallel
+      {0.6, 0.4, 0.2},   // Brun - Merge
+      {0.55, 0.7, 1.0}   // Bleu clair - Quick sans SIMD
   };
 
   cairo_set_line_width(cr, 2.5);
 
-  for (int algo = 0; algo < 4; algo++) {
+  for (int algo = 0; algo < NUM_SERIES; algo++) {
     cairo_set_source_rgb(cr, colors[algo][0], colors[algo][1], colors[algo][2]);
 
     // Draw lines
     int first_valid = 1;
     for (int s = 0; s < NUM_POINTS; s++) {
-      if (BENCH_RESULTS[algo][s] <= 0 && TEST_SIZES[s] > SLOW_ALGO_THRESHOLD)
-        continue; // Skip dropped points
+      if (!measured[algo][s])
+        continue; // Not measured yet
 
       double x = margin_left + (double)s / (NUM_POINTS - 1) * graph_w;
-      double y =
-          margin_top + graph_h - (BENCH_RESULTS[algo][s] / max_time * graph_h);
+      double y = margin_top + graph_h -
+                 (results[algo][s].median / max_time * graph_h);
 
       if (first_valid) {
         cairo_move_to(cr, x, y);
@@ -209,14 +480,29 @@ static void on_draw(GtkDrawingArea *area, cairo_t *cr, int width, int height,
     }
     cairo_stroke(cr);
 
-    // Draw markers (circles)
+    // Draw markers (circles) with the 95% confidence interval of the median
     for (int s = 0; s < NUM_POINTS; s++) {
-      if (BENCH_RESULTS[algo][s] <= 0 && TEST_SIZES[s] > SLOW_ALGO_THRESHOLD)
+      if (!measured[algo][s])
         continue;
 
       double x = margin_left + (double)s / (NUM_POINTS - 1) * graph_w;
-      double y =
-          margin_top + graph_h - (BENCH_RESULTS[algo][s] / max_time * graph_h);
+      double y = margin_top + graph_h -
+                 (results[algo][s].median / max_time * graph_h);
+      double y_low = margin_top + graph_h -
+                     (results[algo][s].ci_low / max_time * graph_h);
+      double y_high = margin_top + graph_h -
+                      (results[algo][s].ci_high / max_time * graph_h);
+
+      // Error bar
+      cairo_set_line_width(cr, 1.5);
+      cairo_move_to(cr, x, y_low);
+      cairo_line_to(cr, x, y_high);
+      cairo_move_to(cr, x - 4, y_low);
+      cairo_line_to(cr, x + 4, y_low);
+      cairo_move_to(cr, x - 4, y_high);
+      cairo_line_to(cr, x + 4, y_high);
+      cairo_stroke(cr);
+      cairo_set_line_width(cr, 2.5);
 
       // Filled circle
       cairo_arc(cr, x, y, 5, 0, 2 * M_PI);
@@ -230,7 +516,7 @@ static void on_draw(GtkDrawingArea *area, cairo_t *cr, int width, int height,
 
   cairo_set_font_size(cr, 11);
 
-  for (int algo = 0; algo < 4; algo++) {
+  for (int algo = 0; algo < NUM_SERIES; algo++) {
     // Draw colored circle
     cairo_set_source_rgb(cr, colors[algo][0], colors[algo][1], colors[algo][2]);
     cairo_arc(cr, lx + 6, ly + (algo * 22) + 6, 5, 0, 2 * M_PI);
@@ -243,14 +529,29 @@ static void on_draw(GtkDrawingArea *area, cairo_t *cr, int width, int height,
   }
 }
 
+static void on_distribution_changed(GtkDropDown *dropdown, GParamSpec *pspec,
+                                    gpointer user_data) {
+  (void)pspec;
+  CurveState *state = user_data;
+  state->distribution = (int)gtk_drop_down_get_selected(dropdown);
+  update_title(state);
+  if (state->area)
+    gtk_widget_queue_draw(state->area);
+}
+
 static void on_close_clicked(GtkWidget *button, gpointer user_data) {
   GtkWidget *window = GTK_WIDGET(user_data);
   gtk_window_close(GTK_WINDOW(window));
 }
 
-void open_curve_window(GtkWindow *parent, int max_size) {
-  // 0. Run Benchmarks
-  run_benchmarks(max_size);
+void open_curve_window(GtkWindow *parent, int max_size,
+                       DsaArrayDistribution distribution, uint64_t seed) {
+  // 0. State shared with the benchmark workers
+  CurveState *state = g_new0(CurveState, 1);
+  state->ref_count = 1;
+  state->seed = seed;
+  state->distribution = (int)distribution;
+  update_title(state);
 
   // 1. Create Window
   GtkWidget *window = gtk_window_new();
@@ -268,7 +569,7 @@ void open_curve_window(GtkWindow *parent, int max_size) {
   GtkWidget *area = gtk_drawing_area_new();
   gtk_widget_set_vexpand(area, TRUE);
   gtk_widget_set_hexpand(area, TRUE);
-  gtk_drawing_area_set_draw_func(GTK_DRAWING_AREA(area), on_draw, NULL, NULL);
+  gtk_drawing_area_set_draw_func(GTK_DRAWING_AREA(area), on_draw, state, NULL);
   gtk_box_append(GTK_BOX(main_box), area);
 
   // 3. Bottom bar with Close button
@@ -280,11 +581,29 @@ void open_curve_window(GtkWindow *parent, int max_size) {
   gtk_widget_set_halign(bottom_bar, GTK_ALIGN_CENTER);
   gtk_box_append(GTK_BOX(main_box), bottom_bar);
 
+  // Distribution shown (all of them are measured)
+  const char *dists[NUM_DISTRIBUTIONS + 1];
+  for (int d = 0; d < NUM_DISTRIBUTIONS; d++)
+    dists[d] = dsa_array_distribution_label((DsaArrayDistribution)d);
+  dists[NUM_DISTRIBUTIONS] = NULL;
+  GtkWidget *dropdown_dist = gtk_drop_down_new_from_strings(dists);
+  gtk_drop_down_set_selected(GTK_DROP_DOWN(dropdown_dist),
+                             (guint)state->distribution);
+  gtk_widget_set_margin_end(dropdown_dist, 20);
+  g_signal_connect(dropdown_dist, "notify::selected",
+                   G_CALLBACK(on_distribution_changed), state);
+  gtk_box_append(GTK_BOX(bottom_bar), dropdown_dist);
+
   GtkWidget *btn_close = gtk_button_new_with_label("Fermer");
   gtk_widget_set_size_request(btn_close, 150, 40);
   gtk_widget_add_css_class(btn_close, "suggested-action");
   g_signal_connect(btn_close, "clicked", G_CALLBACK(on_close_clicked), window);
   gtk_box_append(GTK_BOX(bottom_bar), btn_close);
 
+  // 4. The window opens at once; points stream in as cells complete
+  state->area = area;
+  g_signal_connect(window, "destroy", G_CALLBACK(on_window_destroy), state);
+  start_benchmarks(state, max_size);
+
   gtk_window_present(GTK_WINDOW(window));
 }
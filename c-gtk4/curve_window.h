@@ -1,8 +1,13 @@
 #ifndef CURVE_WINDOW_H
 #define CURVE_WINDOW_H
 
+#include "array_generators.h"
 #include <gtk/gtk.h>
 
-void open_curve_window(GtkWindow *parent, int max_size);
+// Performance curves of every algorithm up to `max_size` elements;
+// `distribution` is the input distribution shown when the window opens and
+// `seed` the seed the inputs are generated from (shown in the title)
+void open_curve_window(GtkWindow *parent, int max_size,
+                       DsaArrayDistribution distribution, uint64_t seed);
 
 #endif
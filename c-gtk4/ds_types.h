@@ -0,0 +1,15 @@
+#ifndef DS_TYPES_H
+#define DS_TYPES_H
+
+// Types de données supportés, communs aux tableaux, listes et graphes
+// (pour les graphes, DSA_TYPE_FLOAT désigne des valeurs double)
+typedef enum {
+  DSA_TYPE_INT,
+  DSA_TYPE_FLOAT,
+  DSA_TYPE_CHAR,
+  DSA_TYPE_STRING
+} DsaDataType;
+
+#define DSA_DATA_TYPE_COUNT 4
+
+#endif
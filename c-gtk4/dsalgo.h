@@ -0,0 +1,27 @@
+#ifndef DSALGO_H
+#define DSALGO_H
+
+// En-tête public de la bibliothèque libdsalgo (sans GTK) : tableaux,
+// listes chaînées, arbres, graphes, génération de données et mesure du
+// temps. Les noms exportés sont préfixés : fonctions dsa_, types Dsa,
+// macros et constantes DSA_.
+
+#include "array_format.h"
+#include "array_generators.h"
+#include "array_io.h"
+#include "array_parse.h"
+#include "ds_types.h"
+#include "external_sort.h"
+#include "graph_algorithms.h"
+#include "list_algorithms.h"
+#include "list_index.h"
+#include "node_pool.h"
+#include "prng.h"
+#include "scratch_pool.h"
+#include "sort_algorithms.h"
+#include "sort_network.h"
+#include "timing.h"
+#include "tree_algorithms.h"
+#include "unrolled_list.h"
+
+#endif
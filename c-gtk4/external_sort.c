@@ -0,0 +1,499 @@
+#include "external_sort.h"
+#include "scratch_pool.h"
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#define file_seek _fseeki64
+#else
+#define file_seek fseeko
+#include <unistd.h>
+#endif
+
+// Tampon de lecture minimal par tranche pendant la fusion : en dessous, les
+// repositionnements dans le fichier temporaire l'emportent sur la lecture
+#define EXTERNAL_MIN_BUFFER ((size_t)4 << 20)
+#define EXTERNAL_MAX_FAN_IN 256
+// Marque d'un noeud vide pendant la construction de l'arbre des perdants
+#define TREE_EMPTY SIZE_MAX
+
+// Tranche triée dans un fichier
+typedef struct {
+  uint64_t offset; // Position du premier élément (octets)
+  uint64_t count;
+} SortRun;
+
+typedef struct {
+  SortRun *items;
+  size_t count;
+  size_t capacity;
+} RunList;
+
+// Lecture séquentielle d'une tranche par grands blocs
+typedef struct {
+  FILE *file;
+  uint64_t offset;    // Prochain bloc à lire (octets)
+  uint64_t remaining; // Éléments pas encore lus
+  char *buffer;
+  size_t capacity; // En éléments
+  size_t pos;
+  size_t count;
+} RunReader;
+
+typedef struct {
+  FILE *file;
+  char *buffer;
+  size_t capacity; // En éléments
+  size_t count;
+} RunWriter;
+
+typedef struct {
+  size_t element_size;
+  DsaSortControl *control;
+  DsaExternalSortStats *stats;
+} ExternalContext;
+
+void dsa_external_sort_default_options(DsaExternalSortOptions *options) {
+  options->memory_budget = DSA_EXTERNAL_SORT_DEFAULT_BUDGET;
+  options->run_algo = DSA_ALGO_RADIX;
+  options->temp_dir = NULL;
+  options->control = NULL;
+}
+
+static bool is_cancelled(const ExternalContext *ctx) {
+  return ctx->control &&
+         atomic_load_explicit(&ctx->control->cancel, memory_order_relaxed);
+}
+
+static void add_progress(ExternalContext *ctx, uint64_t elements) {
+  if (ctx->control)
+    atomic_fetch_add_explicit(&ctx->control->done, elements,
+                              memory_order_relaxed);
+}
+
+static bool run_list_push(RunList *list, uint64_t offset, uint64_t count) {
+  if (list->count == list->capacity) {
+    size_t capacity = list->capacity ? list->capacity * 2 : 64;
+    SortRun *items = realloc(list->items, capacity * sizeof(SortRun));
+    if (!items)
+      return false;
+    list->items = items;
+    list->capacity = capacity;
+  }
+  list->items[list->count++] = (SortRun){offset, count};
+  return true;
+}
+
+// Fichier temporaire anonyme, supprimé à la fermeture
+static FILE *open_temp_file(const char *dir) {
+#ifndef _WIN32
+  if (dir) {
+    static const char name[] = "/dsa-sort-XXXXXX";
+    char *path = malloc(strlen(dir) + sizeof(name));
+    if (!path)
+      return NULL;
+    strcpy(path, dir);
+    strcat(path, name);
+    int fd = mkstemp(path);
+    FILE *file = NULL;
+    if (fd >= 0) {
+      unlink(path);
+      file = fdopen(fd, "w+b");
+      if (!file)
+        close(fd);
+    }
+    free(path);
+    return file;
+  }
+#else
+  (void)dir;
+#endif
+  return tmpfile();
+}
+
+static DsaArrayIoStatus open_output(const char *path, DsaDataType type,
+                                    uint64_t count, FILE **file) {
+  FILE *f = fopen(path, "wb");
+  if (!f)
+    return DSA_ARRAY_IO_ERR_OPEN;
+  DsaArrayIoStatus status = dsa_array_write_header(f, type, count, NULL);
+  if (status != DSA_ARRAY_IO_OK) {
+    fclose(f);
+    return status;
+  }
+  *file = f;
+  return DSA_ARRAY_IO_OK;
+}
+
+static bool reader_refill(RunReader *reader, ExternalContext *ctx) {
+  size_t count = reader->remaining < reader->capacity
+                     ? (size_t)reader->remaining
+                     : reader->capacity;
+  size_t bytes = count * ctx->element_size;
+  if (file_seek(reader->file, reader->offset, SEEK_SET) != 0 ||
+      fread(reader->buffer, 1, bytes, reader->file) != bytes)
+    return false;
+  reader->offset += bytes;
+  reader->remaining -= count;
+  reader->pos = 0;
+  reader->count = count;
+  ctx->stats->bytes_read += bytes;
+  return true;
+}
+
+static inline bool reader_live(const RunReader *reader) {
+  return reader->pos < reader->count;
+}
+
+static DsaArrayIoStatus writer_flush(RunWriter *writer, ExternalContext *ctx) {
+  size_t bytes = writer->count * ctx->element_size;
+  if (bytes > 0 && fwrite(writer->buffer, 1, bytes, writer->file) != bytes)
+    return DSA_ARRAY_IO_ERR_WRITE;
+  ctx->stats->bytes_written += bytes;
+  add_progress(ctx, writer->count);
+  writer->count = 0;
+  return is_cancelled(ctx) ? DSA_ARRAY_IO_ERR_CANCELLED : DSA_ARRAY_IO_OK;
+}
+
+// Fusion à k voies par arbre des perdants : tree[0] est la tranche gagnante
+// (plus petite tête), tree[1..k-1] les perdants des matchs internes, les
+// feuilles (k + i) étant implicites. Remplacer la tête gagnante ne rejoue
+// que les log2(k) matchs de son chemin vers la racine, sans permutation
+// comme dans un tas. Les têtes sont copiées dans `keys` pour rester
+// contiguës ; une tranche épuisée perd tous ses matchs, et à égalité la
+// tranche la plus ancienne gagne (fusion stable).
+#define DEFINE_MERGE(SUFFIX, T, LESS)                                          \
+  static inline bool beats_##SUFFIX(const T *keys, const RunReader *readers,   \
+                                    size_t a, size_t b) {                      \
+    if (!reader_live(&readers[a]))                                             \
+      return false;                                                            \
+    if (!reader_live(&readers[b]))                                             \
+      return true;                                                             \
+    if (LESS(keys[a], keys[b]))                                                \
+      return true;                                                             \
+    if (LESS(keys[b], keys[a]))                                                \
+      return false;                                                            \
+    return a < b;                                                              \
+  }                                                                            \
+                                                                               \
+  /* Remonte `player` depuis sa feuille ; pendant la construction, il */       \
+  /* s'arrête au premier noeud vide en attendant son adversaire */             \
+  static inline void replay_##SUFFIX(size_t *tree, const T *keys,              \
+                                     const RunReader *readers, size_t k,       \
+                                     size_t player) {                          \
+    for (size_t node = (k + player) / 2; node >= 1; node /= 2) {               \
+      if (tree[node] == TREE_EMPTY) {                                          \
+        tree[node] = player;                                                   \
+        return;                                                                \
+      }                                                                        \
+      if (beats_##SUFFIX(keys, readers, tree[node], player)) {                 \
+        size_t winner = tree[node];                                            \
+        tree[node] = player;                                                   \
+        player = winner;                                                       \
+      }                                                                        \
+    }                                                                          \
+    tree[0] = player;                                                          \
+  }                                                                            \
+                                                                               \
+  static DsaArrayIoStatus merge_##SUFFIX(RunReader *readers, size_t k,         \
+                                         RunWriter *out, size_t *tree,         \
+                                         T *keys, ExternalContext *ctx) {      \
+    for (size_t node = 0; node < k; node++)                                    \
+      tree[node] = TREE_EMPTY;                                                 \
+    for (size_t i = 0; i < k; i++) {                                           \
+      if (reader_live(&readers[i]))                                            \
+        keys[i] = ((T *)readers[i].buffer)[0];                                 \
+      replay_##SUFFIX(tree, keys, readers, k, i);                              \
+    }                                                                          \
+                                                                               \
+    T *output = (T *)out->buffer;                                              \
+    for (;;) {                                                                 \
+      size_t winner = tree[0];                                                 \
+      RunReader *reader = &readers[winner];                                    \
+      if (!reader_live(reader))                                                \
+        break; /* Toutes les tranches sont épuisées */                         \
+      output[out->count++] = keys[winner];                                     \
+      if (out->count == out->capacity) {                                       \
+        DsaArrayIoStatus status = writer_flush(out, ctx);                      \
+        if (status != DSA_ARRAY_IO_OK)                                         \
+          return status;                                                       \
+      }                                                                        \
+      if (++reader->pos == reader->count && reader->remaining > 0 &&           \
+          !reader_refill(reader, ctx))                                         \
+        return DSA_ARRAY_IO_ERR_READ;                                          \
+      if (reader_live(reader))                                                 \
+        keys[winner] = ((T *)reader->buffer)[reader->pos];                     \
+      replay_##SUFFIX(tree, keys, readers, k, winner);                         \
+    }                                                                          \
+    return writer_flush(out, ctx);                                             \
+  }
+
+#define LESS_NUM(a, b) ((a) < (b))
+
+DEFINE_MERGE(int, int, LESS_NUM)
+DEFINE_MERGE(float, float, LESS_NUM)
+DEFINE_MERGE(char, char, LESS_NUM)
+
+// Phase 1 : lit `count` éléments par tranches de `run_capacity`, trie
+// chacune en mémoire et l'écrit à la suite dans `dest`
+static DsaArrayIoStatus create_runs(FILE *input, uint64_t count, FILE *dest,
+                                    size_t run_capacity, DsaDataType type,
+                                    DsaSortAlgo algo, ExternalContext *ctx,
+                                    RunList *runs) {
+  size_t es = ctx->element_size;
+  size_t capacity = count < run_capacity ? (size_t)count : run_capacity;
+  void *buffer = dsa_aligned_buffer_alloc(capacity > 0 ? capacity * es : es);
+  if (!buffer)
+    return DSA_ARRAY_IO_ERR_MEMORY;
+
+  // Les tampons internes des tris sont réutilisés d'une tranche à l'autre
+  DsaScratchPool pool = {0};
+  DsaSortControl run_control;
+  dsa_sort_control_init(&run_control);
+  run_control.scratch = &pool;
+
+  DsaArrayIoStatus status = DSA_ARRAY_IO_OK;
+  for (uint64_t first = 0; first < count; first += capacity) {
+    if (is_cancelled(ctx)) {
+      status = DSA_ARRAY_IO_ERR_CANCELLED;
+      break;
+    }
+    size_t n = count - first < capacity ? (size_t)(count - first) : capacity;
+    size_t bytes = n * es;
+    if (fread(buffer, 1, bytes, input) != bytes) {
+      status = DSA_ARRAY_IO_ERR_READ;
+      break;
+    }
+    ctx->stats->bytes_read += bytes;
+
+    DsaArrayData data = {.array = buffer, .size = n, .type = type};
+    dsa_sort_array_controlled(&data, algo, &run_control, NULL);
+
+    if (fwrite(buffer, 1, bytes, dest) != bytes) {
+      status = DSA_ARRAY_IO_ERR_WRITE;
+      break;
+    }
+    ctx->stats->bytes_written += bytes;
+    if (!run_list_push(runs, first * es, n)) {
+      status = DSA_ARRAY_IO_ERR_MEMORY;
+      break;
+    }
+    add_progress(ctx, n);
+  }
+
+  dsa_scratch_pool_release(&pool);
+  dsa_aligned_buffer_free(buffer);
+  return status;
+}
+
+// Phase 2, un passage : fusionne les tranches de `source` par groupes de
+// `fan_in` et écrit les tranches résultantes dans `dest` (à partir de
+// `dest_base`). `memory` (`budget` octets) est partagé entre les tampons.
+static DsaArrayIoStatus merge_pass(FILE *source, const RunList *runs,
+                                   FILE *dest, uint64_t dest_base,
+                                   RunList *merged, size_t fan_in, char *memory,
+                                   size_t budget, DsaDataType type,
+                                   ExternalContext *ctx) {
+  size_t es = ctx->element_size;
+  RunReader *readers = malloc(fan_in * sizeof(RunReader));
+  size_t *tree = malloc(fan_in * sizeof(size_t));
+  void *keys = malloc(fan_in * es);
+  DsaArrayIoStatus status = DSA_ARRAY_IO_OK;
+  if (!readers || !tree || !keys)
+    status = DSA_ARRAY_IO_ERR_MEMORY;
+
+  uint64_t written = 0;
+  for (size_t first = 0; status == DSA_ARRAY_IO_OK && first < runs->count;
+       first += fan_in) {
+    size_t k = runs->count - first < fan_in ? runs->count - first : fan_in;
+    // Un tampon par tranche plus celui de sortie, alignés sur la ligne de
+    // cache
+    size_t slot_bytes =
+        budget / (k + 1) / DSA_SCRATCH_ALIGNMENT * DSA_SCRATCH_ALIGNMENT;
+    size_t slot = slot_bytes / es;
+
+    uint64_t total = 0;
+    for (size_t i = 0; i < k; i++) {
+      const SortRun *run = &runs->items[first + i];
+      readers[i] = (RunReader){source, run->offset, run->count,
+                               memory + i * slot_bytes, slot, 0, 0};
+      total += run->count;
+      if (!reader_refill(&readers[i], ctx)) {
+        status = DSA_ARRAY_IO_ERR_READ;
+        break;
+      }
+    }
+    if (status != DSA_ARRAY_IO_OK)
+      break;
+
+    RunWriter writer = {dest, memory + k * slot_bytes, slot, 0};
+    switch (type) {
+    case DSA_TYPE_INT:
+      status = merge_int(readers, k, &writer, tree, keys, ctx);
+      break;
+    case DSA_TYPE_FLOAT:
+      status = merge_float(readers, k, &writer, tree, keys, ctx);
+      break;
+    case DSA_TYPE_CHAR:
+      status = merge_char(readers, k, &writer, tree, keys, ctx);
+      break;
+    case DSA_TYPE_STRING:
+      status = DSA_ARRAY_IO_ERR_TYPE;
+      break;
+    }
+    if (status == DSA_ARRAY_IO_OK &&
+        !run_list_push(merged, dest_base + written * es, total))
+      status = DSA_ARRAY_IO_ERR_MEMORY;
+    written += total;
+  }
+
+  free(keys);
+  free(tree);
+  free(readers);
+  return status;
+}
+
+DsaArrayIoStatus dsa_external_sort_file(const char *input, const char *output,
+                                        const DsaExternalSortOptions *options,
+                                        DsaExternalSortStats *stats) {
+  DsaExternalSortOptions defaults;
+  if (!options) {
+    dsa_external_sort_default_options(&defaults);
+    options = &defaults;
+  }
+  DsaExternalSortStats local_stats;
+  if (!stats)
+    stats = &local_stats;
+  memset(stats, 0, sizeof(*stats));
+
+  size_t budget = options->memory_budget > DSA_EXTERNAL_SORT_MIN_BUDGET
+                      ? options->memory_budget
+                      : DSA_EXTERNAL_SORT_MIN_BUDGET;
+
+  DsaArrayFileInfo info;
+  FILE *in = NULL;
+  DsaArrayIoStatus status = dsa_array_open_binary(input, &info, &in);
+  if (status != DSA_ARRAY_IO_OK)
+    return status;
+
+  ExternalContext ctx = {dsa_array_element_size(info.type), options->control,
+                         stats};
+  // Moitié du budget pour la tranche : le tri en mémoire (radix) peut
+  // utiliser un tampon de même taille
+  size_t run_capacity = budget / 2 / ctx.element_size;
+  uint64_t run_count = (info.count + run_capacity - 1) / run_capacity;
+
+  size_t fan_in = budget >= 3 * EXTERNAL_MIN_BUFFER
+                      ? budget / EXTERNAL_MIN_BUFFER - 1
+                      : 2;
+  if (fan_in > EXTERNAL_MAX_FAN_IN)
+    fan_in = EXTERNAL_MAX_FAN_IN;
+  size_t passes = 0;
+  for (uint64_t remaining = run_count; remaining > 1;
+       remaining = (remaining + fan_in - 1) / fan_in)
+    passes++;
+
+  stats->elements = info.count;
+  stats->fan_in = fan_in;
+  if (ctx.control) {
+    // Chaque élément est écrit une fois par la phase 1 et par passage
+    atomic_store(&ctx.control->done, 0);
+    atomic_store(&ctx.control->total, info.count * (1 + passes));
+  }
+
+  // Sortie écrite sous un autre nom puis renommée une fois complète
+  static const char suffix[] = ".part";
+  char *part = malloc(strlen(output) + sizeof(suffix));
+  if (!part) {
+    fclose(in);
+    return DSA_ARRAY_IO_ERR_MEMORY;
+  }
+  strcpy(part, output);
+  strcat(part, suffix);
+
+  FILE *out = NULL;
+  FILE *temp[2] = {NULL, NULL};
+  RunList runs = {0};
+  RunList merged = {0};
+  char *memory = NULL;
+
+  if (run_count <= 1) {
+    // Tout tient dans le budget : tri direct vers la sortie
+    status = open_output(part, info.type, info.count, &out);
+    if (status == DSA_ARRAY_IO_OK)
+      status = create_runs(in, info.count, out, run_capacity, info.type,
+                           options->run_algo, &ctx, &runs);
+  } else {
+    temp[0] = open_temp_file(options->temp_dir);
+    status = temp[0] ? create_runs(in, info.count, temp[0], run_capacity,
+                                   info.type, options->run_algo, &ctx, &runs)
+                     : DSA_ARRAY_IO_ERR_OPEN;
+  }
+  // L'entrée est entièrement lue : elle peut être remplacée par la sortie
+  fclose(in);
+  stats->runs = runs.count;
+
+  if (status == DSA_ARRAY_IO_OK && runs.count > 1) {
+    memory = dsa_aligned_buffer_alloc(budget);
+    if (!memory)
+      status = DSA_ARRAY_IO_ERR_MEMORY;
+  }
+  while (status == DSA_ARRAY_IO_OK && runs.count > 1) {
+    FILE *dest;
+    uint64_t dest_base = 0;
+    if (runs.count <= fan_in) {
+      // Dernier passage : directement dans la sortie
+      status = open_output(part, info.type, info.count, &out);
+      dest = out;
+      dest_base = DSA_ARRAY_FILE_HEADER_SIZE;
+    } else {
+      if (!temp[1])
+        temp[1] = open_temp_file(options->temp_dir);
+      dest = temp[1];
+      if (!dest)
+        status = DSA_ARRAY_IO_ERR_OPEN;
+      else if (file_seek(dest, 0, SEEK_SET) != 0)
+        status = DSA_ARRAY_IO_ERR_WRITE;
+    }
+    if (status != DSA_ARRAY_IO_OK)
+      break;
+
+    merged.count = 0;
+    status = merge_pass(temp[0], &runs, dest, dest_base, &merged, fan_in,
+                        memory, budget, info.type, &ctx);
+    stats->merge_passes++;
+
+    RunList swap_runs = runs;
+    runs = merged;
+    merged = swap_runs;
+    FILE *swap_file = temp[0];
+    temp[0] = temp[1];
+    temp[1] = swap_file;
+  }
+
+  dsa_aligned_buffer_free(memory);
+  free(runs.items);
+  free(merged.items);
+  for (int i = 0; i < 2; i++)
+    if (temp[i])
+      fclose(temp[i]);
+
+  if (out) {
+    if (fclose(out) != 0 && status == DSA_ARRAY_IO_OK)
+      status = DSA_ARRAY_IO_ERR_WRITE;
+#ifdef _WIN32
+    // rename ne remplace pas un fichier existant sous Windows
+    if (status == DSA_ARRAY_IO_OK)
+      remove(output);
+#endif
+    if (status == DSA_ARRAY_IO_OK && rename(part, output) != 0)
+      status = DSA_ARRAY_IO_ERR_WRITE;
+    if (status != DSA_ARRAY_IO_OK)
+      remove(part);
+  }
+  free(part);
+  return status;
+}
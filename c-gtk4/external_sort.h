@@ -0,0 +1,53 @@
+#ifndef EXTERNAL_SORT_H
+#define EXTERNAL_SORT_H
+
+#include "array_io.h"
+#include "sort_algorithms.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// Tri externe des fichiers binaires (.dsa) plus grands que la mémoire.
+//
+// Phase 1 : le fichier est lu par tranches (« runs ») qui tiennent dans le
+// budget mémoire ; chaque tranche est triée en mémoire par les tris
+// existants puis écrite dans un fichier temporaire.
+// Phase 2 : fusion à k voies des tranches par un arbre des perdants, avec un
+// grand tampon de lecture séquentielle par tranche. Si les tranches sont
+// trop nombreuses pour un seul passage, la fusion se fait en plusieurs
+// passages, chacun réduisant leur nombre d'un facteur k.
+//
+// Le résultat est écrit à côté de la sortie puis renommé : la sortie peut
+// être le fichier d'entrée, et elle reste intacte en cas d'erreur ou
+// d'annulation.
+
+// Budget par défaut et minimal (octets)
+#define DSA_EXTERNAL_SORT_DEFAULT_BUDGET ((size_t)256 << 20)
+#define DSA_EXTERNAL_SORT_MIN_BUDGET ((size_t)64 << 10)
+
+typedef struct {
+  size_t memory_budget; // Mémoire totale utilisable (tampons et tris)
+  DsaSortAlgo run_algo; // Tri des tranches en mémoire
+  const char *temp_dir; // Fichiers temporaires (NULL : répertoire système)
+  // Facultatif : annulation et avancement (en éléments écrits, toutes
+  // phases confondues). Son pool de tampons n'est pas utilisé.
+  DsaSortControl *control;
+} DsaExternalSortOptions;
+
+typedef struct {
+  uint64_t elements;
+  size_t runs;         // Tranches triées en mémoire
+  size_t fan_in;       // Tranches fusionnées à la fois
+  size_t merge_passes; // Passages de fusion (0 : une seule tranche)
+  uint64_t bytes_read; // Octets lus, fichiers temporaires compris
+  uint64_t bytes_written;
+} DsaExternalSortStats;
+
+void dsa_external_sort_default_options(DsaExternalSortOptions *options);
+
+// Trie le fichier binaire `input` dans `output` (par ordre croissant).
+// `options` et `stats` sont facultatifs.
+DsaArrayIoStatus dsa_external_sort_file(const char *input, const char *output,
+                                        const DsaExternalSortOptions *options,
+                                        DsaExternalSortStats *stats);
+
+#endif
@@ -2,19 +2,18 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <time.h>
 
 
 // ============================================================================
 // Fonctions de création/destruction
 // ============================================================================
 
-Graph *graph_create(int num_vertices, DataType data_type) {
-  if (num_vertices <= 0 || num_vertices > MAX_VERTICES) {
+DsaGraph *dsa_graph_create(int num_vertices, DsaDataType data_type) {
+  if (num_vertices <= 0 || num_vertices > DSA_GRAPH_MAX_VERTICES) {
     return NULL;
   }
 
-  Graph *graph = (Graph *)malloc(sizeof(Graph));
+  DsaGraph *graph = (DsaGraph *)malloc(sizeof(DsaGraph));
   if (!graph)
     return NULL;
 
@@ -25,51 +24,51 @@ Graph *graph_create(int num_vertices, DataType data_type) {
   // Initialiser les sommets
   for (int i = 0; i < num_vertices; i++) {
     graph->nodes[i].id = i;
-    memset(&graph->nodes[i].value, 0, sizeof(NodeValue));
+    memset(&graph->nodes[i].value, 0, sizeof(DsaNodeValue));
     graph->nodes[i].x = 0;
     graph->nodes[i].y = 0;
 
     // Valeurs par défaut selon le type
     switch (data_type) {
-    case DATA_TYPE_INT:
+    case DSA_TYPE_INT:
       graph->nodes[i].value.int_val = i;
       break;
-    case DATA_TYPE_DOUBLE:
+    case DSA_TYPE_FLOAT:
       graph->nodes[i].value.double_val = (double)i;
       break;
-    case DATA_TYPE_CHAR:
+    case DSA_TYPE_CHAR:
       graph->nodes[i].value.char_val = 'A' + i;
       break;
-    case DATA_TYPE_STRING:
+    case DSA_TYPE_STRING:
       snprintf(graph->nodes[i].value.string_val, 64, "S%d", i);
       break;
     }
   }
 
   // Initialiser la matrice d'adjacence (pas d'arêtes)
-  for (int i = 0; i < MAX_VERTICES; i++) {
-    for (int j = 0; j < MAX_VERTICES; j++) {
-      graph->adj_matrix[i][j] = (i == j) ? 0 : INF;
+  for (int i = 0; i < DSA_GRAPH_MAX_VERTICES; i++) {
+    for (int j = 0; j < DSA_GRAPH_MAX_VERTICES; j++) {
+      graph->adj_matrix[i][j] = (i == j) ? 0 : DSA_GRAPH_INF;
     }
   }
 
   return graph;
 }
 
-void graph_destroy(Graph *graph) {
+void dsa_graph_destroy(DsaGraph *graph) {
   if (graph) {
     free(graph);
   }
 }
 
-void graph_reset(Graph *graph) {
+void dsa_graph_reset(DsaGraph *graph) {
   if (!graph)
     return;
 
   graph->num_edges = 0;
-  for (int i = 0; i < MAX_VERTICES; i++) {
-    for (int j = 0; j < MAX_VERTICES; j++) {
-      graph->adj_matrix[i][j] = (i == j) ? 0 : INF;
+  for (int i = 0; i < DSA_GRAPH_MAX_VERTICES; i++) {
+    for (int j = 0; j < DSA_GRAPH_MAX_VERTICES; j++) {
+      graph->adj_matrix[i][j] = (i == j) ? 0 : DSA_GRAPH_INF;
     }
   }
 }
@@ -78,14 +77,14 @@ void graph_reset(Graph *graph) {
 // Gestion des arêtes
 // ============================================================================
 
-void graph_add_edge(Graph *graph, int from, int to, double weight) {
+void dsa_graph_add_edge(DsaGraph *graph, int from, int to, double weight) {
   if (!graph || from < 0 || from >= graph->num_vertices || to < 0 ||
       to >= graph->num_vertices) {
     return;
   }
 
   // Vérifier si l'arête existe déjà
-  if (graph->adj_matrix[from][to] == INF) {
+  if (graph->adj_matrix[from][to] == DSA_GRAPH_INF) {
     graph->edges[graph->num_edges].from = from;
     graph->edges[graph->num_edges].to = to;
     graph->edges[graph->num_edges].weight = weight;
@@ -96,28 +95,28 @@ void graph_add_edge(Graph *graph, int from, int to, double weight) {
   graph->adj_matrix[to][from] = weight; // Graphe non-orienté
 }
 
-void graph_remove_edge(Graph *graph, int from, int to) {
+void dsa_graph_remove_edge(DsaGraph *graph, int from, int to) {
   if (!graph || from < 0 || from >= graph->num_vertices || to < 0 ||
       to >= graph->num_vertices) {
     return;
   }
 
-  graph->adj_matrix[from][to] = INF;
-  graph->adj_matrix[to][from] = INF;
+  graph->adj_matrix[from][to] = DSA_GRAPH_INF;
+  graph->adj_matrix[to][from] = DSA_GRAPH_INF;
 }
 
-bool graph_has_edge(Graph *graph, int from, int to) {
+bool dsa_graph_has_edge(DsaGraph *graph, int from, int to) {
   if (!graph || from < 0 || from >= graph->num_vertices || to < 0 ||
       to >= graph->num_vertices) {
     return false;
   }
-  return graph->adj_matrix[from][to] != INF && from != to;
+  return graph->adj_matrix[from][to] != DSA_GRAPH_INF && from != to;
 }
 
-double graph_get_weight(Graph *graph, int from, int to) {
+double dsa_graph_get_weight(DsaGraph *graph, int from, int to) {
   if (!graph || from < 0 || from >= graph->num_vertices || to < 0 ||
       to >= graph->num_vertices) {
-    return INF;
+    return DSA_GRAPH_INF;
   }
   return graph->adj_matrix[from][to];
 }
@@ -126,49 +125,51 @@ double graph_get_weight(Graph *graph, int from, int to) {
 // Fonctions pour les valeurs des sommets
 // ============================================================================
 
-void graph_set_node_value_int(Graph *graph, int node_id, int value) {
+void dsa_graph_set_node_value_int(DsaGraph *graph, int node_id, int value) {
   if (graph && node_id >= 0 && node_id < graph->num_vertices) {
     graph->nodes[node_id].value.int_val = value;
   }
 }
 
-void graph_set_node_value_double(Graph *graph, int node_id, double value) {
+void dsa_graph_set_node_value_double(DsaGraph *graph, int node_id,
+                                     double value) {
   if (graph && node_id >= 0 && node_id < graph->num_vertices) {
     graph->nodes[node_id].value.double_val = value;
   }
 }
 
-void graph_set_node_value_char(Graph *graph, int node_id, char value) {
+void dsa_graph_set_node_value_char(DsaGraph *graph, int node_id, char value) {
   if (graph && node_id >= 0 && node_id < graph->num_vertices) {
     graph->nodes[node_id].value.char_val = value;
   }
 }
 
-void graph_set_node_value_string(Graph *graph, int node_id, const char *value) {
+void dsa_graph_set_node_value_string(DsaGraph *graph, int node_id,
+                                     const char *value) {
   if (graph && node_id >= 0 && node_id < graph->num_vertices && value) {
     strncpy(graph->nodes[node_id].value.string_val, value, 63);
     graph->nodes[node_id].value.string_val[63] = '\0';
   }
 }
 
-const char *graph_get_node_label(Graph *graph, int node_id, char *buffer,
-                                 size_t buffer_size) {
+const char *dsa_graph_get_node_label(DsaGraph *graph, int node_id, char *buffer,
+                                     size_t buffer_size) {
   if (!graph || node_id < 0 || node_id >= graph->num_vertices || !buffer) {
     return "";
   }
 
   switch (graph->data_type) {
-  case DATA_TYPE_INT:
+  case DSA_TYPE_INT:
     snprintf(buffer, buffer_size, "%d", graph->nodes[node_id].value.int_val);
     break;
-  case DATA_TYPE_DOUBLE:
+  case DSA_TYPE_FLOAT:
     snprintf(buffer, buffer_size, "%.1f",
              graph->nodes[node_id].value.double_val);
     break;
-  case DATA_TYPE_CHAR:
+  case DSA_TYPE_CHAR:
     snprintf(buffer, buffer_size, "%c", graph->nodes[node_id].value.char_val);
     break;
-  case DATA_TYPE_STRING:
+  case DSA_TYPE_STRING:
     snprintf(buffer, buffer_size, "%s", graph->nodes[node_id].value.string_val);
     break;
   }
@@ -180,10 +181,10 @@ const char *graph_get_node_label(Graph *graph, int node_id, char *buffer,
 // Algorithme de Dijkstra
 // ============================================================================
 
-PathResult dijkstra(Graph *graph, int start, int end) {
-  PathResult result = {0};
+DsaPathResult dsa_dijkstra(DsaGraph *graph, int start, int end) {
+  DsaPathResult result = {0};
   result.found = false;
-  result.distance = INF;
+  result.distance = DSA_GRAPH_INF;
   result.path_length = 0;
   result.has_negative_cycle = false;
 
@@ -192,16 +193,16 @@ PathResult dijkstra(Graph *graph, int start, int end) {
     return result;
   }
 
-  clock_t start_time = clock();
+  DsaTimingMark start_time = dsa_timing_mark();
 
   int n = graph->num_vertices;
-  double dist[MAX_VERTICES];
-  int prev[MAX_VERTICES];
-  bool visited[MAX_VERTICES];
+  double dist[DSA_GRAPH_MAX_VERTICES];
+  int prev[DSA_GRAPH_MAX_VERTICES];
+  bool visited[DSA_GRAPH_MAX_VERTICES];
 
   // Initialisation
   for (int i = 0; i < n; i++) {
-    dist[i] = INF;
+    dist[i] = DSA_GRAPH_INF;
     prev[i] = -1;
     visited[i] = false;
   }
@@ -211,7 +212,7 @@ PathResult dijkstra(Graph *graph, int start, int end) {
   for (int count = 0; count < n; count++) {
     // Trouver le sommet non visité avec la plus petite distance
     int u = -1;
-    double min_dist = INF;
+    double min_dist = DSA_GRAPH_INF;
     for (int i = 0; i < n; i++) {
       if (!visited[i] && dist[i] < min_dist) {
         min_dist = dist[i];
@@ -226,7 +227,7 @@ PathResult dijkstra(Graph *graph, int start, int end) {
 
     // Relaxation des arêtes
     for (int v = 0; v < n; v++) {
-      if (!visited[v] && graph->adj_matrix[u][v] != INF) {
+      if (!visited[v] && graph->adj_matrix[u][v] != DSA_GRAPH_INF) {
         double new_dist = dist[u] + graph->adj_matrix[u][v];
         if (new_dist < dist[v]) {
           dist[v] = new_dist;
@@ -237,12 +238,12 @@ PathResult dijkstra(Graph *graph, int start, int end) {
   }
 
   // Reconstruction du chemin
-  if (dist[end] != INF) {
+  if (dist[end] != DSA_GRAPH_INF) {
     result.found = true;
     result.distance = dist[end];
 
     // Reconstruire le chemin en remontant
-    int path_temp[MAX_VERTICES];
+    int path_temp[DSA_GRAPH_MAX_VERTICES];
     int len = 0;
     int current = end;
 
@@ -258,9 +259,8 @@ PathResult dijkstra(Graph *graph, int start, int end) {
     }
   }
 
-  clock_t end_time = clock();
-  result.execution_time_ms =
-      ((double)(end_time - start_time) / CLOCKS_PER_SEC) * 1000.0;
+  result.timing = dsa_timing_since(start_time);
+  result.execution_time_ms = dsa_timing_ns_to_ms(result.timing.ns);
 
   return result;
 }
@@ -269,10 +269,10 @@ PathResult dijkstra(Graph *graph, int start, int end) {
 // Algorithme de Bellman-Ford
 // ============================================================================
 
-PathResult bellman_ford(Graph *graph, int start, int end) {
-  PathResult result = {0};
+DsaPathResult dsa_bellman_ford(DsaGraph *graph, int start, int end) {
+  DsaPathResult result = {0};
   result.found = false;
-  result.distance = INF;
+  result.distance = DSA_GRAPH_INF;
   result.path_length = 0;
   result.has_negative_cycle = false;
 
@@ -281,15 +281,15 @@ PathResult bellman_ford(Graph *graph, int start, int end) {
     return result;
   }
 
-  clock_t start_time = clock();
+  DsaTimingMark start_time = dsa_timing_mark();
 
   int n = graph->num_vertices;
-  double dist[MAX_VERTICES];
-  int prev[MAX_VERTICES];
+  double dist[DSA_GRAPH_MAX_VERTICES];
+  int prev[DSA_GRAPH_MAX_VERTICES];
 
   // Initialisation
   for (int i = 0; i < n; i++) {
-    dist[i] = INF;
+    dist[i] = DSA_GRAPH_INF;
     prev[i] = -1;
   }
   dist[start] = 0;
@@ -298,10 +298,10 @@ PathResult bellman_ford(Graph *graph, int start, int end) {
   for (int i = 0; i < n - 1; i++) {
     bool updated = false;
     for (int u = 0; u < n; u++) {
-      if (dist[u] == INF)
+      if (dist[u] == DSA_GRAPH_INF)
         continue;
       for (int v = 0; v < n; v++) {
-        if (graph->adj_matrix[u][v] != INF && u != v) {
+        if (graph->adj_matrix[u][v] != DSA_GRAPH_INF && u != v) {
           double new_dist = dist[u] + graph->adj_matrix[u][v];
           if (new_dist < dist[v]) {
             dist[v] = new_dist;
@@ -317,15 +317,14 @@ PathResult bellman_ford(Graph *graph, int start, int end) {
 
   // Détection des cycles négatifs
   for (int u = 0; u < n; u++) {
-    if (dist[u] == INF)
+    if (dist[u] == DSA_GRAPH_INF)
       continue;
     for (int v = 0; v < n; v++) {
-      if (graph->adj_matrix[u][v] != INF && u != v) {
+      if (graph->adj_matrix[u][v] != DSA_GRAPH_INF && u != v) {
         if (dist[u] + graph->adj_matrix[u][v] < dist[v]) {
           result.has_negative_cycle = true;
-          clock_t end_time = clock();
-          result.execution_time_ms =
-              ((double)(end_time - start_time) / CLOCKS_PER_SEC) * 1000.0;
+          result.timing = dsa_timing_since(start_time);
+          result.execution_time_ms = dsa_timing_ns_to_ms(result.timing.ns);
           return result;
         }
       }
@@ -333,15 +332,15 @@ PathResult bellman_ford(Graph *graph, int start, int end) {
   }
 
   // Reconstruction du chemin
-  if (dist[end] != INF) {
+  if (dist[end] != DSA_GRAPH_INF) {
     result.found = true;
     result.distance = dist[end];
 
-    int path_temp[MAX_VERTICES];
+    int path_temp[DSA_GRAPH_MAX_VERTICES];
     int len = 0;
     int current = end;
 
-    while (current != -1 && len < MAX_VERTICES) {
+    while (current != -1 && len < DSA_GRAPH_MAX_VERTICES) {
       path_temp[len++] = current;
       current = prev[current];
     }
@@ -352,9 +351,8 @@ PathResult bellman_ford(Graph *graph, int start, int end) {
     }
   }
 
-  clock_t end_time = clock();
-  result.execution_time_ms =
-      ((double)(end_time - start_time) / CLOCKS_PER_SEC) * 1000.0;
+  result.timing = dsa_timing_since(start_time);
+  result.execution_time_ms = dsa_timing_ns_to_ms(result.timing.ns);
 
   return result;
 }
@@ -363,10 +361,10 @@ PathResult bellman_ford(Graph *graph, int start, int end) {
 // Algorithme de Floyd-Warshall
 // ============================================================================
 
-PathResult floyd_warshall(Graph *graph, int start, int end) {
-  PathResult result = {0};
+DsaPathResult dsa_floyd_warshall(DsaGraph *graph, int start, int end) {
+  DsaPathResult result = {0};
   result.found = false;
-  result.distance = INF;
+  result.distance = DSA_GRAPH_INF;
   result.path_length = 0;
   result.has_negative_cycle = false;
 
@@ -375,17 +373,17 @@ PathResult floyd_warshall(Graph *graph, int start, int end) {
     return result;
   }
 
-  clock_t start_time = clock();
+  DsaTimingMark start_time = dsa_timing_mark();
 
   int n = graph->num_vertices;
-  double dist[MAX_VERTICES][MAX_VERTICES];
-  int next[MAX_VERTICES][MAX_VERTICES];
+  double dist[DSA_GRAPH_MAX_VERTICES][DSA_GRAPH_MAX_VERTICES];
+  int next[DSA_GRAPH_MAX_VERTICES][DSA_GRAPH_MAX_VERTICES];
 
   // Initialisation
   for (int i = 0; i < n; i++) {
     for (int j = 0; j < n; j++) {
       dist[i][j] = graph->adj_matrix[i][j];
-      if (graph->adj_matrix[i][j] != INF && i != j) {
+      if (graph->adj_matrix[i][j] != DSA_GRAPH_INF && i != j) {
         next[i][j] = j;
       } else {
         next[i][j] = -1;
@@ -397,7 +395,7 @@ PathResult floyd_warshall(Graph *graph, int start, int end) {
   for (int k = 0; k < n; k++) {
     for (int i = 0; i < n; i++) {
       for (int j = 0; j < n; j++) {
-        if (dist[i][k] != INF && dist[k][j] != INF) {
+        if (dist[i][k] != DSA_GRAPH_INF && dist[k][j] != DSA_GRAPH_INF) {
           double new_dist = dist[i][k] + dist[k][j];
           if (new_dist < dist[i][j]) {
             dist[i][j] = new_dist;
@@ -412,15 +410,14 @@ PathResult floyd_warshall(Graph *graph, int start, int end) {
   for (int i = 0; i < n; i++) {
     if (dist[i][i] < 0) {
       result.has_negative_cycle = true;
-      clock_t end_time = clock();
-      result.execution_time_ms =
-          ((double)(end_time - start_time) / CLOCKS_PER_SEC) * 1000.0;
+      result.timing = dsa_timing_since(start_time);
+      result.execution_time_ms = dsa_timing_ns_to_ms(result.timing.ns);
       return result;
     }
   }
 
   // Reconstruction du chemin
-  if (dist[start][end] != INF) {
+  if (dist[start][end] != DSA_GRAPH_INF) {
     result.found = true;
     result.distance = dist[start][end];
 
@@ -428,7 +425,7 @@ PathResult floyd_warshall(Graph *graph, int start, int end) {
     result.path[0] = start;
     result.path_length = 1;
 
-    while (current != end && result.path_length < MAX_VERTICES) {
+    while (current != end && result.path_length < DSA_GRAPH_MAX_VERTICES) {
       current = next[current][end];
       if (current == -1) {
         result.found = false;
@@ -439,9 +436,8 @@ PathResult floyd_warshall(Graph *graph, int start, int end) {
     }
   }
 
-  clock_t end_time = clock();
-  result.execution_time_ms =
-      ((double)(end_time - start_time) / CLOCKS_PER_SEC) * 1000.0;
+  result.timing = dsa_timing_since(start_time);
+  result.execution_time_ms = dsa_timing_ns_to_ms(result.timing.ns);
 
   return result;
 }
@@ -450,16 +446,16 @@ PathResult floyd_warshall(Graph *graph, int start, int end) {
 // Fonction utilitaire pour exécuter un algorithme par type
 // ============================================================================
 
-PathResult execute_algorithm(Graph *graph, int start, int end,
-                             AlgorithmType algo) {
+DsaPathResult dsa_execute_algorithm(DsaGraph *graph, int start, int end,
+                                    DsaAlgorithmType algo) {
   switch (algo) {
-  case ALGO_DIJKSTRA:
-    return dijkstra(graph, start, end);
-  case ALGO_BELLMAN_FORD:
-    return bellman_ford(graph, start, end);
-  case ALGO_FLOYD_WARSHALL:
-    return floyd_warshall(graph, start, end);
+  case DSA_ALGO_DIJKSTRA:
+    return dsa_dijkstra(graph, start, end);
+  case DSA_ALGO_BELLMAN_FORD:
+    return dsa_bellman_ford(graph, start, end);
+  case DSA_ALGO_FLOYD_WARSHALL:
+    return dsa_floyd_warshall(graph, start, end);
   default:
-    return dijkstra(graph, start, end);
+    return dsa_dijkstra(graph, start, end);
   }
 }
@@ -1,28 +1,23 @@
 #ifndef GRAPH_ALGORITHMS_H
 #define GRAPH_ALGORITHMS_H
 
+#include "ds_types.h"
+#include "timing.h"
 #include <float.h>
 #include <limits.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 
-#define MAX_VERTICES 50
-#define INF DBL_MAX
-
-// Types de données pour les sommets
-typedef enum {
-  DATA_TYPE_INT,
-  DATA_TYPE_DOUBLE,
-  DATA_TYPE_CHAR,
-  DATA_TYPE_STRING
-} DataType;
+#define DSA_GRAPH_MAX_VERTICES 50
+#define DSA_GRAPH_INF DBL_MAX
 
 // Types d'algorithmes
 typedef enum {
-  ALGO_DIJKSTRA,
-  ALGO_BELLMAN_FORD,
-  ALGO_FLOYD_WARSHALL
-} AlgorithmType;
+  DSA_ALGO_DIJKSTRA,
+  DSA_ALGO_BELLMAN_FORD,
+  DSA_ALGO_FLOYD_WARSHALL
+} DsaAlgorithmType;
 
 // Valeur d'un sommet (union pour différents types)
 typedef union {
@@ -30,69 +25,72 @@ typedef union {
   double double_val;
   char char_val;
   char string_val[64];
-} NodeValue;
+} DsaNodeValue;
 
 // Structure d'un sommet
 typedef struct {
   int id;
-  NodeValue value;
+  DsaNodeValue value;
   double x, y; // Position pour le dessin
-} GraphNode;
+} DsaGraphNode;
 
 // Structure d'une arête
 typedef struct {
   int from;
   int to;
   double weight;
-} GraphEdge;
+} DsaGraphEdge;
 
 // Structure principale du graphe
 typedef struct {
   int num_vertices;
   int num_edges;
-  DataType data_type;
-  GraphNode nodes[MAX_VERTICES];
-  double adj_matrix[MAX_VERTICES]
-                   [MAX_VERTICES]; // Matrice d'adjacence avec poids
-  GraphEdge edges[MAX_VERTICES * MAX_VERTICES];
-} Graph;
+  DsaDataType data_type;
+  DsaGraphNode nodes[DSA_GRAPH_MAX_VERTICES];
+  double adj_matrix[DSA_GRAPH_MAX_VERTICES]
+                   [DSA_GRAPH_MAX_VERTICES]; // Matrice d'adjacence avec poids
+  DsaGraphEdge edges[DSA_GRAPH_MAX_VERTICES * DSA_GRAPH_MAX_VERTICES];
+} DsaGraph;
 
 // Résultat d'un algorithme de plus court chemin
 typedef struct {
   bool found;
   double distance;
-  int path[MAX_VERTICES];
+  int path[DSA_GRAPH_MAX_VERTICES];
   int path_length;
   double execution_time_ms;
+  DsaTimingSample timing;  // Durée détaillée (ns, cycles)
   bool has_negative_cycle; // Pour Bellman-Ford
-} PathResult;
+} DsaPathResult;
 
 // Fonctions de création/destruction
-Graph *graph_create(int num_vertices, DataType data_type);
-void graph_destroy(Graph *graph);
-void graph_reset(Graph *graph);
+DsaGraph *dsa_graph_create(int num_vertices, DsaDataType data_type);
+void dsa_graph_destroy(DsaGraph *graph);
+void dsa_graph_reset(DsaGraph *graph);
 
 // Gestion des arêtes
-void graph_add_edge(Graph *graph, int from, int to, double weight);
-void graph_remove_edge(Graph *graph, int from, int to);
-bool graph_has_edge(Graph *graph, int from, int to);
-double graph_get_weight(Graph *graph, int from, int to);
+void dsa_graph_add_edge(DsaGraph *graph, int from, int to, double weight);
+void dsa_graph_remove_edge(DsaGraph *graph, int from, int to);
+bool dsa_graph_has_edge(DsaGraph *graph, int from, int to);
+double dsa_graph_get_weight(DsaGraph *graph, int from, int to);
 
 // Fonctions pour les valeurs des sommets
-void graph_set_node_value_int(Graph *graph, int node_id, int value);
-void graph_set_node_value_double(Graph *graph, int node_id, double value);
-void graph_set_node_value_char(Graph *graph, int node_id, char value);
-void graph_set_node_value_string(Graph *graph, int node_id, const char *value);
-const char *graph_get_node_label(Graph *graph, int node_id, char *buffer,
-                                 size_t buffer_size);
+void dsa_graph_set_node_value_int(DsaGraph *graph, int node_id, int value);
+void dsa_graph_set_node_value_double(DsaGraph *graph, int node_id,
+                                     double value);
+void dsa_graph_set_node_value_char(DsaGraph *graph, int node_id, char value);
+void dsa_graph_set_node_value_string(DsaGraph *graph, int node_id,
+                                     const char *value);
+const char *dsa_graph_get_node_label(DsaGraph *graph, int node_id, char *buffer,
+                                     size_t buffer_size);
 
 // Algorithmes de plus court chemin
-PathResult dijkstra(Graph *graph, int start, int end);
-PathResult bellman_ford(Graph *graph, int start, int end);
-PathResult floyd_warshall(Graph *graph, int start, int end);
+DsaPathResult dsa_dijkstra(DsaGraph *graph, int start, int end);
+DsaPathResult dsa_bellman_ford(DsaGraph *graph, int start, int end);
+DsaPathResult dsa_floyd_warshall(DsaGraph *graph, int start, int end);
 
 // Fonction utilitaire pour exécuter un algorithme par type
-PathResult execute_algorithm(Graph *graph, int start, int end,
-                             AlgorithmType algo);
+DsaPathResult dsa_execute_algorithm(DsaGraph *graph, int start, int end,
+                                    DsaAlgorithmType algo);
 
 #endif // GRAPH_ALGORITHMS_H
@@ -1,5 +1,6 @@
 #include "graphs_window.h"
 #include "graph_algorithms.h"
+#include "prng.h"
 #include <gtk/gtk.h>
 #include <math.h>
 #include <stdio.h>
@@ -25,13 +26,13 @@ typedef struct {
   GtkWidget *execute_btn;
   GtkWidget *filling_mode_dropdown; // Nouveau dropdown
 
-  Graph *graph;
+  DsaGraph *graph;
   bool graph_drawn;
   int drag_start_node;   // Sommet de départ du drag (-1 si aucun)
   int drag_end_node;     // Sommet de fin du drag (-1 si aucun)
   bool is_dragging;      // En train de dessiner une arête
   double drag_x, drag_y; // Position actuelle de la souris pendant le drag
-  PathResult last_result;
+  DsaPathResult last_result;
 
   // Pour le dessin
   double center_x;
@@ -40,7 +41,7 @@ typedef struct {
 } GraphsWindowData;
 
 // Forward declarations of helper functions
-static void fill_graph_random(GraphsWindowData *data);
+static uint64_t fill_graph_random(GraphsWindowData *data);
 static void fill_graph_manual(GraphsWindowData *data);
 static void refresh_node_dropdowns(GraphsWindowData *data);
 
@@ -134,9 +135,9 @@ static void draw_graph(GtkDrawingArea *area, cairo_t *cr, int width, int height,
 
   // Dessiner les arêtes
   for (int i = 0; i < data->graph->num_edges; i++) {
-    GraphEdge *edge = &data->graph->edges[i];
-    GraphNode *from = &data->graph->nodes[edge->from];
-    GraphNode *to = &data->graph->nodes[edge->to];
+    DsaGraphEdge *edge = &data->graph->edges[i];
+    DsaGraphNode *from = &data->graph->nodes[edge->from];
+    DsaGraphNode *to = &data->graph->nodes[edge->to];
 
     // Couleur de l'arête (rouge si dans le chemin, gris sinon)
     bool in_path = is_edge_in_path(data, edge->from, edge->to);
@@ -231,7 +232,7 @@ static void draw_graph(GtkDrawingArea *area, cairo_t *cr, int width, int height,
 
   // Dessiner les sommets
   for (int i = 0; i < data->graph->num_vertices; i++) {
-    GraphNode *node = &data->graph->nodes[i];
+    DsaGraphNode *node = &data->graph->nodes[i];
 
     // Déterminer la couleur du sommet
     bool is_start =
@@ -273,7 +274,7 @@ static void draw_graph(GtkDrawingArea *area, cairo_t *cr, int width, int height,
 
     // Texte du label
     char label[64];
-    graph_get_node_label(data->graph, i, label, sizeof(label));
+    dsa_graph_get_node_label(data->graph, i, label, sizeof(label));
 
     cairo_set_source_rgb(cr, 1.0, 1.0, 1.0);
     cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL,
@@ -290,7 +291,7 @@ static void draw_graph(GtkDrawingArea *area, cairo_t *cr, int width, int height,
 
   // Afficher la ligne de drag en cours
   if (data->is_dragging && data->drag_start_node >= 0) {
-    GraphNode *start = &data->graph->nodes[data->drag_start_node];
+    DsaGraphNode *start = &data->graph->nodes[data->drag_start_node];
 
     // Ligne en pointillé de couleur jaune
     cairo_set_source_rgba(cr, 1.0, 1.0, 0.0, 0.8);
@@ -315,7 +316,7 @@ static void draw_graph(GtkDrawingArea *area, cairo_t *cr, int width, int height,
 
     // Highlight du sommet de fin si on survole un sommet
     if (data->drag_end_node >= 0) {
-      GraphNode *end = &data->graph->nodes[data->drag_end_node];
+      DsaGraphNode *end = &data->graph->nodes[data->drag_end_node];
       cairo_set_source_rgba(cr, 0.0, 1.0, 0.0, 0.6);
       cairo_set_line_width(cr, 4.0);
       cairo_arc(cr, end->x, end->y, node_radius + 5, 0, 2 * M_PI);
@@ -347,7 +348,7 @@ static void popover_on_ok_clicked(GtkWidget *widget, gpointer user_data) {
     weight = 1.0; // Valeur par défaut si la saisie est invalide
   }
 
-  graph_add_edge(pd->graph_data->graph, pd->from, pd->to, weight);
+  dsa_graph_add_edge(pd->graph_data->graph, pd->from, pd->to, weight);
   gtk_widget_queue_draw(pd->graph_data->drawing_area);
 
   gtk_popover_popdown(GTK_POPOVER(pd->popover));
@@ -387,8 +388,8 @@ static void show_weight_popover(GraphsWindowData *data, int from, int to,
 
   char label_text[128];
   char from_label[64], to_label[64];
-  graph_get_node_label(data->graph, from, from_label, sizeof(from_label));
-  graph_get_node_label(data->graph, to, to_label, sizeof(to_label));
+  dsa_graph_get_node_label(data->graph, from, from_label, sizeof(from_label));
+  dsa_graph_get_node_label(data->graph, to, to_label, sizeof(to_label));
   snprintf(label_text, sizeof(label_text), "Poids %s → %s:", from_label,
            to_label);
 
@@ -492,11 +493,11 @@ static void on_drag_end(GtkGestureDrag *gesture, double offset_x,
   // Si on a relâché sur un sommet différent, créer l'arête
   if (end_node >= 0 && end_node != data->drag_start_node) {
     // Vérifier si l'arête existe déjà
-    if (!graph_has_edge(data->graph, data->drag_start_node, end_node)) {
+    if (!dsa_graph_has_edge(data->graph, data->drag_start_node, end_node)) {
       // Calculer le point milieu entre les deux sommets pour positionner le
       // popover
-      GraphNode *from_n = &data->graph->nodes[data->drag_start_node];
-      GraphNode *to_n = &data->graph->nodes[end_node];
+      DsaGraphNode *from_n = &data->graph->nodes[data->drag_start_node];
+      DsaGraphNode *to_n = &data->graph->nodes[end_node];
       double mid_x = (from_n->x + to_n->x) / 2;
       double mid_y = (from_n->y + to_n->y) / 2;
       show_weight_popover(data, data->drag_start_node, end_node, mid_x, mid_y);
@@ -525,7 +526,7 @@ static void on_clear_graph_clicked(GtkWidget *widget, gpointer user_data) {
   GraphsWindowData *data = (GraphsWindowData *)user_data;
 
   if (data->graph) {
-    graph_destroy(data->graph);
+    dsa_graph_destroy(data->graph);
     data->graph = NULL;
   }
 
@@ -555,17 +556,17 @@ static void on_draw_graph_clicked(GtkWidget *widget, gpointer user_data) {
 
   // Détruire l'ancien graphe si existant
   if (data->graph) {
-    graph_destroy(data->graph);
+    dsa_graph_destroy(data->graph);
   }
 
   // Récupérer les paramètres
   int num_vertices =
       (int)gtk_spin_button_get_value(GTK_SPIN_BUTTON(data->num_vertices_spin));
-  DataType data_type = (DataType)gtk_drop_down_get_selected(
+  DsaDataType data_type = (DsaDataType)gtk_drop_down_get_selected(
       GTK_DROP_DOWN(data->data_type_dropdown));
 
   // Créer le nouveau graphe
-  data->graph = graph_create(num_vertices, data_type);
+  data->graph = dsa_graph_create(num_vertices, data_type);
   data->graph_drawn = true;
   data->is_dragging = false;
   data->drag_start_node = -1;
@@ -577,7 +578,7 @@ static void on_draw_graph_clicked(GtkWidget *widget, gpointer user_data) {
 
   for (int i = 0; i < num_vertices; i++) {
     char label[64];
-    graph_get_node_label(data->graph, i, label, sizeof(label));
+    dsa_graph_get_node_label(data->graph, i, label, sizeof(label));
     gtk_string_list_append(node_list, label);
   }
 
@@ -599,12 +600,15 @@ static void on_draw_graph_clicked(GtkWidget *widget, gpointer user_data) {
 
   // Appliquer le remplissage si nécessaire
   if (fill_mode == 1) { // Aléatoire
-    fill_graph_random(data);
+    uint64_t seed = fill_graph_random(data);
     // Mettre à jour les dropdowns après remplissage aléatoire
     refresh_node_dropdowns(data);
-    gtk_label_set_text(GTK_LABEL(data->result_label),
-                       "Graphe créé et rempli aléatoirement. Cliquez sur deux "
-                       "sommets pour créer une arête.");
+    char msg[160];
+    snprintf(msg, sizeof(msg),
+             "Graphe créé et rempli aléatoirement (graine %llu). Cliquez sur "
+             "deux sommets pour créer une arête.",
+             (unsigned long long)seed);
+    gtk_label_set_text(GTK_LABEL(data->result_label), msg);
   } else if (fill_mode == 2) { // Manuel
     gtk_label_set_text(GTK_LABEL(data->result_label),
                        "Graphe créé. Remplissage manuel en cours...");
@@ -642,30 +646,39 @@ static void on_execute_algorithm_clicked(GtkWidget *widget,
   int start =
       gtk_drop_down_get_selected(GTK_DROP_DOWN(data->start_node_dropdown));
   int end = gtk_drop_down_get_selected(GTK_DROP_DOWN(data->end_node_dropdown));
-  AlgorithmType algo = (AlgorithmType)gtk_drop_down_get_selected(
+  DsaAlgorithmType algo = (DsaAlgorithmType)gtk_drop_down_get_selected(
       GTK_DROP_DOWN(data->algorithm_dropdown));
 
   // Exécuter l'algorithme
-  data->last_result = execute_algorithm(data->graph, start, end, algo);
+  data->last_result = dsa_execute_algorithm(data->graph, start, end, algo);
+
+  // Durée mesurée (horloge monotone, en µs) et cycles processeur
+  char time_str[96];
+  if (dsa_timing_has_cycles()) {
+    snprintf(time_str, sizeof(time_str), "%.3f µs (%llu cycles)",
+             data->last_result.timing.ns / 1e3,
+             (unsigned long long)data->last_result.timing.cycles);
+  } else {
+    snprintf(time_str, sizeof(time_str), "%.3f µs",
+             data->last_result.timing.ns / 1e3);
+  }
 
   // Afficher le résultat
   char result_text[512];
 
   if (data->last_result.has_negative_cycle) {
     snprintf(result_text, sizeof(result_text),
-             "❌ Cycle négatif détecté !\nTemps: %.3f ms",
-             data->last_result.execution_time_ms);
+             "❌ Cycle négatif détecté !\nTemps: %s", time_str);
   } else if (!data->last_result.found) {
     snprintf(result_text, sizeof(result_text),
-             "❌ Aucun chemin trouvé.\nTemps: %.3f ms",
-             data->last_result.execution_time_ms);
+             "❌ Aucun chemin trouvé.\nTemps: %s", time_str);
   } else {
     // Construire le chemin en texte
     char path_str[256] = "";
     for (int i = 0; i < data->last_result.path_length; i++) {
       char label[64];
-      graph_get_node_label(data->graph, data->last_result.path[i], label,
-                           sizeof(label));
+      dsa_graph_get_node_label(data->graph, data->last_result.path[i], label,
+                               sizeof(label));
       strcat(path_str, label);
       if (i < data->last_result.path_length - 1) {
         strcat(path_str, " → ");
@@ -673,9 +686,8 @@ static void on_execute_algorithm_clicked(GtkWidget *widget,
     }
 
     snprintf(result_text, sizeof(result_text),
-             "✓ Chemin trouvé !\nChemin: %s\nDistance: %.2f\nTemps: %.3f ms",
-             path_str, data->last_result.distance,
-             data->last_result.execution_time_ms);
+             "✓ Chemin trouvé !\nChemin: %s\nDistance: %.2f\nTemps: %s",
+             path_str, data->last_result.distance, time_str);
   }
 
   gtk_label_set_text(GTK_LABEL(data->result_label), result_text);
@@ -686,7 +698,7 @@ static void on_window_destroy(GtkWidget *widget, gpointer user_data) {
   GraphsWindowData *data = (GraphsWindowData *)user_data;
 
   if (data->graph) {
-    graph_destroy(data->graph);
+    dsa_graph_destroy(data->graph);
   }
 
   g_free(data);
@@ -705,7 +717,7 @@ static void refresh_node_dropdowns(GraphsWindowData *data) {
 
   for (int i = 0; i < data->graph->num_vertices; i++) {
     char label[64];
-    graph_get_node_label(data->graph, i, label, sizeof(label));
+    dsa_graph_get_node_label(data->graph, i, label, sizeof(label));
     gtk_string_list_append(node_list, label);
   }
 
@@ -733,11 +745,14 @@ static void refresh_node_dropdowns(GraphsWindowData *data) {
                              current_end);
 }
 
-static void fill_graph_random(GraphsWindowData *data) {
+// Retourne la graine utilisée, affichée pour pouvoir rejouer le tirage
+static uint64_t fill_graph_random(GraphsWindowData *data) {
   if (!data->graph)
-    return;
+    return 0;
 
-  srand(time(NULL));
+  uint64_t seed = dsa_prng_fresh_seed();
+  DsaPrng rng;
+  dsa_prng_seed(&rng, seed);
 
   for (int i = 0; i < data->graph->num_vertices; i++) {
     bool unique;
@@ -745,21 +760,23 @@ static void fill_graph_random(GraphsWindowData *data) {
       unique = true;
       // Générer une valeur candidate
       switch (data->graph->data_type) {
-      case DATA_TYPE_INT:
-        graph_set_node_value_int(data->graph, i, rand() % 100);
+      case DSA_TYPE_INT:
+        dsa_graph_set_node_value_int(data->graph, i,
+                                     (int)dsa_prng_bounded(&rng, 100));
         break;
-      case DATA_TYPE_DOUBLE: {
-        double val = (double)rand() / RAND_MAX * 100.0;
-        graph_set_node_value_double(data->graph, i, val);
+      case DSA_TYPE_FLOAT: {
+        double val = dsa_prng_double(&rng) * 100.0;
+        dsa_graph_set_node_value_double(data->graph, i, val);
         break;
       }
-      case DATA_TYPE_CHAR:
-        graph_set_node_value_char(data->graph, i, 'A' + (rand() % 26));
+      case DSA_TYPE_CHAR:
+        dsa_graph_set_node_value_char(data->graph, i,
+                                      'A' + (char)dsa_prng_bounded(&rng, 26));
         break;
-      case DATA_TYPE_STRING: {
+      case DSA_TYPE_STRING: {
         char buf[32];
-        snprintf(buf, sizeof(buf), "S%d_%d", i, rand() % 100);
-        graph_set_node_value_string(data->graph, i, buf);
+        snprintf(buf, sizeof(buf), "S%d_%u", i, dsa_prng_bounded(&rng, 100));
+        dsa_graph_set_node_value_string(data->graph, i, buf);
         break;
       }
       }
@@ -767,25 +784,25 @@ static void fill_graph_random(GraphsWindowData *data) {
       // Vérifier l'unicité par rapport aux précédents
       for (int j = 0; j < i; j++) {
         switch (data->graph->data_type) {
-        case DATA_TYPE_INT:
+        case DSA_TYPE_INT:
           if (data->graph->nodes[i].value.int_val ==
               data->graph->nodes[j].value.int_val) {
             unique = false;
           }
           break;
-        case DATA_TYPE_DOUBLE:
+        case DSA_TYPE_FLOAT:
           if (fabs(data->graph->nodes[i].value.double_val -
                    data->graph->nodes[j].value.double_val) < 0.01) {
             unique = false;
           }
           break;
-        case DATA_TYPE_CHAR:
+        case DSA_TYPE_CHAR:
           if (data->graph->nodes[i].value.char_val ==
               data->graph->nodes[j].value.char_val) {
             unique = false;
           }
           break;
-        case DATA_TYPE_STRING:
+        case DSA_TYPE_STRING:
           if (strcmp(data->graph->nodes[i].value.string_val,
                      data->graph->nodes[j].value.string_val) == 0) {
             unique = false;
@@ -797,6 +814,7 @@ static void fill_graph_random(GraphsWindowData *data) {
       }
     } while (!unique);
   }
+  return seed;
 }
 
 // ============================================================================
@@ -820,7 +838,7 @@ static void on_manual_fill_validate(GtkWidget *widget, gpointer user_data) {
     const char *text = gtk_editable_get_text(GTK_EDITABLE(mf_data->entries[i]));
 
     switch (data->graph->data_type) {
-    case DATA_TYPE_INT: {
+    case DSA_TYPE_INT: {
       char *endptr;
       strtol(text, &endptr, 10);
       if (*endptr != '\0' || strlen(text) == 0) {
@@ -830,7 +848,7 @@ static void on_manual_fill_validate(GtkWidget *widget, gpointer user_data) {
       }
       break;
     }
-    case DATA_TYPE_DOUBLE: {
+    case DSA_TYPE_FLOAT: {
       char *endptr;
       strtod(text, &endptr);
       if (*endptr != '\0' || strlen(text) == 0) {
@@ -840,7 +858,7 @@ static void on_manual_fill_validate(GtkWidget *widget, gpointer user_data) {
       }
       break;
     }
-    case DATA_TYPE_CHAR:
+    case DSA_TYPE_CHAR:
       if (strlen(text) != 1) {
         all_valid = false;
         snprintf(error_msg, sizeof(error_msg),
@@ -848,7 +866,7 @@ static void on_manual_fill_validate(GtkWidget *widget, gpointer user_data) {
                  i);
       }
       break;
-    case DATA_TYPE_STRING:
+    case DSA_TYPE_STRING:
       if (strlen(text) == 0) {
         all_valid = false;
         snprintf(error_msg, sizeof(error_msg),
@@ -875,17 +893,17 @@ static void on_manual_fill_validate(GtkWidget *widget, gpointer user_data) {
   for (int i = 0; i < data->graph->num_vertices; i++) {
     const char *text = gtk_editable_get_text(GTK_EDITABLE(mf_data->entries[i]));
     switch (data->graph->data_type) {
-    case DATA_TYPE_INT:
-      graph_set_node_value_int(data->graph, i, atoi(text));
+    case DSA_TYPE_INT:
+      dsa_graph_set_node_value_int(data->graph, i, atoi(text));
       break;
-    case DATA_TYPE_DOUBLE:
-      graph_set_node_value_double(data->graph, i, atof(text));
+    case DSA_TYPE_FLOAT:
+      dsa_graph_set_node_value_double(data->graph, i, atof(text));
       break;
-    case DATA_TYPE_CHAR:
-      graph_set_node_value_char(data->graph, i, text[0]);
+    case DSA_TYPE_CHAR:
+      dsa_graph_set_node_value_char(data->graph, i, text[0]);
       break;
-    case DATA_TYPE_STRING:
-      graph_set_node_value_string(data->graph, i, text);
+    case DSA_TYPE_STRING:
+      dsa_graph_set_node_value_string(data->graph, i, text);
       break;
     }
   }
@@ -946,7 +964,7 @@ static void fill_graph_manual(GraphsWindowData *data) {
 
     // Valeur actuelle comme défaut
     char val_str[64];
-    graph_get_node_label(data->graph, i, val_str, sizeof(val_str));
+    dsa_graph_get_node_label(data->graph, i, val_str, sizeof(val_str));
     gtk_editable_set_text(GTK_EDITABLE(entry), val_str);
 
     gtk_box_append(GTK_BOX(row), entry);
@@ -1022,7 +1040,7 @@ void open_graphs_window(GtkWindow *parent) {
   gtk_string_list_append(data_types, "Chaîne");
   data->data_type_dropdown = gtk_drop_down_new(G_LIST_MODEL(data_types), NULL);
   gtk_drop_down_set_selected(GTK_DROP_DOWN(data->data_type_dropdown),
-                             DATA_TYPE_CHAR);
+                             DSA_TYPE_CHAR);
   gtk_box_append(GTK_BOX(left_panel), data->data_type_dropdown);
 
   // Type de chemin
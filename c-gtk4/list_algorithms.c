@@ -1,44 +1,97 @@
 #include "list_algorithms.h"
+#include "prng.h"
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <time.h>
+
+// Réserve de nœuds des listes créées ensuite (dsa_list_set_node_pool)
+static bool list_node_pool = true;
+
+void dsa_list_set_node_pool(bool enabled) { list_node_pool = enabled; }
+
+bool dsa_list_get_node_pool(void) { return list_node_pool; }
+
+// Index par position des listes créées ensuite (dsa_list_set_position_index)
+static bool list_position_index = true;
+
+void dsa_list_set_position_index(
+    bool enabled) { list_position_index = enabled; }
+
+bool dsa_list_get_position_index(void) { return list_position_index; }
+
+// Index de la liste, construit au premier accès par position ; NULL pour
+// les petites listes, si l'index est désactivé ou si la mémoire manque
+static DsaListIndex *simple_list_index(DsaSimpleList *list) {
+  if (!list->index && list->indexed && list->size > DSA_LIST_INDEX_MIN_SIZE)
+    list->index = dsa_list_index_build(list->head, list->size,
+                                       offsetof(DsaSimpleNode, next));
+  return list->index;
+}
+
+static DsaListIndex *double_list_index(DsaDoubleList *list) {
+  if (!list->index && list->indexed && list->size > DSA_LIST_INDEX_MIN_SIZE)
+    list->index = dsa_list_index_build(list->head, list->size,
+                                       offsetof(DsaDoubleNode, next));
+  return list->index;
+}
+
+// À appeler quand les nœuds sont réchaînés (l'index sera reconstruit)
+static void drop_simple_index(DsaSimpleList *list) {
+  dsa_list_index_free(list->index);
+  list->index = NULL;
+}
+
+static void drop_double_index(DsaDoubleList *list) {
+  dsa_list_index_free(list->index);
+  list->index = NULL;
+}
 
 // ============================================================================
 // Fonctions pour listes simples
 // ============================================================================
 
-SimpleList *create_simple_list(DataType type) {
-  SimpleList *list = (SimpleList *)malloc(sizeof(SimpleList));
+DsaSimpleList *dsa_create_simple_list(DsaDataType type) {
+  DsaSimpleList *list = (DsaSimpleList *)malloc(sizeof(DsaSimpleList));
   if (list) {
     list->head = NULL;
+    list->tail = NULL;
     list->type = type;
     list->size = 0;
+    dsa_node_pool_init(&list->pool, sizeof(DsaSimpleNode), list_node_pool);
+    list->indexed = list_position_index;
+    list->index = NULL;
   }
   return list;
 }
 
-void free_simple_list(SimpleList *list) {
+// Les nœuds sont libérés avec les blocs de la réserve : la liste n'est
+// parcourue que pour ses chaînes (ou si la réserve est désactivée)
+void dsa_free_simple_list(DsaSimpleList *list) {
   if (!list)
     return;
 
-  SimpleNode *current = list->head;
-  while (current) {
-    SimpleNode *next = current->next;
-    if (list->type == TYPE_STRING && current->data.string_val) {
-      free(current->data.string_val);
+  if (list->type == DSA_TYPE_STRING || !list->pool.enabled) {
+    DsaSimpleNode *current = list->head;
+    while (current) {
+      DsaSimpleNode *next = current->next;
+      if (list->type == DSA_TYPE_STRING && current->data.string_val) {
+        free(current->data.string_val);
+      }
+      dsa_node_pool_free(&list->pool, current);
+      current = next;
     }
-    free(current);
-    current = next;
   }
+  dsa_list_index_free(list->index);
+  dsa_node_pool_release(&list->pool);
   free(list);
 }
 
-bool insert_simple_at_beginning(SimpleList *list, NodeData data) {
+bool dsa_insert_simple_at_beginning(DsaSimpleList *list, DsaNodeData data) {
   if (!list)
     return false;
 
-  SimpleNode *new_node = (SimpleNode *)malloc(sizeof(SimpleNode));
+  DsaSimpleNode *new_node = (DsaSimpleNode *)dsa_node_pool_alloc(&list->pool);
   if (!new_node)
     return false;
 
@@ -46,15 +99,19 @@ bool insert_simple_at_beginning(SimpleList *list, NodeData data) {
   new_node->data = data;
   new_node->next = list->head;
   list->head = new_node;
+  if (!list->tail)
+    list->tail = new_node;
   list->size++;
+  if (list->index)
+    dsa_list_index_insert(list->index, 0, new_node);
   return true;
 }
 
-bool insert_simple_at_end(SimpleList *list, NodeData data) {
+bool dsa_insert_simple_at_end(DsaSimpleList *list, DsaNodeData data) {
   if (!list)
     return false;
 
-  SimpleNode *new_node = (SimpleNode *)malloc(sizeof(SimpleNode));
+  DsaSimpleNode *new_node = (DsaSimpleNode *)dsa_node_pool_alloc(&list->pool);
   if (!new_node)
     return false;
 
@@ -62,132 +119,217 @@ bool insert_simple_at_end(SimpleList *list, NodeData data) {
   new_node->data = data;
   new_node->next = NULL;
 
-  if (!list->head) {
-    list->head = new_node;
+  if (list->tail) {
+    list->tail->next = new_node;
   } else {
-    SimpleNode *current = list->head;
-    while (current->next) {
-      current = current->next;
-    }
-    current->next = new_node;
+    list->head = new_node;
   }
+  list->tail = new_node;
   list->size++;
+  if (list->index)
+    dsa_list_index_insert(list->index, list->size - 1, new_node);
   return true;
 }
 
-bool insert_simple_at_position(SimpleList *list, NodeData data, int position) {
+bool dsa_insert_simple_at_position(DsaSimpleList *list, DsaNodeData data,
+                                   int position) {
   if (!list || position < 0 || position > list->size)
     return false;
 
   if (position == 0)
-    return insert_simple_at_beginning(list, data);
+    return dsa_insert_simple_at_beginning(list, data);
+  if (position == list->size)
+    return dsa_insert_simple_at_end(list, data);
 
-  SimpleNode *new_node = (SimpleNode *)malloc(sizeof(SimpleNode));
+  DsaSimpleNode *new_node = (DsaSimpleNode *)dsa_node_pool_alloc(&list->pool);
   if (!new_node)
     return false;
 
   new_node->type = list->type;
   new_node->data = data;
 
-  SimpleNode *current = list->head;
-  for (int i = 0; i < position - 1; i++) {
-    current = current->next;
-  }
-
-  new_node->next = current->next;
-  current->next = new_node;
+  DsaSimpleNode *previous = dsa_get_simple_node_at(list, position - 1);
+  new_node->next = previous->next;
+  previous->next = new_node;
   list->size++;
+  if (list->index)
+    dsa_list_index_insert(list->index, position, new_node);
   return true;
 }
 
-bool delete_simple_at_position(SimpleList *list, int position) {
+bool dsa_delete_simple_at_position(DsaSimpleList *list, int position) {
   if (!list || !list->head || position < 0 || position >= list->size)
     return false;
 
-  SimpleNode *to_delete;
+  DsaSimpleNode *to_delete;
+  DsaSimpleNode *previous = NULL;
 
   if (position == 0) {
     to_delete = list->head;
     list->head = list->head->next;
   } else {
-    SimpleNode *current = list->head;
-    for (int i = 0; i < position - 1; i++) {
-      current = current->next;
-    }
-    to_delete = current->next;
-    current->next = to_delete->next;
+    previous = dsa_get_simple_node_at(list, position - 1);
+    to_delete = previous->next;
+    previous->next = to_delete->next;
   }
+  if (to_delete == list->tail)
+    list->tail = previous;
+  if (list->index)
+    dsa_list_index_delete(list->index, position);
 
-  if (list->type == TYPE_STRING && to_delete->data.string_val) {
+  if (list->type == DSA_TYPE_STRING && to_delete->data.string_val) {
     free(to_delete->data.string_val);
   }
-  free(to_delete);
+  dsa_node_pool_free(&list->pool, to_delete);
   list->size--;
   return true;
 }
 
-bool modify_simple_at_position(SimpleList *list, NodeData data, int position) {
+bool dsa_modify_simple_at_position(DsaSimpleList *list, DsaNodeData data,
+                                   int position) {
   if (!list || position < 0 || position >= list->size)
     return false;
 
-  SimpleNode *node = get_simple_node_at(list, position);
+  DsaSimpleNode *node = dsa_get_simple_node_at(list, position);
   if (!node)
     return false;
 
-  if (list->type == TYPE_STRING && node->data.string_val) {
+  if (list->type == DSA_TYPE_STRING && node->data.string_val) {
     free(node->data.string_val);
   }
   node->data = data;
   return true;
 }
 
-SimpleNode *get_simple_node_at(SimpleList *list, int position) {
+DsaSimpleNode *dsa_get_simple_node_at(DsaSimpleList *list, int position) {
   if (!list || position < 0 || position >= list->size)
     return NULL;
-
-  SimpleNode *current = list->head;
-  for (int i = 0; i < position; i++) {
+  if (position == list->size - 1)
+    return list->tail;
+
+  // Dernier nœud indexé avant la position, puis quelques liens `next`
+  DsaSimpleNode *current = list->head;
+  int at = 0;
+  DsaListIndex *index = simple_list_index(list);
+  if (index) {
+    int found;
+    DsaSimpleNode *node =
+        (DsaSimpleNode *)dsa_list_index_seek(index, position, &found);
+    if (node) {
+      current = node;
+      at = found;
+    }
+  }
+  for (; at < position; at++) {
     current = current->next;
   }
   return current;
 }
 
+bool dsa_append_simple_values(DsaSimpleList *list, const DsaNodeData *values,
+                              int count) {
+  if (!list || count < 0)
+    return false;
+
+  // Nouveaux nœuds chaînés à part, raccordés à la queue une fois tous
+  // alloués
+  DsaSimpleNode *first = NULL;
+  DsaSimpleNode *last = NULL;
+  for (int i = 0; i < count; i++) {
+    DsaSimpleNode *node = (DsaSimpleNode *)dsa_node_pool_alloc(&list->pool);
+    if (!node) {
+      while (first) {
+        DsaSimpleNode *next = first->next;
+        dsa_node_pool_free(&list->pool, first);
+        first = next;
+      }
+      return false;
+    }
+    node->type = list->type;
+    node->data = values[i];
+    node->next = NULL;
+    if (last)
+      last->next = node;
+    else
+      first = node;
+    last = node;
+  }
+
+  if (!first)
+    return true;
+  if (list->tail)
+    list->tail->next = first;
+  else
+    list->head = first;
+  list->tail = last;
+  list->size += count;
+  drop_simple_index(list);
+  return true;
+}
+
+DsaSimpleList *dsa_copy_simple_list(const DsaSimpleList *list) {
+  if (!list)
+    return NULL;
+  DsaSimpleList *copy = dsa_create_simple_list(list->type);
+  if (!copy)
+    return NULL;
+  for (DsaSimpleNode *node = list->head; node; node = node->next) {
+    DsaNodeData data = dsa_copy_node_data(node->data, list->type);
+    if ((list->type == DSA_TYPE_STRING && node->data.string_val &&
+         !data.string_val) ||
+        !dsa_insert_simple_at_end(copy, data)) {
+      if (list->type == DSA_TYPE_STRING)
+        free(data.string_val);
+      dsa_free_simple_list(copy);
+      return NULL;
+    }
+  }
+  return copy;
+}
+
 // ============================================================================
 // Fonctions pour listes doubles
 // ============================================================================
 
-DoubleList *create_double_list(DataType type) {
-  DoubleList *list = (DoubleList *)malloc(sizeof(DoubleList));
+DsaDoubleList *dsa_create_double_list(DsaDataType type) {
+  DsaDoubleList *list = (DsaDoubleList *)malloc(sizeof(DsaDoubleList));
   if (list) {
     list->head = NULL;
     list->tail = NULL;
     list->type = type;
     list->size = 0;
+    dsa_node_pool_init(&list->pool, sizeof(DsaDoubleNode), list_node_pool);
+    list->indexed = list_position_index;
+    list->index = NULL;
   }
   return list;
 }
 
-void free_double_list(DoubleList *list) {
+void dsa_free_double_list(DsaDoubleList *list) {
   if (!list)
     return;
 
-  DoubleNode *current = list->head;
-  while (current) {
-    DoubleNode *next = current->next;
-    if (list->type == TYPE_STRING && current->data.string_val) {
-      free(current->data.string_val);
+  if (list->type == DSA_TYPE_STRING || !list->pool.enabled) {
+    DsaDoubleNode *current = list->head;
+    while (current) {
+      DsaDoubleNode *next = current->next;
+      if (list->type == DSA_TYPE_STRING && current->data.string_val) {
+        free(current->data.string_val);
+      }
+      dsa_node_pool_free(&list->pool, current);
+      current = next;
     }
-    free(current);
-    current = next;
   }
+  dsa_list_index_free(list->index);
+  dsa_node_pool_release(&list->pool);
   free(list);
 }
 
-bool insert_double_at_beginning(DoubleList *list, NodeData data) {
+bool dsa_insert_double_at_beginning(DsaDoubleList *list, DsaNodeData data) {
   if (!list)
     return false;
 
-  DoubleNode *new_node = (DoubleNode *)malloc(sizeof(DoubleNode));
+  DsaDoubleNode *new_node = (DsaDoubleNode *)dsa_node_pool_alloc(&list->pool);
   if (!new_node)
     return false;
 
@@ -204,14 +346,16 @@ bool insert_double_at_beginning(DoubleList *list, NodeData data) {
 
   list->head = new_node;
   list->size++;
+  if (list->index)
+    dsa_list_index_insert(list->index, 0, new_node);
   return true;
 }
 
-bool insert_double_at_end(DoubleList *list, NodeData data) {
+bool dsa_insert_double_at_end(DsaDoubleList *list, DsaNodeData data) {
   if (!list)
     return false;
 
-  DoubleNode *new_node = (DoubleNode *)malloc(sizeof(DoubleNode));
+  DsaDoubleNode *new_node = (DsaDoubleNode *)dsa_node_pool_alloc(&list->pool);
   if (!new_node)
     return false;
 
@@ -228,44 +372,45 @@ bool insert_double_at_end(DoubleList *list, NodeData data) {
 
   list->tail = new_node;
   list->size++;
+  if (list->index)
+    dsa_list_index_insert(list->index, list->size - 1, new_node);
   return true;
 }
 
-bool insert_double_at_position(DoubleList *list, NodeData data, int position) {
+bool dsa_insert_double_at_position(DsaDoubleList *list, DsaNodeData data,
+                                   int position) {
   if (!list || position < 0 || position > list->size)
     return false;
 
   if (position == 0)
-    return insert_double_at_beginning(list, data);
+    return dsa_insert_double_at_beginning(list, data);
   if (position == list->size)
-    return insert_double_at_end(list, data);
+    return dsa_insert_double_at_end(list, data);
 
-  DoubleNode *new_node = (DoubleNode *)malloc(sizeof(DoubleNode));
+  DsaDoubleNode *new_node = (DsaDoubleNode *)dsa_node_pool_alloc(&list->pool);
   if (!new_node)
     return false;
 
   new_node->type = list->type;
   new_node->data = data;
 
-  DoubleNode *current = list->head;
-  for (int i = 0; i < position; i++) {
-    current = current->next;
-  }
-
+  DsaDoubleNode *current = dsa_get_double_node_at(list, position);
   new_node->next = current;
   new_node->prev = current->prev;
   current->prev->next = new_node;
   current->prev = new_node;
 
   list->size++;
+  if (list->index)
+    dsa_list_index_insert(list->index, position, new_node);
   return true;
 }
 
-bool delete_double_at_position(DoubleList *list, int position) {
+bool dsa_delete_double_at_position(DsaDoubleList *list, int position) {
   if (!list || !list->head || position < 0 || position >= list->size)
     return false;
 
-  DoubleNode *to_delete = get_double_node_at(list, position);
+  DsaDoubleNode *to_delete = dsa_get_double_node_at(list, position);
   if (!to_delete)
     return false;
 
@@ -280,57 +425,305 @@ bool delete_double_at_position(DoubleList *list, int position) {
   } else {
     list->tail = to_delete->prev;
   }
+  if (list->index)
+    dsa_list_index_delete(list->index, position);
 
-  if (list->type == TYPE_STRING && to_delete->data.string_val) {
+  if (list->type == DSA_TYPE_STRING && to_delete->data.string_val) {
     free(to_delete->data.string_val);
   }
-  free(to_delete);
+  dsa_node_pool_free(&list->pool, to_delete);
   list->size--;
   return true;
 }
 
-bool modify_double_at_position(DoubleList *list, NodeData data, int position) {
+bool dsa_modify_double_at_position(DsaDoubleList *list, DsaNodeData data,
+                                   int position) {
   if (!list || position < 0 || position >= list->size)
     return false;
 
-  DoubleNode *node = get_double_node_at(list, position);
+  DsaDoubleNode *node = dsa_get_double_node_at(list, position);
   if (!node)
     return false;
 
-  if (list->type == TYPE_STRING && node->data.string_val) {
+  if (list->type == DSA_TYPE_STRING && node->data.string_val) {
     free(node->data.string_val);
   }
   node->data = data;
   return true;
 }
 
-DoubleNode *get_double_node_at(DoubleList *list, int position) {
+DsaDoubleNode *dsa_get_double_node_at(DsaDoubleList *list, int position) {
   if (!list || position < 0 || position >= list->size)
     return NULL;
 
-  DoubleNode *current = list->head;
-  for (int i = 0; i < position; i++) {
-    current = current->next;
+  DsaListIndex *index = double_list_index(list);
+  if (index) {
+    int at;
+    DsaDoubleNode *current =
+        (DsaDoubleNode *)dsa_list_index_seek(index, position, &at);
+    if (!current) {
+      current = list->head;
+      at = 0;
+    }
+    for (; at < position; at++)
+      current = current->next;
+    return current;
   }
+
+  // Sans index : depuis l'extrémité la plus proche
+  if (position < list->size / 2) {
+    DsaDoubleNode *current = list->head;
+    for (int i = 0; i < position; i++)
+      current = current->next;
+    return current;
+  }
+  DsaDoubleNode *current = list->tail;
+  for (int i = list->size - 1; i > position; i--)
+    current = current->prev;
   return current;
 }
 
+bool dsa_append_double_values(DsaDoubleList *list, const DsaNodeData *values,
+                              int count) {
+  if (!list || count < 0)
+    return false;
+
+  DsaDoubleNode *first = NULL;
+  DsaDoubleNode *last = NULL;
+  for (int i = 0; i < count; i++) {
+    DsaDoubleNode *node = (DsaDoubleNode *)dsa_node_pool_alloc(&list->pool);
+    if (!node) {
+      while (first) {
+        DsaDoubleNode *next = first->next;
+        dsa_node_pool_free(&list->pool, first);
+        first = next;
+      }
+      return false;
+    }
+    node->type = list->type;
+    node->data = values[i];
+    node->next = NULL;
+    node->prev = last;
+    if (last)
+      last->next = node;
+    else
+      first = node;
+    last = node;
+  }
+
+  if (!first)
+    return true;
+  first->prev = list->tail;
+  if (list->tail)
+    list->tail->next = first;
+  else
+    list->head = first;
+  list->tail = last;
+  list->size += count;
+  drop_double_index(list);
+  return true;
+}
+
+DsaDoubleList *dsa_copy_double_list(const DsaDoubleList *list) {
+  if (!list)
+    return NULL;
+  DsaDoubleList *copy = dsa_create_double_list(list->type);
+  if (!copy)
+    return NULL;
+  for (DsaDoubleNode *node = list->head; node; node = node->next) {
+    DsaNodeData data = dsa_copy_node_data(node->data, list->type);
+    if ((list->type == DSA_TYPE_STRING && node->data.string_val &&
+         !data.string_val) ||
+        !dsa_insert_double_at_end(copy, data)) {
+      if (list->type == DSA_TYPE_STRING)
+        free(data.string_val);
+      dsa_free_double_list(copy);
+      return NULL;
+    }
+  }
+  return copy;
+}
+
 // ============================================================================
 // Fonctions de tri pour listes simples
 // ============================================================================
 
-void bubble_sort_simple(SimpleList *list) {
+// Tris en O(n log n) : les nœuds sont réchaînés, jamais recopiés. Le tri
+// fusion est ascendant : chaque nœud lu est fusionné avec les séquences
+// triées de 1, 2, 4... nœuds déjà formées (une par taille au plus, comme un
+// compteur binaire), en un seul parcours de la liste. Le tri rapide
+// partage la liste en trois (inférieurs, égaux, supérieurs au pivot, médian
+// du premier, du milieu et du dernier nœud) et se replie sur le tri fusion
+// pour les petites sous-listes ou au-delà d'une profondeur de 2 log2(n) :
+// O(n log n) garanti. Les deux tris sont stables.
+
+// Sous-listes confiées au tri fusion par le tri rapide
+#define LIST_QUICK_THRESHOLD 16
+
+// Nombre maximal de séquences en attente du tri fusion (2^64 nœuds)
+#define LIST_MERGE_BINS 64
+
+// Dernier nœud d'une liste terminée par NULL (recalcul de `tail` après un
+// tri qui réchaîne les nœuds)
+static DsaSimpleNode *last_simple_node(DsaSimpleNode *node) {
+  while (node && node->next)
+    node = node->next;
+  return node;
+}
+
+// Médian de trois valeurs
+static DsaNodeData median_node_data(DsaNodeData a, DsaNodeData b, DsaNodeData c,
+                                    DsaDataType type) {
+  if ((dsa_compare_node_data(a, b, type) < 0) ==
+      (dsa_compare_node_data(b, c, type) < 0))
+    return b;
+  if ((dsa_compare_node_data(b, a, type) < 0) ==
+      (dsa_compare_node_data(a, c, type) < 0))
+    return a;
+  return c;
+}
+
+// Profondeur limite du tri rapide : 2 * floor(log2(count))
+static int list_depth_limit(int count) {
+  int depth = 0;
+  while (count > 1) {
+    depth++;
+    count >>= 1;
+  }
+  return 2 * depth;
+}
+
+// Fusion stable de deux listes terminées par NULL (à égalité, `a` d'abord)
+static DsaSimpleNode *merge_simple_nodes(DsaSimpleNode *a, DsaSimpleNode *b,
+                                         DsaDataType type) {
+  DsaSimpleNode *head = NULL;
+  DsaSimpleNode **link = &head;
+  while (a && b) {
+    if (dsa_compare_node_data(b->data, a->data, type) < 0) {
+      *link = b;
+      b = b->next;
+    } else {
+      *link = a;
+      a = a->next;
+    }
+    link = &(*link)->next;
+  }
+  *link = a ? a : b;
+  return head;
+}
+
+static DsaSimpleNode *merge_sort_simple_nodes(DsaSimpleNode *head,
+                                              DsaDataType type) {
+  DsaSimpleNode *bins[LIST_MERGE_BINS] = {NULL};
+  while (head) {
+    DsaSimpleNode *run = head;
+    head = head->next;
+    run->next = NULL;
+    // bins[k] : 2^k nœuds, tous antérieurs à `run`
+    int k = 0;
+    for (; bins[k]; k++) {
+      run = merge_simple_nodes(bins[k], run, type);
+      bins[k] = NULL;
+    }
+    bins[k] = run;
+  }
+  DsaSimpleNode *sorted = NULL;
+  for (int k = 0; k < LIST_MERGE_BINS; k++) {
+    if (bins[k])
+      sorted = merge_simple_nodes(bins[k], sorted, type);
+  }
+  return sorted;
+}
+
+// Sous-liste du tri rapide : premier, milieu et dernier nœuds (candidats au
+// pivot), suivis au fil du partage qui la forme, sans parcours de plus
+typedef struct {
+  DsaSimpleNode *head;
+  DsaSimpleNode *middle; // Nœud n° count / 2
+  DsaSimpleNode *last;
+  int count;
+} SimpleRun;
+
+static void simple_run_append(SimpleRun *run, DsaSimpleNode *node) {
+  if (run->count == 0) {
+    run->head = node;
+    run->middle = node;
+  } else {
+    run->last->next = node;
+    if (run->count % 2 == 1)
+      run->middle = run->middle->next;
+  }
+  run->last = node;
+  run->count++;
+}
+
+static SimpleRun simple_run_of(DsaSimpleNode *head, int count) {
+  SimpleRun run = {head, head, head, count};
+  for (int i = 1; i < count; i++) {
+    run.last = run.last->next;
+    if (i % 2 == 1)
+      run.middle = run.middle->next;
+  }
+  return run;
+}
+
+// Trie la sous-liste ; *tail reçoit son dernier nœud
+static DsaSimpleNode *quick_sort_simple_nodes(SimpleRun run, int depth,
+                                              DsaDataType type,
+                                              DsaSimpleNode **tail) {
+  if (run.count <= LIST_QUICK_THRESHOLD || depth == 0) {
+    if (run.count)
+      run.last->next = NULL;
+    DsaSimpleNode *head = merge_sort_simple_nodes(run.head, type);
+    *tail = last_simple_node(head);
+    return head;
+  }
+
+  DsaNodeData pivot = median_node_data(run.head->data, run.middle->data,
+                                       run.last->data, type);
+
+  // Partage en trois sous-listes, dans l'ordre d'origine
+  SimpleRun less = {0}, equal = {0}, greater = {0};
+  DsaSimpleNode *node = run.head;
+  for (int i = 0; i < run.count; i++) {
+    DsaSimpleNode *next = node->next;
+    int cmp = dsa_compare_node_data(node->data, pivot, type);
+    if (cmp < 0)
+      simple_run_append(&less, node);
+    else if (cmp > 0)
+      simple_run_append(&greater, node);
+    else
+      simple_run_append(&equal, node);
+    node = next;
+  }
+
+  // Inférieurs, puis égaux (le pivot y est toujours), puis supérieurs
+  DsaSimpleNode *less_tail = NULL;
+  DsaSimpleNode *head =
+      quick_sort_simple_nodes(less, depth - 1, type, &less_tail);
+  DsaSimpleNode *after =
+      quick_sort_simple_nodes(greater, depth - 1, type, tail);
+  equal.last->next = after;
+  if (!after)
+    *tail = equal.last;
+  if (!head)
+    return equal.head;
+  less_tail->next = equal.head;
+  return head;
+}
+
+void dsa_bubble_sort_simple(DsaSimpleList *list) {
   if (!list || !list->head || list->size < 2)
     return;
 
   bool swapped;
   do {
     swapped = false;
-    SimpleNode *current = list->head;
+    DsaSimpleNode *current = list->head;
     while (current->next) {
-      if (compare_node_data(current->data, current->next->data, list->type) >
-          0) {
-        swap_simple_node_data(current, current->next);
+      if (dsa_compare_node_data(current->data, current->next->data,
+                                list->type) > 0) {
+        dsa_swap_simple_node_data(current, current->next);
         swapped = true;
       }
       current = current->next;
@@ -338,25 +731,25 @@ void bubble_sort_simple(SimpleList *list) {
   } while (swapped);
 }
 
-void insertion_sort_simple(SimpleList *list) {
+void dsa_insertion_sort_simple(DsaSimpleList *list) {
   if (!list || !list->head || list->size < 2)
     return;
 
-  SimpleNode *sorted = NULL;
-  SimpleNode *current = list->head;
+  DsaSimpleNode *sorted = NULL;
+  DsaSimpleNode *current = list->head;
 
   while (current) {
-    SimpleNode *next = current->next;
+    DsaSimpleNode *next = current->next;
 
     if (!sorted ||
-        compare_node_data(current->data, sorted->data, list->type) <= 0) {
+        dsa_compare_node_data(current->data, sorted->data, list->type) <= 0) {
       current->next = sorted;
       sorted = current;
     } else {
-      SimpleNode *search = sorted;
+      DsaSimpleNode *search = sorted;
       while (search->next &&
-             compare_node_data(current->data, search->next->data, list->type) >
-                 0) {
+             dsa_compare_node_data(current->data, search->next->data,
+                                   list->type) > 0) {
         search = search->next;
       }
       current->next = search->next;
@@ -365,47 +758,194 @@ void insertion_sort_simple(SimpleList *list) {
     current = next;
   }
   list->head = sorted;
+  list->tail = last_simple_node(sorted);
+  drop_simple_index(list);
 }
 
-void selection_sort_simple(SimpleList *list) {
+void dsa_selection_sort_simple(DsaSimpleList *list) {
   if (!list || !list->head || list->size < 2)
     return;
 
-  SimpleNode *current = list->head;
+  DsaSimpleNode *current = list->head;
   while (current) {
-    SimpleNode *min = current;
-    SimpleNode *search = current->next;
+    DsaSimpleNode *min = current;
+    DsaSimpleNode *search = current->next;
 
     while (search) {
-      if (compare_node_data(search->data, min->data, list->type) < 0) {
+      if (dsa_compare_node_data(search->data, min->data, list->type) < 0) {
         min = search;
       }
       search = search->next;
     }
 
     if (min != current) {
-      swap_simple_node_data(current, min);
+      dsa_swap_simple_node_data(current, min);
     }
     current = current->next;
   }
 }
 
+void dsa_merge_sort_simple(DsaSimpleList *list) {
+  if (!list || !list->head || list->size < 2)
+    return;
+  list->head = merge_sort_simple_nodes(list->head, list->type);
+  list->tail = last_simple_node(list->head);
+  drop_simple_index(list);
+}
+
+void dsa_quick_sort_simple(DsaSimpleList *list) {
+  if (!list || !list->head || list->size < 2)
+    return;
+  list->head = quick_sort_simple_nodes(simple_run_of(list->head, list->size),
+                                       list_depth_limit(list->size),
+                                       list->type, &list->tail);
+  drop_simple_index(list);
+}
+
 // ============================================================================
 // Fonctions de tri pour listes doubles
 // ============================================================================
 
-void bubble_sort_double(DoubleList *list) {
+// Mêmes tris sur les seuls liens `next` ; `prev` et `tail` sont rétablis
+// ensuite en un parcours (relink_double_list)
+static DsaDoubleNode *merge_double_nodes(DsaDoubleNode *a, DsaDoubleNode *b,
+                                         DsaDataType type) {
+  DsaDoubleNode *head = NULL;
+  DsaDoubleNode **link = &head;
+  while (a && b) {
+    if (dsa_compare_node_data(b->data, a->data, type) < 0) {
+      *link = b;
+      b = b->next;
+    } else {
+      *link = a;
+      a = a->next;
+    }
+    link = &(*link)->next;
+  }
+  *link = a ? a : b;
+  return head;
+}
+
+static DsaDoubleNode *merge_sort_double_nodes(DsaDoubleNode *head,
+                                              DsaDataType type) {
+  DsaDoubleNode *bins[LIST_MERGE_BINS] = {NULL};
+  while (head) {
+    DsaDoubleNode *run = head;
+    head = head->next;
+    run->next = NULL;
+    int k = 0;
+    for (; bins[k]; k++) {
+      run = merge_double_nodes(bins[k], run, type);
+      bins[k] = NULL;
+    }
+    bins[k] = run;
+  }
+  DsaDoubleNode *sorted = NULL;
+  for (int k = 0; k < LIST_MERGE_BINS; k++) {
+    if (bins[k])
+      sorted = merge_double_nodes(bins[k], sorted, type);
+  }
+  return sorted;
+}
+
+typedef struct {
+  DsaDoubleNode *head;
+  DsaDoubleNode *middle;
+  DsaDoubleNode *last;
+  int count;
+} DoubleRun;
+
+static void double_run_append(DoubleRun *run, DsaDoubleNode *node) {
+  if (run->count == 0) {
+    run->head = node;
+    run->middle = node;
+  } else {
+    run->last->next = node;
+    if (run->count % 2 == 1)
+      run->middle = run->middle->next;
+  }
+  run->last = node;
+  run->count++;
+}
+
+static DoubleRun double_run_of(DsaDoubleNode *head, int count) {
+  DoubleRun run = {head, head, head, count};
+  for (int i = 1; i < count; i++) {
+    run.last = run.last->next;
+    if (i % 2 == 1)
+      run.middle = run.middle->next;
+  }
+  return run;
+}
+
+static DsaDoubleNode *quick_sort_double_nodes(DoubleRun run, int depth,
+                                              DsaDataType type,
+                                              DsaDoubleNode **tail) {
+  if (run.count <= LIST_QUICK_THRESHOLD || depth == 0) {
+    if (run.count)
+      run.last->next = NULL;
+    DsaDoubleNode *head = merge_sort_double_nodes(run.head, type);
+    DsaDoubleNode *last = head;
+    while (last && last->next)
+      last = last->next;
+    *tail = last;
+    return head;
+  }
+
+  DsaNodeData pivot = median_node_data(run.head->data, run.middle->data,
+                                       run.last->data, type);
+
+  DoubleRun less = {0}, equal = {0}, greater = {0};
+  DsaDoubleNode *node = run.head;
+  for (int i = 0; i < run.count; i++) {
+    DsaDoubleNode *next = node->next;
+    int cmp = dsa_compare_node_data(node->data, pivot, type);
+    if (cmp < 0)
+      double_run_append(&less, node);
+    else if (cmp > 0)
+      double_run_append(&greater, node);
+    else
+      double_run_append(&equal, node);
+    node = next;
+  }
+
+  DsaDoubleNode *less_tail = NULL;
+  DsaDoubleNode *head =
+      quick_sort_double_nodes(less, depth - 1, type, &less_tail);
+  DsaDoubleNode *after =
+      quick_sort_double_nodes(greater, depth - 1, type, tail);
+  equal.last->next = after;
+  if (!after)
+    *tail = equal.last;
+  if (!head)
+    return equal.head;
+  less_tail->next = equal.head;
+  return head;
+}
+
+// Rétablit `prev` et `tail` après un tri qui n'a réchaîné que `next`
+static void relink_double_list(DsaDoubleList *list) {
+  DsaDoubleNode *prev = NULL;
+  for (DsaDoubleNode *node = list->head; node; node = node->next) {
+    node->prev = prev;
+    prev = node;
+  }
+  list->tail = prev;
+  drop_double_index(list);
+}
+
+void dsa_bubble_sort_double(DsaDoubleList *list) {
   if (!list || !list->head || list->size < 2)
     return;
 
   bool swapped;
   do {
     swapped = false;
-    DoubleNode *current = list->head;
+    DsaDoubleNode *current = list->head;
     while (current->next) {
-      if (compare_node_data(current->data, current->next->data, list->type) >
-          0) {
-        swap_double_node_data(current, current->next);
+      if (dsa_compare_node_data(current->data, current->next->data,
+                                list->type) > 0) {
+        dsa_swap_double_node_data(current, current->next);
         swapped = true;
       }
       current = current->next;
@@ -413,17 +953,17 @@ void bubble_sort_double(DoubleList *list) {
   } while (swapped);
 }
 
-void insertion_sort_double(DoubleList *list) {
+void dsa_insertion_sort_double(DsaDoubleList *list) {
   if (!list || !list->head || list->size < 2)
     return;
 
-  DoubleNode *current = list->head->next;
+  DsaDoubleNode *current = list->head->next;
   while (current) {
-    DoubleNode *next = current->next;
-    DoubleNode *search = current->prev;
+    DsaDoubleNode *next = current->next;
+    DsaDoubleNode *search = current->prev;
 
     while (search &&
-           compare_node_data(current->data, search->data, list->type) < 0) {
+           dsa_compare_node_data(current->data, search->data, list->type) < 0) {
       search = search->prev;
     }
 
@@ -451,81 +991,111 @@ void insertion_sort_double(DoubleList *list) {
     }
     current = next;
   }
+  drop_double_index(list);
 }
 
-void selection_sort_double(DoubleList *list) {
+void dsa_selection_sort_double(DsaDoubleList *list) {
   if (!list || !list->head || list->size < 2)
     return;
 
-  DoubleNode *current = list->head;
+  DsaDoubleNode *current = list->head;
   while (current) {
-    DoubleNode *min = current;
-    DoubleNode *search = current->next;
+    DsaDoubleNode *min = current;
+    DsaDoubleNode *search = current->next;
 
     while (search) {
-      if (compare_node_data(search->data, min->data, list->type) < 0) {
+      if (dsa_compare_node_data(search->data, min->data, list->type) < 0) {
         min = search;
       }
       search = search->next;
     }
 
     if (min != current) {
-      swap_double_node_data(current, min);
+      dsa_swap_double_node_data(current, min);
     }
     current = current->next;
   }
 }
 
+void dsa_merge_sort_double(DsaDoubleList *list) {
+  if (!list || !list->head || list->size < 2)
+    return;
+  list->head = merge_sort_double_nodes(list->head, list->type);
+  relink_double_list(list);
+}
+
+void dsa_quick_sort_double(DsaDoubleList *list) {
+  if (!list || !list->head || list->size < 2)
+    return;
+  DsaDoubleNode *tail;
+  list->head = quick_sort_double_nodes(double_run_of(list->head, list->size),
+                                       list_depth_limit(list->size),
+                                       list->type, &tail);
+  relink_double_list(list);
+}
+
 // ============================================================================
 // Fonctions utilitaires
 // ============================================================================
 
-int compare_node_data(NodeData a, NodeData b, DataType type) {
+int dsa_compare_node_data(DsaNodeData a, DsaNodeData b, DsaDataType type) {
   switch (type) {
-  case TYPE_INT:
-    return a.int_val - b.int_val;
-  case TYPE_FLOAT:
+  case DSA_TYPE_INT:
+    // Pas de soustraction : a - b déborde pour des valeurs éloignées
+    return (a.int_val > b.int_val) - (a.int_val < b.int_val);
+  case DSA_TYPE_FLOAT:
     if (a.float_val < b.float_val)
       return -1;
     if (a.float_val > b.float_val)
       return 1;
     return 0;
-  case TYPE_CHAR:
+  case DSA_TYPE_CHAR:
     return a.char_val - b.char_val;
-  case TYPE_STRING:
+  case DSA_TYPE_STRING:
     return strcmp(a.string_val, b.string_val);
   }
   return 0;
 }
 
-void swap_simple_node_data(SimpleNode *a, SimpleNode *b) {
-  NodeData temp = a->data;
+DsaNodeData dsa_copy_node_data(DsaNodeData data, DsaDataType type) {
+  if (type == DSA_TYPE_STRING && data.string_val) {
+    size_t len = strlen(data.string_val) + 1;
+    char *copy = (char *)malloc(len);
+    if (copy)
+      memcpy(copy, data.string_val, len);
+    data.string_val = copy;
+  }
+  return data;
+}
+
+void dsa_swap_simple_node_data(DsaSimpleNode *a, DsaSimpleNode *b) {
+  DsaNodeData temp = a->data;
   a->data = b->data;
   b->data = temp;
 }
 
-void swap_double_node_data(DoubleNode *a, DoubleNode *b) {
-  NodeData temp = a->data;
+void dsa_swap_double_node_data(DsaDoubleNode *a, DsaDoubleNode *b) {
+  DsaNodeData temp = a->data;
   a->data = b->data;
   b->data = temp;
 }
 
-char *node_data_to_string(NodeData data, DataType type) {
+char *dsa_node_data_to_string(DsaNodeData data, DsaDataType type) {
   char *str = (char *)malloc(64);
   if (!str)
     return NULL;
 
   switch (type) {
-  case TYPE_INT:
+  case DSA_TYPE_INT:
     snprintf(str, 64, "%d", data.int_val);
     break;
-  case TYPE_FLOAT:
+  case DSA_TYPE_FLOAT:
     snprintf(str, 64, "%.2f", data.float_val);
     break;
-  case TYPE_CHAR:
+  case DSA_TYPE_CHAR:
     snprintf(str, 64, "%c", data.char_val);
     break;
-  case TYPE_STRING:
+  case DSA_TYPE_STRING:
     snprintf(str, 64, "%s", data.string_val);
     break;
   }
@@ -536,30 +1106,26 @@ char *node_data_to_string(NodeData data, DataType type) {
 // Génération de données aléatoires
 // ============================================================================
 
-NodeData generate_random_node_data(DataType type) {
-  NodeData data;
-  static bool seeded = false;
-
-  if (!seeded) {
-    srand((unsigned int)time(NULL));
-    seeded = true;
-  }
+// Tirages sur le générateur du thread (dsa_prng_thread_reseed pour les rejouer)
+DsaNodeData dsa_generate_random_node_data(DsaDataType type) {
+  DsaNodeData data;
+  DsaPrng *rng = dsa_prng_thread();
 
   switch (type) {
-  case TYPE_INT:
-    data.int_val = rand() % 1000;
+  case DSA_TYPE_INT:
+    data.int_val = (int)dsa_prng_bounded(rng, 1000);
     break;
-  case TYPE_FLOAT:
-    data.float_val = (float)(rand() % 10000) / 100.0f;
+  case DSA_TYPE_FLOAT:
+    data.float_val = (float)dsa_prng_bounded(rng, 10000) / 100.0f;
     break;
-  case TYPE_CHAR:
-    data.char_val = 'A' + (rand() % 26);
+  case DSA_TYPE_CHAR:
+    data.char_val = 'A' + (char)dsa_prng_bounded(rng, 26);
     break;
-  case TYPE_STRING: {
-    int len = 3 + (rand() % 5);
+  case DSA_TYPE_STRING: {
+    int len = 3 + (int)dsa_prng_bounded(rng, 5);
     data.string_val = (char *)malloc(len + 1);
     for (int i = 0; i < len; i++) {
-      data.string_val[i] = 'a' + (rand() % 26);
+      data.string_val[i] = 'a' + (char)dsa_prng_bounded(rng, 26);
     }
     data.string_val[len] = '\0';
     break;
@@ -568,22 +1134,47 @@ NodeData generate_random_node_data(DataType type) {
   return data;
 }
 
-void fill_simple_list_random(SimpleList *list, int count) {
-  if (!list)
-    return;
+// Valeurs tirées d'un bloc, ajoutées en une fois ; NULL si la mémoire manque
+static DsaNodeData *generate_random_values(DsaDataType type, int count) {
+  DsaNodeData *values =
+      (DsaNodeData *)malloc((size_t)count * sizeof(DsaNodeData));
+  if (values) {
+    for (int i = 0; i < count; i++)
+      values[i] = dsa_generate_random_node_data(type);
+  }
+  return values;
+}
 
-  for (int i = 0; i < count; i++) {
-    NodeData data = generate_random_node_data(list->type);
-    insert_simple_at_end(list, data);
+static void free_node_values(DsaNodeData *values, int count, DsaDataType type) {
+  if (type == DSA_TYPE_STRING) {
+    for (int i = 0; i < count; i++)
+      free(values[i].string_val);
   }
+  free(values);
 }
 
-void fill_double_list_random(DoubleList *list, int count) {
-  if (!list)
+void dsa_fill_simple_list_random(DsaSimpleList *list, int count) {
+  if (!list || count <= 0)
     return;
 
-  for (int i = 0; i < count; i++) {
-    NodeData data = generate_random_node_data(list->type);
-    insert_double_at_end(list, data);
-  }
+  DsaNodeData *values = generate_random_values(list->type, count);
+  if (!values)
+    return;
+  if (dsa_append_simple_values(list, values, count))
+    free(values);
+  else
+    free_node_values(values, count, list->type);
+}
+
+void dsa_fill_double_list_random(DsaDoubleList *list, int count) {
+  if (!list || count <= 0)
+    return;
+
+  DsaNodeData *values = generate_random_values(list->type, count);
+  if (!values)
+    return;
+  if (dsa_append_double_values(list, values, count))
+    free(values);
+  else
+    free_node_values(values, count, list->type);
 }
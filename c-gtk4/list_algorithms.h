@@ -1,89 +1,141 @@
 #ifndef LIST_ALGORITHMS_H
 #define LIST_ALGORITHMS_H
 
+#include "ds_types.h"
+#include "list_index.h"
+#include "node_pool.h"
 #include <stdbool.h>
 #include <stddef.h>
 
-// Types de données supportés
-typedef enum { TYPE_INT, TYPE_FLOAT, TYPE_CHAR, TYPE_STRING } DataType;
-
 // Union pour stocker différents types de données
 typedef union {
   int int_val;
   float float_val;
   char char_val;
   char *string_val;
-} NodeData;
+} DsaNodeData;
 
 // Nœud pour liste simplement chaînée
-typedef struct SimpleNode {
-  DataType type;
-  NodeData data;
-  struct SimpleNode *next;
-} SimpleNode;
+typedef struct DsaSimpleNode {
+  DsaDataType type;
+  DsaNodeData data;
+  struct DsaSimpleNode *next;
+} DsaSimpleNode;
 
 // Nœud pour liste doublement chaînée
-typedef struct DoubleNode {
-  DataType type;
-  NodeData data;
-  struct DoubleNode *next;
-  struct DoubleNode *prev;
-} DoubleNode;
+typedef struct DsaDoubleNode {
+  DsaDataType type;
+  DsaNodeData data;
+  struct DsaDoubleNode *next;
+  struct DsaDoubleNode *prev;
+} DsaDoubleNode;
 
 // Structure pour gérer une liste simple
+// `tail` (dernier nœud) est tenu à jour par toutes les fonctions qui
+// modifient la liste : l'ajout en fin est en O(1). Les nœuds viennent de la
+// réserve `pool` de la liste, libérée en bloc avec elle.
+// `index` (list_index.h) est construit au premier accès par position d'une
+// liste de plus de DSA_LIST_INDEX_MIN_SIZE nœuds, puis tenu à jour par les
+// insertions et suppressions : lecture, insertion et suppression à une
+// position sont alors en O(log n). Les tris et ajouts qui réchaînent les
+// nœuds le détruisent ; il sera reconstruit au besoin.
 typedef struct {
-  SimpleNode *head;
-  DataType type;
+  DsaSimpleNode *head;
+  DsaSimpleNode *tail;
+  DsaDataType type;
   int size;
-} SimpleList;
+  DsaNodePool pool;
+  bool indexed; // Index par position autorisé
+  DsaListIndex *index;
+} DsaSimpleList;
 
 // Structure pour gérer une liste double
+// Sans index, les accès par position partent de l'extrémité la plus proche.
 typedef struct {
-  DoubleNode *head;
-  DoubleNode *tail;
-  DataType type;
+  DsaDoubleNode *head;
+  DsaDoubleNode *tail;
+  DsaDataType type;
   int size;
-} DoubleList;
+  DsaNodePool pool;
+  bool indexed;
+  DsaListIndex *index;
+} DsaDoubleList;
+
+// Taille à partir de laquelle un accès par position construit l'index
+#define DSA_LIST_INDEX_MIN_SIZE 64
+
+// Réserve de nœuds (node_pool.h) des listes créées ensuite : activée par
+// défaut ; désactivée, chaque nœud est alloué par malloc (comparaison)
+void dsa_list_set_node_pool(bool enabled);
+bool dsa_list_get_node_pool(void);
+
+// Index par position des listes créées ensuite : activé par défaut ;
+// désactivé, les accès par position parcourent la liste (comparaison)
+void dsa_list_set_position_index(bool enabled);
+bool dsa_list_get_position_index(void);
 
 // Fonctions pour listes simples
-SimpleList *create_simple_list(DataType type);
-void free_simple_list(SimpleList *list);
-bool insert_simple_at_beginning(SimpleList *list, NodeData data);
-bool insert_simple_at_end(SimpleList *list, NodeData data);
-bool insert_simple_at_position(SimpleList *list, NodeData data, int position);
-bool delete_simple_at_position(SimpleList *list, int position);
-bool modify_simple_at_position(SimpleList *list, NodeData data, int position);
-SimpleNode *get_simple_node_at(SimpleList *list, int position);
+DsaSimpleList *dsa_create_simple_list(DsaDataType type);
+void dsa_free_simple_list(DsaSimpleList *list);
+bool dsa_insert_simple_at_beginning(DsaSimpleList *list, DsaNodeData data);
+bool dsa_insert_simple_at_end(DsaSimpleList *list, DsaNodeData data);
+bool dsa_insert_simple_at_position(DsaSimpleList *list, DsaNodeData data,
+                                   int position);
+bool dsa_delete_simple_at_position(DsaSimpleList *list, int position);
+bool dsa_modify_simple_at_position(DsaSimpleList *list, DsaNodeData data,
+                                   int position);
+DsaSimpleNode *dsa_get_simple_node_at(DsaSimpleList *list, int position);
+// Ajoute `count` valeurs en fin de liste en un seul chaînage ; si la
+// mémoire manque, la liste reste inchangée et les valeurs appartiennent
+// toujours à l'appelant
+bool dsa_append_simple_values(DsaSimpleList *list, const DsaNodeData *values,
+                              int count);
+// Copie profonde (chaînes dupliquées), en temps linéaire ; NULL si la
+// mémoire manque
+DsaSimpleList *dsa_copy_simple_list(const DsaSimpleList *list);
 
 // Fonctions pour listes doubles
-DoubleList *create_double_list(DataType type);
-void free_double_list(DoubleList *list);
-bool insert_double_at_beginning(DoubleList *list, NodeData data);
-bool insert_double_at_end(DoubleList *list, NodeData data);
-bool insert_double_at_position(DoubleList *list, NodeData data, int position);
-bool delete_double_at_position(DoubleList *list, int position);
-bool modify_double_at_position(DoubleList *list, NodeData data, int position);
-DoubleNode *get_double_node_at(DoubleList *list, int position);
+DsaDoubleList *dsa_create_double_list(DsaDataType type);
+void dsa_free_double_list(DsaDoubleList *list);
+bool dsa_insert_double_at_beginning(DsaDoubleList *list, DsaNodeData data);
+bool dsa_insert_double_at_end(DsaDoubleList *list, DsaNodeData data);
+bool dsa_insert_double_at_position(DsaDoubleList *list, DsaNodeData data,
+                                   int position);
+bool dsa_delete_double_at_position(DsaDoubleList *list, int position);
+bool dsa_modify_double_at_position(DsaDoubleList *list, DsaNodeData data,
+                                   int position);
+DsaDoubleNode *dsa_get_double_node_at(DsaDoubleList *list, int position);
+bool dsa_append_double_values(DsaDoubleList *list, const DsaNodeData *values,
+                              int count);
+DsaDoubleList *dsa_copy_double_list(const DsaDoubleList *list);
 
 // Fonctions de tri pour listes simples
-void bubble_sort_simple(SimpleList *list);
-void insertion_sort_simple(SimpleList *list);
-void selection_sort_simple(SimpleList *list);
+void dsa_bubble_sort_simple(DsaSimpleList *list);
+void dsa_insertion_sort_simple(DsaSimpleList *list);
+void dsa_selection_sort_simple(DsaSimpleList *list);
+// Tris en O(n log n), stables, par réchaînage des nœuds
+void dsa_merge_sort_simple(DsaSimpleList *list);
+void dsa_quick_sort_simple(DsaSimpleList *list);
 
 // Fonctions de tri pour listes doubles
-void bubble_sort_double(DoubleList *list);
-void insertion_sort_double(DoubleList *list);
-void selection_sort_double(DoubleList *list);
+void dsa_bubble_sort_double(DsaDoubleList *list);
+void dsa_insertion_sort_double(DsaDoubleList *list);
+void dsa_selection_sort_double(DsaDoubleList *list);
+void dsa_merge_sort_double(DsaDoubleList *list);
+void dsa_quick_sort_double(DsaDoubleList *list);
 
 // Fonctions utilitaires
-int compare_node_data(NodeData a, NodeData b, DataType type);
-void swap_simple_node_data(SimpleNode *a, SimpleNode *b);
-void swap_double_node_data(DoubleNode *a, DoubleNode *b);
-char *node_data_to_string(NodeData data, DataType type);
+int dsa_compare_node_data(DsaNodeData a, DsaNodeData b, DsaDataType type);
+void dsa_swap_simple_node_data(DsaSimpleNode *a, DsaSimpleNode *b);
+void dsa_swap_double_node_data(DsaDoubleNode *a, DsaDoubleNode *b);
+char *dsa_node_data_to_string(DsaNodeData data, DsaDataType type);
+// Copie d'une valeur : les chaînes sont dupliquées (string_val NULL si la
+// mémoire manque)
+DsaNodeData dsa_copy_node_data(DsaNodeData data, DsaDataType type);
 
 // Génération de données aléatoires
-NodeData generate_random_node_data(DataType type);
-void fill_simple_list_random(SimpleList *list, int count);
-void fill_double_list_random(DoubleList *list, int count);
+DsaNodeData dsa_generate_random_node_data(DsaDataType type);
+void dsa_fill_simple_list_random(DsaSimpleList *list, int count);
+void dsa_fill_double_list_random(DsaDoubleList *list, int count);
 
 #endif // LIST_ALGORITHMS_H
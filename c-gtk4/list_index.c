@@ -0,0 +1,161 @@
+#include "list_index.h"
+#include <stdlib.h>
+
+// Nombre de niveaux d'une nouvelle entrée (0 : pas d'entrée), loi
+// géométrique de raison 1 / DSA_LIST_INDEX_FANOUT
+static int random_level(DsaListIndex *index) {
+  int level = 0;
+  while (level < DSA_LIST_INDEX_MAX_LEVEL &&
+         dsa_prng_bounded(&index->rng, DSA_LIST_INDEX_FANOUT) == 0)
+    level++;
+  return level;
+}
+
+static DsaListIndexEntry *entry_new(void *node, int level) {
+  DsaListIndexEntry *entry = (DsaListIndexEntry *)malloc(
+      sizeof(DsaListIndexEntry) + (size_t)level * sizeof(DsaListIndexLink));
+  if (entry) {
+    entry->node = node;
+    entry->level = level;
+  }
+  return entry;
+}
+
+DsaListIndex *dsa_list_index_build(void *first, int size, size_t next_offset) {
+  DsaListIndex *index = (DsaListIndex *)malloc(sizeof(DsaListIndex));
+  DsaListIndexEntry *head = entry_new(NULL, DSA_LIST_INDEX_MAX_LEVEL);
+  if (!index || !head) {
+    free(head);
+    free(index);
+    return NULL;
+  }
+  index->head = head;
+  index->level = 0;
+  index->size = size;
+  dsa_prng_seed(&index->rng, (uint64_t)(uintptr_t)index);
+
+  // Dernière entrée de chaque niveau et sa position, complétées au fil de
+  // la liste
+  DsaListIndexEntry *last[DSA_LIST_INDEX_MAX_LEVEL];
+  int last_position[DSA_LIST_INDEX_MAX_LEVEL];
+  for (int l = 0; l < DSA_LIST_INDEX_MAX_LEVEL; l++) {
+    last[l] = head;
+    last_position[l] = -1;
+  }
+
+  char *node = (char *)first;
+  for (int position = 0; position < size; position++) {
+    int level = random_level(index);
+    DsaListIndexEntry *entry = level ? entry_new(node, level) : NULL;
+    if (!entry)
+      level = 0;
+    for (int l = 0; l < level; l++) {
+      last[l]->links[l].next = entry;
+      last[l]->links[l].span = position - last_position[l];
+      last[l] = entry;
+      last_position[l] = position;
+    }
+    if (level > index->level)
+      index->level = level;
+    node = *(char **)(node + next_offset);
+  }
+  for (int l = 0; l < DSA_LIST_INDEX_MAX_LEVEL; l++) {
+    last[l]->links[l].next = NULL;
+    last[l]->links[l].span = size - last_position[l];
+  }
+  return index;
+}
+
+void dsa_list_index_free(DsaListIndex *index) {
+  if (!index)
+    return;
+  DsaListIndexEntry *entry = index->head;
+  while (entry) {
+    DsaListIndexEntry *next = entry->level ? entry->links[0].next : NULL;
+    free(entry);
+    entry = next;
+  }
+  free(index);
+}
+
+void *dsa_list_index_seek(const DsaListIndex *index, int position,
+                          int *node_position) {
+  DsaListIndexEntry *entry = index->head;
+  int at = -1;
+  for (int l = index->level - 1; l >= 0; l--) {
+    while (entry->links[l].next && at + entry->links[l].span <= position) {
+      at += entry->links[l].span;
+      entry = entry->links[l].next;
+    }
+  }
+  *node_position = at;
+  return entry->node;
+}
+
+// Dernière entrée de chaque niveau strictement avant `position`, et sa
+// position (la sentinelle pour les niveaux inutilisés, dont le lien vide
+// enjambe toute la liste)
+static void find_before(const DsaListIndex *index, int position,
+                        DsaListIndexEntry **update, int *update_position) {
+  DsaListIndexEntry *entry = index->head;
+  int at = -1;
+  for (int l = DSA_LIST_INDEX_MAX_LEVEL - 1; l >= 0; l--) {
+    while (entry->links[l].next && at + entry->links[l].span < position) {
+      at += entry->links[l].span;
+      entry = entry->links[l].next;
+    }
+    update[l] = entry;
+    update_position[l] = at;
+  }
+}
+
+void dsa_list_index_insert(DsaListIndex *index, int position, void *node) {
+  DsaListIndexEntry *update[DSA_LIST_INDEX_MAX_LEVEL];
+  int update_position[DSA_LIST_INDEX_MAX_LEVEL];
+  find_before(index, position, update, update_position);
+
+  int level = random_level(index);
+  DsaListIndexEntry *entry = level ? entry_new(node, level) : NULL;
+  if (!entry)
+    level = 0;
+
+  for (int l = 0; l < DSA_LIST_INDEX_MAX_LEVEL; l++) {
+    DsaListIndexLink *link = &update[l]->links[l];
+    if (l < level) {
+      // Le lien est coupé en deux par la nouvelle entrée
+      entry->links[l].next = link->next;
+      entry->links[l].span = link->span - (position - update_position[l]) + 1;
+      link->next = entry;
+      link->span = position - update_position[l];
+    } else {
+      link->span++;
+    }
+  }
+  if (level > index->level)
+    index->level = level;
+  index->size++;
+}
+
+void dsa_list_index_delete(DsaListIndex *index, int position) {
+  DsaListIndexEntry *update[DSA_LIST_INDEX_MAX_LEVEL];
+  int update_position[DSA_LIST_INDEX_MAX_LEVEL];
+  find_before(index, position, update, update_position);
+
+  DsaListIndexEntry *removed = NULL;
+  for (int l = 0; l < DSA_LIST_INDEX_MAX_LEVEL; l++) {
+    DsaListIndexLink *link = &update[l]->links[l];
+    DsaListIndexEntry *next = link->next;
+    if (next && update_position[l] + link->span == position) {
+      // Entrée du nœud retiré : ses liens sont repris
+      link->next = next->links[l].next;
+      link->span += next->links[l].span - 1;
+      removed = next;
+    } else {
+      link->span--;
+    }
+  }
+  free(removed);
+  while (index->level > 0 && !index->head->links[index->level - 1].next)
+    index->level--;
+  index->size--;
+}
@@ -0,0 +1,57 @@
+#ifndef LIST_INDEX_H
+#define LIST_INDEX_H
+
+#include "prng.h"
+#include <stddef.h>
+
+// Index par position d'une liste chaînée : liste à enjambées (skip list)
+// dont chaque lien porte le nombre de positions qu'il enjambe. Le niveau le
+// plus bas est la liste elle-même (liens `next`) ; un nœud sur
+// DSA_LIST_INDEX_FANOUT en moyenne reçoit une entrée au niveau 1, un sur
+// LIST_INDEX_FANOUT² au niveau 2, etc. Trouver le nœud d'une position suit
+// O(log n) liens en moyenne, puis quelques liens `next` de la liste.
+//
+// L'index ne connaît les nœuds que par leur adresse : la liste le met à
+// jour à chaque insertion ou suppression, et le détruit quand elle
+// réchaîne ses nœuds (tris) ; il est reconstruit en O(n) au besoin.
+
+#define DSA_LIST_INDEX_FANOUT 4
+#define DSA_LIST_INDEX_MAX_LEVEL 16
+
+typedef struct DsaListIndexEntry DsaListIndexEntry;
+
+typedef struct {
+  DsaListIndexEntry *next;
+  int span; // Positions enjambées (jusqu'à la fin de la liste si next NULL)
+} DsaListIndexLink;
+
+struct DsaListIndexEntry {
+  void *node; // Nœud de la liste (NULL pour la sentinelle, position -1)
+  int level;
+  DsaListIndexLink links[]; // `level` liens, du niveau 1 au niveau `level`
+};
+
+typedef struct {
+  DsaListIndexEntry *head; // Sentinelle de DSA_LIST_INDEX_MAX_LEVEL niveaux
+  int level;               // Niveaux utilisés
+  int size;                // Nœuds de la liste
+  DsaPrng rng;             // Tirage des niveaux
+} DsaListIndex;
+
+// Index des `size` nœuds chaînés depuis `first` ; `next_offset` est la
+// position du lien `next` dans un nœud. NULL si la mémoire manque.
+DsaListIndex *dsa_list_index_build(void *first, int size, size_t next_offset);
+void dsa_list_index_free(DsaListIndex *index);
+
+// Dernier nœud indexé à une position <= `position` ; *node_position reçoit
+// sa position. NULL (position -1) si aucun : le parcours part de la tête.
+void *dsa_list_index_seek(const DsaListIndex *index, int position,
+                          int *node_position);
+
+// Enregistre le nœud inséré à `position` (les suivants sont décalés) ; si
+// la mémoire manque, le nœud n'a simplement pas d'entrée
+void dsa_list_index_insert(DsaListIndex *index, int position, void *node);
+// Retire la position (le nœud peut déjà être libéré)
+void dsa_list_index_delete(DsaListIndex *index, int position);
+
+#endif
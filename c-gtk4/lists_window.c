@@ -1,11 +1,56 @@
 #include "lists_window.h"
 #include "list_algorithms.h"
+#include "prng.h"
+#include "timing.h"
+#include "unrolled_list.h"
 #include <ctype.h>
 #include <gtk/gtk.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <time.h>
+
+// Comparaison des tris : répétitions par méthode au plus, travail total par
+// méthode (nœuds triés pour les tris en O(n log n), n² pour les tris en
+// O(n²), qui ne sont alors répétés qu'une fois au-delà de 10 000 nœuds), et
+// taille au-delà de laquelle les tris en O(n²) sont ignorés
+#define LISTS_COMPARE_ITERATIONS 1000
+#define LISTS_COMPARE_WORK 2000000
+#define LISTS_COMPARE_QUADRATIC_WORK 100000000
+#define LISTS_COMPARE_QUADRATIC_LIMIT 20000
+
+// Liste déroulée dessinée : une case par valeur, une case grise pour les
+// places libres du bloc, puis le pointeur vers le bloc suivant
+#define UNROLLED_CELL_WIDTH 60
+#define UNROLLED_FREE_WIDTH 40
+#define UNROLLED_POINTER_WIDTH 27
+
+// Structures proposées, dans l'ordre de la liste déroulante
+typedef enum { LIST_SIMPLE, LIST_DOUBLE, LIST_UNROLLED } ListStructure;
+
+// Méthodes de tri, dans l'ordre de la liste déroulante. Les listes
+// déroulées sont triées par l'algorithme de tableau correspondant (le tri
+// par sélection n'en a pas).
+static const struct {
+  const char *name;
+  void (*sort_simple)(DsaSimpleList *list);
+  void (*sort_double)(DsaDoubleList *list);
+  bool quadratic;
+  bool has_unrolled;
+  DsaSortAlgo unrolled_algo;
+} SORT_METHODS[] = {
+    {"Tri à bulle", dsa_bubble_sort_simple, dsa_bubble_sort_double, true, true,
+     DSA_ALGO_BUBBLE},
+    {"Tri par insertion", dsa_insertion_sort_simple, dsa_insertion_sort_double,
+     true, true, DSA_ALGO_INSERTION},
+    {"Tri par sélection", dsa_selection_sort_simple, dsa_selection_sort_double,
+     true, false, DSA_ALGO_BUBBLE},
+    {"Tri fusion", dsa_merge_sort_simple, dsa_merge_sort_double, false, true,
+     DSA_ALGO_MERGE},
+    {"Tri rapide", dsa_quick_sort_simple, dsa_quick_sort_double, false, true,
+     DSA_ALGO_QUICK},
+};
+
+#define SORT_METHOD_COUNT (sizeof(SORT_METHODS) / sizeof(SORT_METHODS[0]))
 
 // Structure pour gérer l'état de la fenêtre
 typedef struct {
@@ -31,12 +76,14 @@ typedef struct {
   GtkWidget *index_entry;
 
   // Data
-  SimpleList *simple_list;
-  SimpleList *simple_list_before;
-  DoubleList *double_list;
-  DoubleList *double_list_before;
-  DataType current_type;
-  bool is_double;
+  DsaSimpleList *simple_list;
+  DsaSimpleList *simple_list_before;
+  DsaDoubleList *double_list;
+  DsaDoubleList *double_list_before;
+  DsaUnrolledList *unrolled_list;
+  DsaUnrolledList *unrolled_list_before;
+  DsaDataType current_type;
+  ListStructure structure;
   bool is_manual_mode;
   bool has_sorted;
 } ListsWindowData;
@@ -59,36 +106,84 @@ static void clear_text_view(ListsWindowData *data) {
   gtk_text_buffer_set_text(buffer, "", -1);
 }
 
-static SimpleList *copy_simple_list(SimpleList *src) {
-  if (!src)
-    return NULL;
-  SimpleList *dest = create_simple_list(src->type);
-  SimpleNode *current = src->head;
-  while (current) {
-    insert_simple_at_end(dest, current->data);
-    current = current->next;
+static bool has_list(ListsWindowData *data) {
+  return data->simple_list || data->double_list || data->unrolled_list;
+}
+
+static int list_size(ListsWindowData *data) {
+  if (data->structure == LIST_DOUBLE && data->double_list)
+    return data->double_list->size;
+  if (data->structure == LIST_UNROLLED && data->unrolled_list)
+    return data->unrolled_list->size;
+  if (data->structure == LIST_SIMPLE && data->simple_list)
+    return data->simple_list->size;
+  return 0;
+}
+
+// Libère la liste courante et sa copie d'avant le tri
+static void free_lists(ListsWindowData *data) {
+  dsa_free_simple_list(data->simple_list);
+  dsa_free_simple_list(data->simple_list_before);
+  dsa_free_double_list(data->double_list);
+  dsa_free_double_list(data->double_list_before);
+  dsa_free_unrolled_list(data->unrolled_list);
+  dsa_free_unrolled_list(data->unrolled_list_before);
+  data->simple_list = NULL;
+  data->simple_list_before = NULL;
+  data->double_list = NULL;
+  data->double_list_before = NULL;
+  data->unrolled_list = NULL;
+  data->unrolled_list_before = NULL;
+}
+
+// Ajoute une valeur en fin de la liste courante (la chaîne lui appartient)
+static void append_list_value(ListsWindowData *data, DsaNodeData value) {
+  switch (data->structure) {
+  case LIST_SIMPLE:
+    dsa_insert_simple_at_end(data->simple_list, value);
+    break;
+  case LIST_DOUBLE:
+    dsa_insert_double_at_end(data->double_list, value);
+    break;
+  case LIST_UNROLLED:
+    dsa_insert_unrolled_at_end(data->unrolled_list, value);
+    break;
   }
-  return dest;
 }
 
-static DoubleList *copy_double_list(DoubleList *src) {
-  if (!src)
-    return NULL;
-  DoubleList *dest = create_double_list(src->type);
-  DoubleNode *current = src->head;
-  while (current) {
-    insert_double_at_end(dest, current->data);
-    current = current->next;
+static void append_value_text(ListsWindowData *data, DsaNodeData value) {
+  char buffer[512];
+  char *str = dsa_node_data_to_string(value, data->current_type);
+  snprintf(buffer, sizeof(buffer), "%s -> ", str);
+  append_to_text_view(data, buffer);
+  free(str);
+}
+
+// Affiche la liste courante sous la forme "a -> b -> NULL"
+static void append_list_text(ListsWindowData *data) {
+  if (data->structure == LIST_DOUBLE && data->double_list) {
+    for (DsaDoubleNode *node = data->double_list->head; node; node = node->next)
+      append_value_text(data, node->data);
+  } else if (data->structure == LIST_UNROLLED && data->unrolled_list) {
+    DsaUnrolledList *list = data->unrolled_list;
+    for (DsaUnrolledBlock *block = list->head; block; block = block->next) {
+      for (int i = 0; i < block->count; i++)
+        append_value_text(data, dsa_unrolled_block_value(list, block, i));
+    }
+  } else if (data->structure == LIST_SIMPLE && data->simple_list) {
+    for (DsaSimpleNode *node = data->simple_list->head; node; node = node->next)
+      append_value_text(data, node->data);
   }
-  return dest;
+  append_to_text_view(data, "NULL\n");
 }
 
 // ============================================================================
 // Fonctions de dessin avec Cairo - FOND NOIR
 // ============================================================================
 
-static void draw_simple_list_colored(cairo_t *cr, SimpleList *list, int width,
-                                     int height, bool is_after_sort) {
+static void draw_simple_list_colored(cairo_t *cr, DsaSimpleList *list,
+                                     int width, int height,
+                                     bool is_after_sort) {
   if (!list || !list->head)
     return;
 
@@ -98,7 +193,7 @@ static void draw_simple_list_colored(cairo_t *cr, SimpleList *list, int width,
   const int start_x = 30;
   const int start_y = height / 2;
 
-  SimpleNode *current = list->head;
+  DsaSimpleNode *current = list->head;
   int x = start_x;
 
   while (current) {
@@ -128,7 +223,7 @@ static void draw_simple_list_colored(cairo_t *cr, SimpleList *list, int width,
     cairo_stroke(cr);
 
     // Texte de la valeur (partie gauche)
-    char *value_str = node_data_to_string(current->data, list->type);
+    char *value_str = dsa_node_data_to_string(current->data, list->type);
     cairo_set_source_rgb(cr, 1.0, 1.0, 1.0);
     cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL,
                            CAIRO_FONT_WEIGHT_BOLD);
@@ -174,8 +269,9 @@ static void draw_simple_list_colored(cairo_t *cr, SimpleList *list, int width,
   cairo_show_text(cr, "NULL");
 }
 
-static void draw_double_list_colored(cairo_t *cr, DoubleList *list, int width,
-                                     int height, bool is_after_sort) {
+static void draw_double_list_colored(cairo_t *cr, DsaDoubleList *list,
+                                     int width, int height,
+                                     bool is_after_sort) {
   if (!list || !list->head)
     return;
 
@@ -185,7 +281,7 @@ static void draw_double_list_colored(cairo_t *cr, DoubleList *list, int width,
   const int start_x = 30;
   const int start_y = height / 2;
 
-  DoubleNode *current = list->head;
+  DsaDoubleNode *current = list->head;
   int x = start_x;
 
   while (current) {
@@ -213,7 +309,7 @@ static void draw_double_list_colored(cairo_t *cr, DoubleList *list, int width,
     cairo_line_to(cr, x + data_width, start_y + node_height / 2);
     cairo_stroke(cr);
 
-    char *value_str = node_data_to_string(current->data, list->type);
+    char *value_str = dsa_node_data_to_string(current->data, list->type);
     cairo_set_source_rgb(cr, 1.0, 1.0, 1.0);
     cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL,
                            CAIRO_FONT_WEIGHT_BOLD);
@@ -269,6 +365,143 @@ static void draw_double_list_colored(cairo_t *cr, DoubleList *list, int width,
   cairo_show_text(cr, "NULL");
 }
 
+static int unrolled_block_width(const DsaUnrolledList *list,
+                                const DsaUnrolledBlock *block) {
+  int width = block->count * UNROLLED_CELL_WIDTH + UNROLLED_POINTER_WIDTH;
+  if (block->count < list->capacity)
+    width += UNROLLED_FREE_WIDTH;
+  return width;
+}
+
+// Un rectangle par bloc, une case par valeur : les valeurs d'un bloc sont
+// contiguës en mémoire, seuls les blocs sont chaînés
+static void draw_unrolled_list_colored(cairo_t *cr, DsaUnrolledList *list,
+                                       int width, int height,
+                                       bool is_after_sort) {
+  if (!list || !list->head)
+    return;
+
+  const int node_height = 50;
+  const int arrow_length = 25;
+  const int start_x = 30;
+  const int start_y = height / 2;
+  const int top = start_y - node_height / 2;
+
+  int x = start_x;
+  for (DsaUnrolledBlock *block = list->head; block; block = block->next) {
+    int block_width = unrolled_block_width(list, block);
+    int values_width = block->count * UNROLLED_CELL_WIDTH;
+    int pointer_x = x + block_width - UNROLLED_POINTER_WIDTH;
+
+    if (is_after_sort) {
+      cairo_set_source_rgb(cr, 0.2, 0.8, 0.4); // VERT
+    } else {
+      cairo_set_source_rgb(cr, 0.2, 0.5, 0.9); // BLEU
+    }
+    cairo_rectangle(cr, x, top, values_width, node_height);
+    cairo_fill(cr);
+
+    // Places libres du bloc, en gris, avec leur nombre
+    if (block->count < list->capacity) {
+      char free_str[16];
+      snprintf(free_str, sizeof(free_str), "+%d",
+               list->capacity - block->count);
+      cairo_set_source_rgb(cr, 0.3, 0.3, 0.3);
+      cairo_rectangle(cr, x + values_width, top, UNROLLED_FREE_WIDTH,
+                      node_height);
+      cairo_fill(cr);
+      cairo_set_source_rgb(cr, 0.8, 0.8, 0.8);
+      cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL,
+                             CAIRO_FONT_WEIGHT_NORMAL);
+      cairo_set_font_size(cr, 11);
+      cairo_text_extents_t extents;
+      cairo_text_extents(cr, free_str, &extents);
+      cairo_move_to(cr,
+                    x + values_width +
+                        (UNROLLED_FREE_WIDTH - extents.width) / 2,
+                    start_y + extents.height / 2);
+      cairo_show_text(cr, free_str);
+    }
+
+    // Bordure du bloc et séparations entre les cases
+    cairo_set_source_rgb(cr, 1.0, 1.0, 1.0);
+    cairo_set_line_width(cr, 2);
+    cairo_rectangle(cr, x, top, block_width, node_height);
+    cairo_stroke(cr);
+    cairo_set_line_width(cr, 1);
+    for (int i = 1; i <= block->count; i++) {
+      cairo_move_to(cr, x + i * UNROLLED_CELL_WIDTH, top);
+      cairo_line_to(cr, x + i * UNROLLED_CELL_WIDTH, top + node_height);
+    }
+    cairo_stroke(cr);
+    cairo_set_line_width(cr, 2);
+    cairo_move_to(cr, pointer_x, top);
+    cairo_line_to(cr, pointer_x, top + node_height);
+    cairo_stroke(cr);
+
+    // Valeurs
+    cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL,
+                           CAIRO_FONT_WEIGHT_BOLD);
+    cairo_set_font_size(cr, 14);
+    for (int i = 0; i < block->count; i++) {
+      char *value_str = dsa_node_data_to_string(
+          dsa_unrolled_block_value(list, block, i), list->type);
+      cairo_text_extents_t extents;
+      cairo_text_extents(cr, value_str, &extents);
+      cairo_move_to(cr,
+                    x + i * UNROLLED_CELL_WIDTH +
+                        (UNROLLED_CELL_WIDTH - extents.width) / 2,
+                    start_y + extents.height / 2);
+      cairo_show_text(cr, value_str);
+      free(value_str);
+    }
+
+    // Pointeur vers le bloc suivant
+    cairo_arc(cr, pointer_x + UNROLLED_POINTER_WIDTH / 2, start_y, 3, 0,
+              2 * 3.14159);
+    cairo_fill(cr);
+    x += block_width;
+    cairo_move_to(cr, x, start_y);
+    cairo_line_to(cr, x + arrow_length, start_y);
+    cairo_stroke(cr);
+    cairo_move_to(cr, x + arrow_length, start_y);
+    cairo_line_to(cr, x + arrow_length - 8, start_y - 5);
+    cairo_line_to(cr, x + arrow_length - 8, start_y + 5);
+    cairo_close_path(cr);
+    cairo_fill(cr);
+    x += arrow_length;
+  }
+
+  cairo_set_source_rgb(cr, 1.0, 0.0, 0.0);
+  cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL,
+                         CAIRO_FONT_WEIGHT_BOLD);
+  cairo_set_font_size(cr, 16);
+  cairo_move_to(cr, x, start_y + 5);
+  cairo_show_text(cr, "NULL");
+}
+
+// Dessine la liste de la structure courante (avant ou après le tri)
+static void draw_current_list(ListsWindowData *data, cairo_t *cr, int width,
+                              int height, bool before, bool is_after_sort) {
+  switch (data->structure) {
+  case LIST_SIMPLE:
+    draw_simple_list_colored(
+        cr, before ? data->simple_list_before : data->simple_list, width,
+        height, is_after_sort);
+    break;
+  case LIST_DOUBLE:
+    draw_double_list_colored(
+        cr, before ? data->double_list_before : data->double_list, width,
+        height, is_after_sort);
+    break;
+  case LIST_UNROLLED:
+    draw_unrolled_list_colored(
+        cr, before ? data->unrolled_list_before : data->unrolled_list, width,
+        height, is_after_sort);
+    break;
+  }
+}
+
 static void on_draw_before(GtkDrawingArea *area, cairo_t *cr, int width,
                            int height, gpointer user_data) {
   ListsWindowData *data = (ListsWindowData *)user_data;
@@ -277,21 +510,7 @@ static void on_draw_before(GtkDrawingArea *area, cairo_t *cr, int width,
   cairo_set_source_rgb(cr, 0.0, 0.0, 0.0);
   cairo_paint(cr);
 
-  if (data->has_sorted) {
-    if (data->is_double && data->double_list_before) {
-      draw_double_list_colored(cr, data->double_list_before, width, height,
-                               false);
-    } else if (!data->is_double && data->simple_list_before) {
-      draw_simple_list_colored(cr, data->simple_list_before, width, height,
-                               false);
-    }
-  } else {
-    if (data->is_double && data->double_list) {
-      draw_double_list_colored(cr, data->double_list, width, height, false);
-    } else if (!data->is_double && data->simple_list) {
-      draw_simple_list_colored(cr, data->simple_list, width, height, false);
-    }
-  }
+  draw_current_list(data, cr, width, height, data->has_sorted, false);
 }
 
 static void on_draw_after(GtkDrawingArea *area, cairo_t *cr, int width,
@@ -302,13 +521,8 @@ static void on_draw_after(GtkDrawingArea *area, cairo_t *cr, int width,
   cairo_set_source_rgb(cr, 0.0, 0.0, 0.0);
   cairo_paint(cr);
 
-  if (data->has_sorted) {
-    if (data->is_double && data->double_list) {
-      draw_double_list_colored(cr, data->double_list, width, height, true);
-    } else if (!data->is_double && data->simple_list) {
-      draw_simple_list_colored(cr, data->simple_list, width, height, true);
-    }
-  }
+  if (data->has_sorted)
+    draw_current_list(data, cr, width, height, false, true);
 }
 
 // ============================================================================
@@ -410,42 +624,34 @@ static void show_manual_input_dialog(ListsWindowData *data, int size) {
     int count = 0;
 
     while (token && count < size) {
-      NodeData node_data;
+      DsaNodeData node_data;
 
       switch (data->current_type) {
-      case TYPE_INT:
+      case DSA_TYPE_INT:
         node_data.int_val = atoi(token);
         printf("DEBUG: Ajout entier %d\n", node_data.int_val);
         fflush(stdout);
         break;
-      case TYPE_FLOAT:
+      case DSA_TYPE_FLOAT:
         node_data.float_val = atof(token);
         printf("DEBUG: Ajout réel %f\n", node_data.float_val);
         fflush(stdout);
         break;
-      case TYPE_CHAR:
+      case DSA_TYPE_CHAR:
         node_data.char_val = token[0];
         printf("DEBUG: Ajout char %c\n", node_data.char_val);
         fflush(stdout);
         break;
-      case TYPE_STRING:
+      case DSA_TYPE_STRING:
         node_data.string_val = strdup(token);
         printf("DEBUG: Ajout string %s\n", node_data.string_val);
         fflush(stdout);
         break;
       }
 
-      if (data->is_double) {
-        insert_double_at_end(data->double_list, node_data);
-        printf("DEBUG: Inséré dans double list, taille = %d\n",
-               data->double_list->size);
-        fflush(stdout);
-      } else {
-        insert_simple_at_end(data->simple_list, node_data);
-        printf("DEBUG: Inséré dans simple list, taille = %d\n",
-               data->simple_list->size);
-        fflush(stdout);
-      }
+      append_list_value(data, node_data);
+      printf("DEBUG: Inséré dans la liste, taille = %d\n", list_size(data));
+      fflush(stdout);
 
       count++;
       token = strtok(NULL, " \n\t");
@@ -473,30 +679,15 @@ static void on_create_list_clicked(GtkWidget *widget, gpointer user_data) {
   ListsWindowData *data = (ListsWindowData *)user_data;
 
   // 1. Nettoyage des listes existantes
-  if (data->simple_list) {
-    free_simple_list(data->simple_list);
-    data->simple_list = NULL;
-  }
-  if (data->simple_list_before) {
-    free_simple_list(data->simple_list_before);
-    data->simple_list_before = NULL;
-  }
-  if (data->double_list) {
-    free_double_list(data->double_list);
-    data->double_list = NULL;
-  }
-  if (data->double_list_before) {
-    free_double_list(data->double_list_before);
-    data->double_list_before = NULL;
-  }
+  free_lists(data);
 
   // 2. Lecture des paramètres UI
   int type_index = gtk_drop_down_get_selected(GTK_DROP_DOWN(data->type_combo));
-  data->current_type = (DataType)type_index;
+  data->current_type = (DsaDataType)type_index;
 
   int structure_index =
       gtk_drop_down_get_selected(GTK_DROP_DOWN(data->structure_combo));
-  data->is_double = (structure_index == 1);
+  data->structure = (ListStructure)structure_index;
 
   int mode_index = gtk_drop_down_get_selected(GTK_DROP_DOWN(data->mode_combo));
   data->is_manual_mode = (mode_index == 1);
@@ -504,10 +695,16 @@ static void on_create_list_clicked(GtkWidget *widget, gpointer user_data) {
   int size = gtk_spin_button_get_value_as_int(GTK_SPIN_BUTTON(data->size_spin));
 
   // 3. Création de la structure
-  if (data->is_double) {
-    data->double_list = create_double_list(data->current_type);
-  } else {
-    data->simple_list = create_simple_list(data->current_type);
+  switch (data->structure) {
+  case LIST_SIMPLE:
+    data->simple_list = dsa_create_simple_list(data->current_type);
+    break;
+  case LIST_DOUBLE:
+    data->double_list = dsa_create_double_list(data->current_type);
+    break;
+  case LIST_UNROLLED:
+    data->unrolled_list = dsa_create_unrolled_list(data->current_type);
+    break;
   }
 
   // 4. Remplissage
@@ -530,7 +727,7 @@ static void on_create_list_clicked(GtkWidget *widget, gpointer user_data) {
     char error_message[512] = "";
 
     while (token) {
-      if (data->current_type == TYPE_INT) {
+      if (data->current_type == DSA_TYPE_INT) {
         char *endptr;
         strtol(token, &endptr, 10);
         if (*endptr != '\0') {
@@ -539,7 +736,7 @@ static void on_create_list_clicked(GtkWidget *widget, gpointer user_data) {
                    "Erreur: valeur non entière détectée '%s'", token);
           break;
         }
-      } else if (data->current_type == TYPE_FLOAT) {
+      } else if (data->current_type == DSA_TYPE_FLOAT) {
         char *endptr;
         strtof(token, &endptr);
         if (*endptr != '\0') {
@@ -548,7 +745,7 @@ static void on_create_list_clicked(GtkWidget *widget, gpointer user_data) {
                    "Erreur: valeur non réelle détectée '%s'", token);
           break;
         }
-      } else if (data->current_type == TYPE_CHAR) {
+      } else if (data->current_type == DSA_TYPE_CHAR) {
         if (strlen(token) > 1) {
           validation_error = true;
           snprintf(error_message, sizeof(error_message),
@@ -565,7 +762,7 @@ static void on_create_list_clicked(GtkWidget *widget, gpointer user_data) {
               token);
           break;
         }
-      } else if (data->current_type == TYPE_STRING) {
+      } else if (data->current_type == DSA_TYPE_STRING) {
         // Check si c'est un nombre (entier ou réel)
         char *endptr;
         strtod(token, &endptr);
@@ -591,14 +788,7 @@ static void on_create_list_clicked(GtkWidget *widget, gpointer user_data) {
                                G_CALLBACK(gtk_window_destroy), dialog);
 
       // Nettoyage si on a déjà alloué
-      if (data->simple_list) {
-        free_simple_list(data->simple_list);
-        data->simple_list = NULL;
-      }
-      if (data->double_list) {
-        free_double_list(data->double_list);
-        data->double_list = NULL;
-      }
+      free_lists(data);
       free(text_copy);
       return; // STOP
     }
@@ -610,28 +800,24 @@ static void on_create_list_clicked(GtkWidget *widget, gpointer user_data) {
     // Mode MANUEL : La taille est déterminée par le nombre d'inputs, on ignore
     // 'size' du spinner
     while (token) {
-      NodeData node_data = {0};
+      DsaNodeData node_data = {0};
 
       switch (data->current_type) {
-      case TYPE_INT:
+      case DSA_TYPE_INT:
         node_data.int_val = atoi(token);
         break;
-      case TYPE_FLOAT:
+      case DSA_TYPE_FLOAT:
         node_data.float_val = atof(token);
         break;
-      case TYPE_CHAR:
+      case DSA_TYPE_CHAR:
         node_data.char_val = token[0];
         break;
-      case TYPE_STRING:
+      case DSA_TYPE_STRING:
         node_data.string_val = strdup(token);
         break;
       }
 
-      if (data->is_double) {
-        insert_double_at_end(data->double_list, node_data);
-      } else {
-        insert_simple_at_end(data->simple_list, node_data);
-      }
+      append_list_value(data, node_data);
       count++;
       token = strtok(NULL, " \n\t");
     }
@@ -643,49 +829,41 @@ static void on_create_list_clicked(GtkWidget *widget, gpointer user_data) {
 
   } else {
     // Mode Aléatoire
-    // Ici on utilise la taille du spinner
-    if (data->is_double) {
-      fill_double_list_random(data->double_list, size);
-    } else {
-      fill_simple_list_random(data->simple_list, size);
+    // Ici on utilise la taille du spinner ; la graine est affichée pour
+    // pouvoir rejouer le tirage
+    uint64_t seed = dsa_prng_fresh_seed();
+    dsa_prng_thread_reseed(seed);
+    switch (data->structure) {
+    case LIST_SIMPLE:
+      dsa_fill_simple_list_random(data->simple_list, size);
+      break;
+    case LIST_DOUBLE:
+      dsa_fill_double_list_random(data->double_list, size);
+      break;
+    case LIST_UNROLLED:
+      dsa_fill_unrolled_list_random(data->unrolled_list, size);
+      break;
     }
     clear_text_view(data);
-    append_to_text_view(data, "Liste créée (Aléatoire) :\n");
+    char header[96];
+    snprintf(header, sizeof(header), "Liste créée (Aléatoire, graine %llu) :\n",
+             (unsigned long long)seed);
+    append_to_text_view(data, header);
   }
 
   // 5. Affichage Textuel de la liste
-  char buffer[512];
-  if (data->is_double && data->double_list) {
-    DoubleNode *current = data->double_list->head;
-    while (current) {
-      char *str = node_data_to_string(current->data, data->current_type);
-      snprintf(buffer, sizeof(buffer), "%s -> ", str);
-      append_to_text_view(data, buffer);
-      free(str);
-      current = current->next;
-    }
-  } else if (data->simple_list) {
-    SimpleNode *current = data->simple_list->head;
-    while (current) {
-      char *str = node_data_to_string(current->data, data->current_type);
-      snprintf(buffer, sizeof(buffer), "%s -> ", str);
-      append_to_text_view(data, buffer);
-      free(str);
-      current = current->next;
-    }
-  }
-  append_to_text_view(data, "NULL\n");
+  append_list_text(data);
 
   data->has_sorted = false;
 
   // Calcul largeur requise pour le dessin
-  int list_count = 0;
-  if (data->is_double && data->double_list)
-    list_count = data->double_list->size;
-  else if (data->simple_list)
-    list_count = data->simple_list->size;
-
-  int required_width = 30 + (list_count * 115) + 150;
+  int required_width = 30 + (list_size(data) * 115) + 150;
+  if (data->structure == LIST_UNROLLED && data->unrolled_list) {
+    required_width = 30 + 150;
+    for (DsaUnrolledBlock *block = data->unrolled_list->head; block;
+         block = block->next)
+      required_width += unrolled_block_width(data->unrolled_list, block) + 25;
+  }
   if (required_width < 2000)
     required_width = 2000;
 
@@ -699,181 +877,183 @@ static void on_create_list_clicked(GtkWidget *widget, gpointer user_data) {
 static void on_sort_clicked(GtkWidget *widget, gpointer user_data) {
   ListsWindowData *data = (ListsWindowData *)user_data;
 
-  if (!data->simple_list && !data->double_list) {
+  if (!has_list(data)) {
     return;
   }
 
-  if (data->simple_list_before) {
-    free_simple_list(data->simple_list_before);
-    data->simple_list_before = NULL;
-  }
-  if (data->double_list_before) {
-    free_double_list(data->double_list_before);
-    data->double_list_before = NULL;
-  }
+  int method_index =
+      gtk_drop_down_get_selected(GTK_DROP_DOWN(data->sort_method_combo));
+  const char *method_name = SORT_METHODS[method_index].name;
 
-  if (data->is_double) {
-    data->double_list_before = copy_double_list(data->double_list);
-  } else {
-    data->simple_list_before = copy_simple_list(data->simple_list);
+  if (data->structure == LIST_UNROLLED &&
+      !SORT_METHODS[method_index].has_unrolled) {
+    char message[128];
+    snprintf(message, sizeof(message),
+             "%s : non disponible pour la liste déroulée.\n", method_name);
+    clear_text_view(data);
+    append_to_text_view(data, message);
+    return;
   }
 
-  int method_index =
-      gtk_drop_down_get_selected(GTK_DROP_DOWN(data->sort_method_combo));
+  dsa_free_simple_list(data->simple_list_before);
+  dsa_free_double_list(data->double_list_before);
+  dsa_free_unrolled_list(data->unrolled_list_before);
+  data->simple_list_before = NULL;
+  data->double_list_before = NULL;
+  data->unrolled_list_before = NULL;
 
-  const char *method_names[] = {"Tri à bulle", "Tri par insertion",
-                                "Tri Shell"};
+  switch (data->structure) {
+  case LIST_SIMPLE:
+    data->simple_list_before = dsa_copy_simple_list(data->simple_list);
+    break;
+  case LIST_DOUBLE:
+    data->double_list_before = dsa_copy_double_list(data->double_list);
+    break;
+  case LIST_UNROLLED:
+    data->unrolled_list_before = dsa_copy_unrolled_list(data->unrolled_list);
+    break;
+  }
 
-  clock_t start = clock();
+  DsaTimingMark start = dsa_timing_mark();
 
-  if (data->is_double) {
-    switch (method_index) {
-    case 0:
-      bubble_sort_double(data->double_list);
-      break;
-    case 1:
-      insertion_sort_double(data->double_list);
-      break;
-    case 2:
-      selection_sort_double(data->double_list);
-      break;
-    }
-  } else {
-    switch (method_index) {
-    case 0:
-      bubble_sort_simple(data->simple_list);
-      break;
-    case 1:
-      insertion_sort_simple(data->simple_list);
-      break;
-    case 2:
-      selection_sort_simple(data->simple_list);
-      break;
-    }
+  switch (data->structure) {
+  case LIST_SIMPLE:
+    SORT_METHODS[method_index].sort_simple(data->simple_list);
+    break;
+  case LIST_DOUBLE:
+    SORT_METHODS[method_index].sort_double(data->double_list);
+    break;
+  case LIST_UNROLLED:
+    dsa_sort_unrolled_list(data->unrolled_list,
+                           SORT_METHODS[method_index].unrolled_algo);
+    break;
   }
 
-  clock_t end = clock();
-  double time_s = ((double)(end - start) / CLOCKS_PER_SEC);
-  double time_ms = time_s * 1000; // Convertir en millisecondes
+  DsaTimingSample elapsed = dsa_timing_since(start);
+  double time_ms = dsa_timing_ns_to_ms(elapsed.ns);
 
   data->has_sorted = true;
 
   clear_text_view(data);
   char buffer[512];
-  snprintf(buffer, sizeof(buffer),
-           "Liste triée (méthode %s), Temps = %.6f ms\n",
-           method_names[method_index], time_ms);
+  if (dsa_timing_has_cycles()) {
+    snprintf(buffer, sizeof(buffer),
+             "Liste triée (méthode %s), Temps = %.6f ms (%llu cycles)\n",
+             method_name, time_ms, (unsigned long long)elapsed.cycles);
+  } else {
+    snprintf(buffer, sizeof(buffer),
+             "Liste triée (méthode %s), Temps = %.6f ms\n", method_name,
+             time_ms);
+  }
   append_to_text_view(data, buffer);
 
   gtk_widget_queue_draw(data->drawing_area_before);
   gtk_widget_queue_draw(data->drawing_area_after);
 }
 
+// Répétitions d'un tri de `size` nœuds dans le budget de la comparaison
+static int compare_iterations(int size, bool quadratic) {
+  int64_t work = quadratic ? (int64_t)size * size : size;
+  int64_t budget =
+      quadratic ? LISTS_COMPARE_QUADRATIC_WORK : LISTS_COMPARE_WORK;
+  if (work * LISTS_COMPARE_ITERATIONS <= budget)
+    return LISTS_COMPARE_ITERATIONS;
+  return work < budget ? (int)(budget / work) : 1;
+}
+
 static void on_compare_sorts_clicked(GtkWidget *widget, gpointer user_data) {
   ListsWindowData *data = (ListsWindowData *)user_data;
 
-  if (!data->simple_list && !data->double_list) {
+  if (!has_list(data)) {
     return;
   }
 
   clear_text_view(data);
   append_to_text_view(data, "--- Comparaison des Tris ---\n");
 
-  const char *methods[] = {"Tri à bulle", "Tri par insertion", "Tri Shell",
-                           "Tri rapide"};
   char buffer[256];
 
-  // Répéter le tri plusieurs fois pour obtenir une mesure précise
-  int iterations = 1000; // Augmenté pour plus de précision
+  // Répéter le tri plusieurs fois pour obtenir une mesure précise ; moins
+  // de répétitions pour les grandes listes (travail total borné, selon la
+  // complexité de chaque méthode)
+  int size = list_size(data);
+  uint64_t *samples = malloc(LISTS_COMPARE_ITERATIONS * sizeof(uint64_t));
+  if (!samples)
+    return;
 
-  for (int i = 0; i < 4; i++) {
-    clock_t total_time = 0;
+  for (size_t i = 0; i < SORT_METHOD_COUNT; i++) {
+    const char *name = SORT_METHODS[i].name;
+    if (SORT_METHODS[i].quadratic && size > LISTS_COMPARE_QUADRATIC_LIMIT) {
+      snprintf(buffer, sizeof(buffer),
+               "%s: ignoré (O(n²), plus de %d nœuds)\n", name,
+               LISTS_COMPARE_QUADRATIC_LIMIT);
+      append_to_text_view(data, buffer);
+      continue;
+    }
+    if (data->structure == LIST_UNROLLED && !SORT_METHODS[i].has_unrolled) {
+      snprintf(buffer, sizeof(buffer),
+               "%s: non disponible pour la liste déroulée\n", name);
+      append_to_text_view(data, buffer);
+      continue;
+    }
 
+    int iterations = compare_iterations(size, SORT_METHODS[i].quadratic);
     for (int iter = 0; iter < iterations; iter++) {
-      SimpleList *test_simple = NULL;
-      DoubleList *test_double = NULL;
+      DsaSimpleList *test_simple = NULL;
+      DsaDoubleList *test_double = NULL;
+      DsaUnrolledList *test_unrolled = NULL;
 
-      if (data->is_double) {
-        test_double = copy_double_list(data->double_list);
-      } else {
-        test_simple = copy_simple_list(data->simple_list);
+      switch (data->structure) {
+      case LIST_SIMPLE:
+        test_simple = dsa_copy_simple_list(data->simple_list);
+        break;
+      case LIST_DOUBLE:
+        test_double = dsa_copy_double_list(data->double_list);
+        break;
+      case LIST_UNROLLED:
+        test_unrolled = dsa_copy_unrolled_list(data->unrolled_list);
+        break;
       }
 
-      clock_t start = clock();
+      DsaTimingMark start = dsa_timing_mark();
 
-      if (data->is_double) {
-        switch (i) {
-        case 0:
-          bubble_sort_double(test_double);
-          break;
-        case 1:
-          insertion_sort_double(test_double);
-          break;
-        case 2:
-          selection_sort_double(test_double);
-          break;
-        case 3:
-          selection_sort_double(test_double); // Utiliser selection pour rapide
-          break;
-        }
-      } else {
-        switch (i) {
-        case 0:
-          bubble_sort_simple(test_simple);
-          break;
-        case 1:
-          insertion_sort_simple(test_simple);
-          break;
-        case 2:
-          selection_sort_simple(test_simple);
-          break;
-        case 3:
-          selection_sort_simple(test_simple); // Utiliser selection pour rapide
-          break;
-        }
+      switch (data->structure) {
+      case LIST_SIMPLE:
+        SORT_METHODS[i].sort_simple(test_simple);
+        break;
+      case LIST_DOUBLE:
+        SORT_METHODS[i].sort_double(test_double);
+        break;
+      case LIST_UNROLLED:
+        dsa_sort_unrolled_list(test_unrolled, SORT_METHODS[i].unrolled_algo);
+        break;
       }
 
-      clock_t end = clock();
-      total_time += (end - start);
+      samples[iter] = dsa_timing_since(start).ns;
 
-      if (test_simple)
-        free_simple_list(test_simple);
-      if (test_double)
-        free_double_list(test_double);
+      dsa_free_simple_list(test_simple);
+      dsa_free_double_list(test_double);
+      dsa_free_unrolled_list(test_unrolled);
     }
 
-    // Calculer le temps moyen
-    double avg_time_s = ((double)total_time / CLOCKS_PER_SEC) / iterations;
-    double avg_time_ms = avg_time_s * 1000; // Convertir en millisecondes
-
-    snprintf(buffer, sizeof(buffer), "%s: %.6f ms\n", methods[i], avg_time_ms);
+    // Médiane, minimum et 99e centile (moins sensibles aux interruptions
+    // que la moyenne)
+    DsaTimingStats stats = dsa_timing_stats(samples, iterations);
+    snprintf(buffer, sizeof(buffer),
+             "%s: médiane %.6f ms (min %.6f ms, p99 %.6f ms, %d "
+             "itérations)\n",
+             name, dsa_timing_ns_to_ms(stats.median_ns),
+             dsa_timing_ns_to_ms(stats.min_ns),
+             dsa_timing_ns_to_ms(stats.p99_ns), iterations);
     append_to_text_view(data, buffer);
   }
-
-  snprintf(buffer, sizeof(buffer), "\n(Moyenne sur %d itérations)\n",
-           iterations);
-  append_to_text_view(data, buffer);
+  free(samples);
 }
 
 static void on_reset_clicked(GtkWidget *widget, gpointer user_data) {
   ListsWindowData *data = (ListsWindowData *)user_data;
 
-  if (data->simple_list) {
-    free_simple_list(data->simple_list);
-    data->simple_list = NULL;
-  }
-  if (data->simple_list_before) {
-    free_simple_list(data->simple_list_before);
-    data->simple_list_before = NULL;
-  }
-  if (data->double_list) {
-    free_double_list(data->double_list);
-    data->double_list = NULL;
-  }
-  if (data->double_list_before) {
-    free_double_list(data->double_list_before);
-    data->double_list_before = NULL;
-  }
+  free_lists(data);
 
   data->has_sorted = false;
   clear_text_view(data);
@@ -885,7 +1065,7 @@ static void on_reset_clicked(GtkWidget *widget, gpointer user_data) {
 static void on_save_clicked(GtkWidget *widget, gpointer user_data) {
   ListsWindowData *data = (ListsWindowData *)user_data;
 
-  if (!data->simple_list && !data->double_list) {
+  if (!has_list(data)) {
     return;
   }
 
@@ -896,28 +1076,43 @@ static void on_save_clicked(GtkWidget *widget, gpointer user_data) {
 
   fprintf(file, "=== Résultats Liste ===\n");
   fprintf(file, "Type: %s\n",
-          data->current_type == TYPE_INT     ? "Entier"
-          : data->current_type == TYPE_FLOAT ? "Réel"
-          : data->current_type == TYPE_CHAR  ? "Caractère"
-                                             : "Chaîne");
-  fprintf(file, "Structure: %s\n", data->is_double ? "Double" : "Simple");
-
-  if (data->is_double && data->double_list) {
+          data->current_type == DSA_TYPE_INT     ? "Entier"
+          : data->current_type == DSA_TYPE_FLOAT ? "Réel"
+          : data->current_type == DSA_TYPE_CHAR  ? "Caractère"
+                                                 : "Chaîne");
+  fprintf(file, "Structure: %s\n",
+          data->structure == LIST_DOUBLE     ? "Double"
+          : data->structure == LIST_UNROLLED ? "Déroulée"
+                                             : "Simple");
+
+  if (data->structure == LIST_DOUBLE && data->double_list) {
     fprintf(file, "Taille: %d\n", data->double_list->size);
     fprintf(file, "Éléments: ");
-    DoubleNode *current = data->double_list->head;
+    DsaDoubleNode *current = data->double_list->head;
     while (current) {
-      char *str = node_data_to_string(current->data, data->current_type);
+      char *str = dsa_node_data_to_string(current->data, data->current_type);
       fprintf(file, "%s ", str);
       free(str);
       current = current->next;
     }
+  } else if (data->structure == LIST_UNROLLED && data->unrolled_list) {
+    DsaUnrolledList *list = data->unrolled_list;
+    fprintf(file, "Taille: %d\n", list->size);
+    fprintf(file, "Éléments: ");
+    for (DsaUnrolledBlock *block = list->head; block; block = block->next) {
+      for (int i = 0; i < block->count; i++) {
+        char *str = dsa_node_data_to_string(
+            dsa_unrolled_block_value(list, block, i), data->current_type);
+        fprintf(file, "%s ", str);
+        free(str);
+      }
+    }
   } else if (data->simple_list) {
     fprintf(file, "Taille: %d\n", data->simple_list->size);
     fprintf(file, "Éléments: ");
-    SimpleNode *current = data->simple_list->head;
+    DsaSimpleNode *current = data->simple_list->head;
     while (current) {
-      char *str = node_data_to_string(current->data, data->current_type);
+      char *str = dsa_node_data_to_string(current->data, data->current_type);
       fprintf(file, "%s ", str);
       free(str);
       current = current->next;
@@ -932,7 +1127,7 @@ static void on_save_clicked(GtkWidget *widget, gpointer user_data) {
 static void on_insert_operation(GtkWidget *widget, gpointer user_data) {
   ListsWindowData *data = (ListsWindowData *)user_data;
 
-  if (!data->simple_list && !data->double_list)
+  if (!has_list(data))
     return;
 
   const char *value_text =
@@ -943,37 +1138,45 @@ static void on_insert_operation(GtkWidget *widget, gpointer user_data) {
       gtk_editable_get_text(GTK_EDITABLE(data->index_entry));
   int index = atoi(index_text);
 
-  NodeData node_data;
+  DsaNodeData node_data;
   switch (data->current_type) {
-  case TYPE_INT:
+  case DSA_TYPE_INT:
     node_data.int_val = atoi(value_text);
     break;
-  case TYPE_FLOAT:
+  case DSA_TYPE_FLOAT:
     node_data.float_val = atof(value_text);
     break;
-  case TYPE_CHAR:
+  case DSA_TYPE_CHAR:
     node_data.char_val = value_text[0];
     break;
-  case TYPE_STRING:
+  case DSA_TYPE_STRING:
     node_data.string_val = strdup(value_text);
     break;
   }
 
-  if (data->is_double) {
+  if (data->structure == LIST_DOUBLE) {
     if (position_idx == 0) {
-      insert_double_at_beginning(data->double_list, node_data);
+      dsa_insert_double_at_beginning(data->double_list, node_data);
     } else if (position_idx == 1) {
-      insert_double_at_end(data->double_list, node_data);
+      dsa_insert_double_at_end(data->double_list, node_data);
     } else {
-      insert_double_at_position(data->double_list, node_data, index);
+      dsa_insert_double_at_position(data->double_list, node_data, index);
+    }
+  } else if (data->structure == LIST_UNROLLED) {
+    if (position_idx == 0) {
+      dsa_insert_unrolled_at_beginning(data->unrolled_list, node_data);
+    } else if (position_idx == 1) {
+      dsa_insert_unrolled_at_end(data->unrolled_list, node_data);
+    } else {
+      dsa_insert_unrolled_at_position(data->unrolled_list, node_data, index);
     }
   } else {
     if (position_idx == 0) {
-      insert_simple_at_beginning(data->simple_list, node_data);
+      dsa_insert_simple_at_beginning(data->simple_list, node_data);
     } else if (position_idx == 1) {
-      insert_simple_at_end(data->simple_list, node_data);
+      dsa_insert_simple_at_end(data->simple_list, node_data);
     } else {
-      insert_simple_at_position(data->simple_list, node_data, index);
+      dsa_insert_simple_at_position(data->simple_list, node_data, index);
     }
   }
 
@@ -986,17 +1189,19 @@ static void on_insert_operation(GtkWidget *widget, gpointer user_data) {
 static void on_delete_operation(GtkWidget *widget, gpointer user_data) {
   ListsWindowData *data = (ListsWindowData *)user_data;
 
-  if (!data->simple_list && !data->double_list)
+  if (!has_list(data))
     return;
 
   const char *index_text =
       gtk_editable_get_text(GTK_EDITABLE(data->index_entry));
   int index = atoi(index_text);
 
-  if (data->is_double) {
-    delete_double_at_position(data->double_list, index);
+  if (data->structure == LIST_DOUBLE) {
+    dsa_delete_double_at_position(data->double_list, index);
+  } else if (data->structure == LIST_UNROLLED) {
+    dsa_delete_unrolled_at_position(data->unrolled_list, index);
   } else {
-    delete_simple_at_position(data->simple_list, index);
+    dsa_delete_simple_at_position(data->simple_list, index);
   }
 
   gtk_editable_set_text(GTK_EDITABLE(data->index_entry), "");
@@ -1008,7 +1213,7 @@ static void on_delete_operation(GtkWidget *widget, gpointer user_data) {
 static void on_modify_operation(GtkWidget *widget, gpointer user_data) {
   ListsWindowData *data = (ListsWindowData *)user_data;
 
-  if (!data->simple_list && !data->double_list)
+  if (!has_list(data))
     return;
 
   const char *value_text =
@@ -1017,26 +1222,28 @@ static void on_modify_operation(GtkWidget *widget, gpointer user_data) {
       gtk_editable_get_text(GTK_EDITABLE(data->index_entry));
   int index = atoi(index_text);
 
-  NodeData node_data;
+  DsaNodeData node_data;
   switch (data->current_type) {
-  case TYPE_INT:
+  case DSA_TYPE_INT:
     node_data.int_val = atoi(value_text);
     break;
-  case TYPE_FLOAT:
+  case DSA_TYPE_FLOAT:
     node_data.float_val = atof(value_text);
     break;
-  case TYPE_CHAR:
+  case DSA_TYPE_CHAR:
     node_data.char_val = value_text[0];
     break;
-  case TYPE_STRING:
+  case DSA_TYPE_STRING:
     node_data.string_val = strdup(value_text);
     break;
   }
 
-  if (data->is_double) {
-    modify_double_at_position(data->double_list, node_data, index);
+  if (data->structure == LIST_DOUBLE) {
+    dsa_modify_double_at_position(data->double_list, node_data, index);
+  } else if (data->structure == LIST_UNROLLED) {
+    dsa_modify_unrolled_at_position(data->unrolled_list, node_data, index);
   } else {
-    modify_simple_at_position(data->simple_list, node_data, index);
+    dsa_modify_simple_at_position(data->simple_list, node_data, index);
   }
 
   gtk_editable_set_text(GTK_EDITABLE(data->value_entry), "");
@@ -1049,18 +1256,7 @@ static void on_modify_operation(GtkWidget *widget, gpointer user_data) {
 static void on_window_destroy(GtkWidget *widget, gpointer user_data) {
   ListsWindowData *data = (ListsWindowData *)user_data;
 
-  if (data->simple_list) {
-    free_simple_list(data->simple_list);
-  }
-  if (data->simple_list_before) {
-    free_simple_list(data->simple_list_before);
-  }
-  if (data->double_list) {
-    free_double_list(data->double_list);
-  }
-  if (data->double_list_before) {
-    free_double_list(data->double_list_before);
-  }
+  free_lists(data);
   free(data);
 }
 
@@ -1088,20 +1284,20 @@ typedef struct {
 static void on_edit_dialog_ok(GtkWidget *btn, gpointer user_data) {
   EditDialogData *dlg = (EditDialogData *)user_data;
   const char *text = gtk_editable_get_text(GTK_EDITABLE(dlg->entry));
-  NodeData val = {0};
+  DsaNodeData val = {0};
   bool valid = true;
 
   switch (dlg->data->current_type) {
-  case TYPE_INT:
+  case DSA_TYPE_INT:
     val.int_val = atoi(text);
     break;
-  case TYPE_FLOAT:
+  case DSA_TYPE_FLOAT:
     val.float_val = atof(text);
     break;
-  case TYPE_CHAR:
+  case DSA_TYPE_CHAR:
     val.char_val = text[0];
     break;
-  case TYPE_STRING:
+  case DSA_TYPE_STRING:
     val.string_val = strdup(text);
     break;
   }
@@ -1110,22 +1306,30 @@ static void on_edit_dialog_ok(GtkWidget *btn, gpointer user_data) {
     // Si la liste était triée, on annule le tri et on modifie la liste
     // originale
     if (dlg->data->has_sorted) {
-      if (dlg->data->is_double) {
+      if (dlg->data->structure == LIST_DOUBLE) {
         if (dlg->data->double_list)
-          free_double_list(dlg->data->double_list); // Free sorted
+          dsa_free_double_list(dlg->data->double_list); // Free sorted
         dlg->data->double_list =
             dlg->data->double_list_before; // Restore original
         dlg->data->double_list_before = NULL;
 
-        modify_double_at_position(dlg->data->double_list, val, dlg->index);
+        dsa_modify_double_at_position(dlg->data->double_list, val, dlg->index);
+      } else if (dlg->data->structure == LIST_UNROLLED) {
+        dsa_free_unrolled_list(dlg->data->unrolled_list); // Free sorted
+        dlg->data->unrolled_list =
+            dlg->data->unrolled_list_before; // Restore original
+        dlg->data->unrolled_list_before = NULL;
+
+        dsa_modify_unrolled_at_position(dlg->data->unrolled_list, val,
+                                        dlg->index);
       } else {
         if (dlg->data->simple_list)
-          free_simple_list(dlg->data->simple_list); // Free sorted
+          dsa_free_simple_list(dlg->data->simple_list); // Free sorted
         dlg->data->simple_list =
             dlg->data->simple_list_before; // Restore original
         dlg->data->simple_list_before = NULL;
 
-        modify_simple_at_position(dlg->data->simple_list, val, dlg->index);
+        dsa_modify_simple_at_position(dlg->data->simple_list, val, dlg->index);
       }
       dlg->data->has_sorted = false;
 
@@ -1135,36 +1339,17 @@ static void on_edit_dialog_ok(GtkWidget *btn, gpointer user_data) {
                           "Modification effectuée. Tri réinitialisé.\n");
 
       // Réafficher la liste courante
-      char buffer[512];
-      if (dlg->data->is_double && dlg->data->double_list) {
-        DoubleNode *current = dlg->data->double_list->head;
-        while (current) {
-          char *str =
-              node_data_to_string(current->data, dlg->data->current_type);
-          snprintf(buffer, sizeof(buffer), "%s -> ", str);
-          append_to_text_view(dlg->data, buffer);
-          free(str);
-          current = current->next;
-        }
-      } else if (dlg->data->simple_list) {
-        SimpleNode *current = dlg->data->simple_list->head;
-        while (current) {
-          char *str =
-              node_data_to_string(current->data, dlg->data->current_type);
-          snprintf(buffer, sizeof(buffer), "%s -> ", str);
-          append_to_text_view(dlg->data, buffer);
-          free(str);
-          current = current->next;
-        }
-      }
-      append_to_text_view(dlg->data, "NULL\n");
+      append_list_text(dlg->data);
 
     } else {
       // Cas normal : modification directe
-      if (dlg->data->is_double) {
-        modify_double_at_position(dlg->data->double_list, val, dlg->index);
+      if (dlg->data->structure == LIST_DOUBLE) {
+        dsa_modify_double_at_position(dlg->data->double_list, val, dlg->index);
+      } else if (dlg->data->structure == LIST_UNROLLED) {
+        dsa_modify_unrolled_at_position(dlg->data->unrolled_list, val,
+                                        dlg->index);
       } else {
-        modify_simple_at_position(dlg->data->simple_list, val, dlg->index);
+        dsa_modify_simple_at_position(dlg->data->simple_list, val, dlg->index);
       }
 
       // Rafraichir le log
@@ -1217,7 +1402,7 @@ static void on_list_click(GtkGestureClick *gesture, int n_press, double x,
   ListsWindowData *data = (ListsWindowData *)user_data;
 
   // Vérifier qu'il y a une liste
-  if (!data->simple_list && !data->double_list)
+  if (!has_list(data))
     return;
 
   // Paramètres de dessin (doivent correspondre avec on_draw)
@@ -1245,16 +1430,30 @@ static void on_list_click(GtkGestureClick *gesture, int n_press, double x,
   int index = rel_x / total_width;
   int offset = rel_x % total_width;
 
+  // Liste déroulée : blocs de largeurs variables, une case par valeur
+  if (data->structure == LIST_UNROLLED) {
+    DsaUnrolledList *list = data->has_sorted ? data->unrolled_list_before
+                                             : data->unrolled_list;
+    int first = 0;
+    index = -1;
+    for (DsaUnrolledBlock *block = list ? list->head : NULL; block;
+         block = block->next) {
+      if (rel_x < block->count * UNROLLED_CELL_WIDTH) {
+        index = first + rel_x / UNROLLED_CELL_WIDTH;
+        break;
+      }
+      rel_x -= unrolled_block_width(list, block) + arrow_length;
+      if (rel_x < 0)
+        return; // Clic sur les places libres, le pointeur ou la flèche
+      first += block->count;
+    }
+    offset = 0;
+  }
+
   if (offset > node_width)
     return; // Clic sur la flèche
 
-  int size = 0;
-  if (data->is_double && data->double_list)
-    size = data->double_list->size;
-  else if (data->simple_list)
-    size = data->simple_list->size;
-
-  if (index >= 0 && index < size) {
+  if (index >= 0 && index < list_size(data)) {
     prompt_node_edit(data, index);
   }
 }
@@ -1302,7 +1501,7 @@ void open_lists_window(GtkWindow *parent) {
   gtk_widget_set_halign(struct_label, GTK_ALIGN_START);
   gtk_box_append(GTK_BOX(sidebar), struct_label);
 
-  const char *structures[] = {"Simple", "Double", NULL};
+  const char *structures[] = {"Simple", "Double", "Déroulée", NULL};
   data->structure_combo = gtk_drop_down_new_from_strings(structures);
   gtk_box_append(GTK_BOX(sidebar), data->structure_combo);
 
@@ -1355,7 +1554,8 @@ void open_lists_window(GtkWindow *parent) {
   gtk_widget_set_halign(method_label, GTK_ALIGN_START);
   gtk_box_append(GTK_BOX(sidebar), method_label);
 
-  const char *sort_methods[] = {"Tri à bulle", "Tri par insertion", "Tri Shell",
+  const char *sort_methods[] = {"Tri à bulle", "Tri par insertion",
+                                "Tri par sélection", "Tri fusion",
                                 "Tri rapide", NULL};
   data->sort_method_combo = gtk_drop_down_new_from_strings(sort_methods);
   gtk_box_append(GTK_BOX(sidebar), data->sort_method_combo);
@@ -1529,8 +1729,10 @@ void open_lists_window(GtkWindow *parent) {
   data->simple_list_before = NULL;
   data->double_list = NULL;
   data->double_list_before = NULL;
-  data->current_type = TYPE_INT;
-  data->is_double = false;
+  data->current_type = DSA_TYPE_INT;
+  data->unrolled_list = NULL;
+  data->unrolled_list_before = NULL;
+  data->structure = LIST_SIMPLE;
   data->is_manual_mode = false;
   data->has_sorted = false;
 
@@ -0,0 +1,54 @@
+#include "node_pool.h"
+#include "scratch_pool.h"
+#include <stdlib.h>
+
+void dsa_node_pool_init(DsaNodePool *pool, size_t node_size, bool enabled) {
+  size_t word = sizeof(void *);
+  pool->node_size = (node_size + word - 1) / word * word;
+  pool->enabled = enabled;
+  pool->blocks = NULL;
+  pool->free_nodes = NULL;
+  pool->cursor = NULL;
+  pool->end = NULL;
+  pool->next_block = DSA_NODE_POOL_FIRST_BLOCK;
+}
+
+void *dsa_node_pool_grow(DsaNodePool *pool) {
+  if (!pool->enabled)
+    return malloc(pool->node_size);
+
+  // Le premier emplacement du bloc sert de lien vers le bloc précédent
+  size_t count = pool->next_block;
+  char *block = dsa_aligned_buffer_alloc((count + 1) * pool->node_size);
+  if (!block)
+    return NULL;
+  *(void **)block = pool->blocks;
+  pool->blocks = block;
+  if (pool->next_block < DSA_NODE_POOL_MAX_BLOCK)
+    pool->next_block *= 2;
+
+  pool->cursor = block + 2 * pool->node_size;
+  pool->end = block + (count + 1) * pool->node_size;
+  return block + pool->node_size;
+}
+
+void dsa_node_pool_free(DsaNodePool *pool, void *node) {
+  if (!node)
+    return;
+  if (!pool->enabled) {
+    free(node);
+    return;
+  }
+  *(void **)node = pool->free_nodes;
+  pool->free_nodes = node;
+}
+
+void dsa_node_pool_release(DsaNodePool *pool) {
+  void *block = pool->blocks;
+  while (block) {
+    void *previous = *(void **)block;
+    dsa_aligned_buffer_free(block);
+    block = previous;
+  }
+  dsa_node_pool_init(pool, pool->node_size, pool->enabled);
+}
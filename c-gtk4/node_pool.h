@@ -0,0 +1,59 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Réserve de nœuds de taille fixe propre à une liste : les nœuds sont
+// découpés dans des blocs contigus (alignés sur une ligne de cache, de
+// taille doublée à chaque bloc), les nœuds rendus sont recyclés par une
+// liste libre, et tous les blocs sont libérés d'un coup avec la liste.
+// Les nœuds voisins à la création le restent en mémoire, sans en-tête de
+// malloc entre eux ; la mémoire des nœuds rendus n'est réutilisée que par
+// la même liste.
+//
+// Une réserve désactivée (`enabled` à false) alloue chaque nœud par
+// malloc et le libère par free : dsa_node_pool_release ne libère alors rien et
+// chaque nœud doit être rendu (comparaison des deux stratégies).
+
+// Nœuds du premier bloc et nombre maximal de nœuds par bloc
+#define DSA_NODE_POOL_FIRST_BLOCK 64
+#define DSA_NODE_POOL_MAX_BLOCK 2048
+
+typedef struct {
+  size_t node_size; // Multiple de sizeof(void *)
+  bool enabled;
+  void *blocks;      // Dernier bloc ; chaque bloc commence par un lien
+  void *free_nodes;  // Nœuds rendus, chaînés par leur premier mot
+  char *cursor;      // Prochain nœud jamais servi du dernier bloc
+  char *end;         // Fin du dernier bloc
+  size_t next_block; // Nœuds du prochain bloc
+} DsaNodePool;
+
+void dsa_node_pool_init(DsaNodePool *pool, size_t node_size, bool enabled);
+
+// Ajoute un bloc et en sert le premier nœud (chemin lent de l'allocation)
+void *dsa_node_pool_grow(DsaNodePool *pool);
+
+// Nœud non initialisé ; NULL si la mémoire manque
+static inline void *dsa_node_pool_alloc(DsaNodePool *pool) {
+  if (pool->free_nodes) {
+    void *node = pool->free_nodes;
+    pool->free_nodes = *(void **)node;
+    return node;
+  }
+  if (pool->cursor != pool->end) {
+    void *node = pool->cursor;
+    pool->cursor += pool->node_size;
+    return node;
+  }
+  return dsa_node_pool_grow(pool);
+}
+
+void dsa_node_pool_free(DsaNodePool *pool, void *node);
+
+// Libère tous les blocs (les nœuds servis deviennent invalides) ; la
+// réserve reste utilisable
+void dsa_node_pool_release(DsaNodePool *pool);
+
+#endif
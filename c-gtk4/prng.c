@@ -0,0 +1,224 @@
+#include "prng.h"
+#include "timing.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define PRNG_X86 1
+#include <immintrin.h>
+#endif
+
+// splitmix64 : étale une graine quelconque (même 0) sur les 256 bits d'état
+static uint64_t splitmix64(uint64_t *x) {
+  uint64_t z = (*x += 0x9e3779b97f4a7c15ull);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+  return z ^ (z >> 31);
+}
+
+void dsa_prng_seed(DsaPrng *rng, uint64_t seed) {
+  for (int i = 0; i < 4; i++)
+    rng->s[i] = splitmix64(&seed);
+}
+
+uint64_t dsa_prng_fresh_seed(void) {
+  // Le compteur distingue deux appels dans la même nanoseconde
+  static atomic_uint_fast64_t counter;
+  uint64_t x = dsa_timing_now_ns() ^
+               (atomic_fetch_add(&counter, 1) * 0x9e3779b97f4a7c15ull);
+  return splitmix64(&x);
+}
+
+// Réduction de Lemire (multiplication 32 x 32 -> 64 bits) : pas de division
+// sauf dans le cas rare où le tirage tombe dans la zone de rejet
+uint32_t dsa_prng_bounded(DsaPrng *rng, uint32_t bound) {
+  uint64_t m = (uint64_t)dsa_prng_next32(rng) * bound;
+  uint32_t low = (uint32_t)m;
+  if (low < bound) {
+    uint32_t threshold = (uint32_t)-bound % bound;
+    while (low < threshold) {
+      m = (uint64_t)dsa_prng_next32(rng) * bound;
+      low = (uint32_t)m;
+    }
+  }
+  return (uint32_t)(m >> 32);
+}
+
+double dsa_prng_double(DsaPrng *rng) {
+  // 53 bits de poids fort -> mantisse d'un double
+  return (double)(dsa_prng_next(rng) >> 11) * 0x1.0p-53;
+}
+
+// Polynômes de saut publiés avec xoshiro256**
+static void jump_with(DsaPrng *rng, const uint64_t poly[4]) {
+  uint64_t acc[4] = {0, 0, 0, 0};
+  for (int i = 0; i < 4; i++) {
+    for (int b = 0; b < 64; b++) {
+      if (poly[i] & (1ull << b)) {
+        for (int k = 0; k < 4; k++)
+          acc[k] ^= rng->s[k];
+      }
+      dsa_prng_next(rng);
+    }
+  }
+  memcpy(rng->s, acc, sizeof(acc));
+}
+
+void dsa_prng_jump(DsaPrng *rng) {
+  static const uint64_t JUMP[4] = {
+      0x180ec6d33cfd0abaull, 0xd5a61266f0c9392cull, 0xa9582618e03fc9aaull,
+      0x39abdc4529b1661cull};
+  jump_with(rng, JUMP);
+}
+
+void dsa_prng_long_jump(DsaPrng *rng) {
+  static const uint64_t LONG_JUMP[4] = {
+      0x76e15d3efefdcbbfull, 0xc5004e441c522fb3ull, 0x77710069854ee241ull,
+      0x39109bb02acbe635ull};
+  jump_with(rng, LONG_JUMP);
+}
+
+// --- Remplissage en bloc ---
+// La sortie i vient de la voie i % DSA_PRNG_FILL_LANES ; le noyau AVX2 calcule
+// deux groupes de quatre voies (64 bits par voie) en parallèle, le noyau
+// scalaire les enchaîne dans le même ordre.
+
+static inline uint32_t reduce(uint64_t x, uint32_t bound) {
+  uint32_t high = (uint32_t)(x >> 32);
+  return bound ? (uint32_t)(((uint64_t)high * bound) >> 32) : high;
+}
+
+static size_t fill_scalar(DsaPrng lanes[DSA_PRNG_FILL_LANES], uint32_t *out,
+                          size_t begin, size_t count, uint32_t bound) {
+  for (size_t i = begin; i < count; i++)
+    out[i] = reduce(dsa_prng_next(&lanes[i % DSA_PRNG_FILL_LANES]), bound);
+  return count;
+}
+
+#ifdef PRNG_X86
+
+static bool fill_use_avx2 = false;
+static pthread_once_t fill_once = PTHREAD_ONCE_INIT;
+
+static void fill_detect(void) {
+  __builtin_cpu_init();
+  fill_use_avx2 = __builtin_cpu_supports("avx2");
+}
+
+#define XOSHIRO_ROTL(x, k)                                                     \
+  _mm256_or_si256(_mm256_slli_epi64((x), (k)), _mm256_srli_epi64((x), 64 - (k)))
+
+// Une étape de xoshiro256** sur quatre voies ; retourne les 32 bits de poids
+// fort de chaque sortie (réduits si bound != 0) dans les moitiés basses
+#define XOSHIRO_STEP(s, result)                                                \
+  do {                                                                         \
+    __m256i x = _mm256_add_epi64(_mm256_slli_epi64(s[1], 2), s[1]);            \
+    x = XOSHIRO_ROTL(x, 7);                                                    \
+    x = _mm256_add_epi64(_mm256_slli_epi64(x, 3), x);                          \
+    __m256i t = _mm256_slli_epi64(s[1], 17);                                   \
+    s[2] = _mm256_xor_si256(s[2], s[0]);                                       \
+    s[3] = _mm256_xor_si256(s[3], s[1]);                                       \
+    s[1] = _mm256_xor_si256(s[1], s[2]);                                       \
+    s[0] = _mm256_xor_si256(s[0], s[3]);                                       \
+    s[2] = _mm256_xor_si256(s[2], t);                                          \
+    s[3] = XOSHIRO_ROTL(s[3], 45);                                             \
+    result = _mm256_srli_epi64(x, 32);                                         \
+    if (bound)                                                                 \
+      result = _mm256_srli_epi64(_mm256_mul_epu32(result, vbound), 32);        \
+  } while (0)
+
+__attribute__((target("avx2"))) static size_t
+fill_avx2(DsaPrng lanes[DSA_PRNG_FILL_LANES], uint32_t *out, size_t count,
+          uint32_t bound) {
+  __m256i a[4], b[4];
+  for (int k = 0; k < 4; k++) {
+    a[k] = _mm256_setr_epi64x(
+        (long long)lanes[0].s[k], (long long)lanes[1].s[k],
+        (long long)lanes[2].s[k], (long long)lanes[3].s[k]);
+    b[k] = _mm256_setr_epi64x(
+        (long long)lanes[4].s[k], (long long)lanes[5].s[k],
+        (long long)lanes[6].s[k], (long long)lanes[7].s[k]);
+  }
+  const __m256i vbound = _mm256_set1_epi64x(bound);
+  // Regroupe les moitiés basses des quatre mots de 64 bits
+  const __m256i pack = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+
+  size_t i = 0;
+  for (; i + DSA_PRNG_FILL_LANES <= count; i += DSA_PRNG_FILL_LANES) {
+    __m256i ra, rb;
+    XOSHIRO_STEP(a, ra);
+    XOSHIRO_STEP(b, rb);
+    ra = _mm256_permutevar8x32_epi32(ra, pack);
+    rb = _mm256_permutevar8x32_epi32(rb, pack);
+    _mm256_storeu_si256((__m256i *)(out + i),
+                        _mm256_permute2x128_si256(ra, rb, 0x20));
+  }
+
+  uint64_t sa[4][4], sb[4][4];
+  for (int k = 0; k < 4; k++) {
+    _mm256_storeu_si256((__m256i *)sa[k], a[k]);
+    _mm256_storeu_si256((__m256i *)sb[k], b[k]);
+  }
+  for (int lane = 0; lane < 4; lane++) {
+    for (int k = 0; k < 4; k++) {
+      lanes[lane].s[k] = sa[k][lane];
+      lanes[lane + 4].s[k] = sb[k][lane];
+    }
+  }
+  return i;
+}
+
+#endif
+
+const char *dsa_prng_fill_isa(void) {
+#ifdef PRNG_X86
+  pthread_once(&fill_once, fill_detect);
+  if (fill_use_avx2)
+    return "AVX2";
+#endif
+  return "scalaire";
+}
+
+void dsa_prng_fill_u32(DsaPrng *rng, uint32_t *out, size_t count,
+                       uint32_t bound) {
+  DsaPrng lanes[DSA_PRNG_FILL_LANES];
+  lanes[0] = *rng;
+  for (int lane = 1; lane < DSA_PRNG_FILL_LANES; lane++) {
+    lanes[lane] = lanes[lane - 1];
+    dsa_prng_long_jump(&lanes[lane]);
+  }
+
+  size_t done = 0;
+#ifdef PRNG_X86
+  pthread_once(&fill_once, fill_detect);
+  if (fill_use_avx2)
+    done = fill_avx2(lanes, out, count, bound);
+#endif
+  fill_scalar(lanes, out, done, count, bound);
+  dsa_prng_jump(rng);
+}
+
+// --- Générateur du thread courant ---
+
+static _Thread_local DsaPrng thread_rng;
+static _Thread_local uint64_t thread_seed;
+static _Thread_local bool thread_seeded;
+
+void dsa_prng_thread_reseed(uint64_t seed) {
+  dsa_prng_seed(&thread_rng, seed);
+  thread_seed = seed;
+  thread_seeded = true;
+}
+
+DsaPrng *dsa_prng_thread(void) {
+  if (!thread_seeded)
+    dsa_prng_thread_reseed(dsa_prng_fresh_seed());
+  return &thread_rng;
+}
+
+uint64_t dsa_prng_thread_seed(void) {
+  dsa_prng_thread();
+  return thread_seed;
+}
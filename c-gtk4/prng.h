@@ -0,0 +1,82 @@
+#ifndef PRNG_H
+#define PRNG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Générateur pseudo-aléatoire xoshiro256** (Blackman & Vigna) : rapide,
+// période 2^256 - 1, état propre à chaque instance (pas d'état global comme
+// rand()). Une même graine redonne toujours la même suite.
+typedef struct {
+  uint64_t s[4];
+} DsaPrng;
+
+// Initialise l'état à partir d'une graine 64 bits (développée par splitmix64)
+void dsa_prng_seed(DsaPrng *rng, uint64_t seed);
+
+// Graine différente à chaque appel (horloge et compteur), pour les tirages
+// qui n'ont pas besoin d'être reproductibles
+uint64_t dsa_prng_fresh_seed(void);
+
+static inline uint64_t dsa_prng_rotl(uint64_t x, int k) {
+  return (x << k) | (x >> (64 - k));
+}
+
+// Entier 64 bits uniforme
+static inline uint64_t dsa_prng_next(DsaPrng *rng) {
+  uint64_t *s = rng->s;
+  uint64_t result = dsa_prng_rotl(s[1] * 5, 7) * 9;
+  uint64_t t = s[1] << 17;
+  s[2] ^= s[0];
+  s[3] ^= s[1];
+  s[1] ^= s[2];
+  s[0] ^= s[3];
+  s[2] ^= t;
+  s[3] = dsa_prng_rotl(s[3], 45);
+  return result;
+}
+
+// Entier 32 bits uniforme (bits de poids fort, les meilleurs)
+static inline uint32_t dsa_prng_next32(DsaPrng *rng) {
+  return (uint32_t)(dsa_prng_next(rng) >> 32);
+}
+
+// Entier uniforme dans [0, bound) sans biais ; bound > 0
+uint32_t dsa_prng_bounded(DsaPrng *rng, uint32_t bound);
+
+// Réel uniforme dans [0, 1)
+double dsa_prng_double(DsaPrng *rng);
+
+// Sauts de 2^128 et 2^192 tirages : flux indépendants pour plusieurs threads
+// ou plusieurs voies SIMD à partir d'une seule graine
+void dsa_prng_jump(DsaPrng *rng);
+void dsa_prng_long_jump(DsaPrng *rng);
+
+// --- Remplissage en bloc ---
+// Écrit `count` entiers dans [0, bound) (bound = 0 : 32 bits bruts) par la
+// réduction multiplication-décalage de Lemire, sans division ni rejet (biais
+// inférieur à bound / 2^32). Les tirages viennent de DSA_PRNG_FILL_LANES flux
+// entrelacés dérivés de `rng` par dsa_prng_long_jump, calculés en AVX2 si le
+// processeur le permet : le résultat est identique sur tous les processeurs.
+// `rng` est ensuite avancé par dsa_prng_jump.
+#define DSA_PRNG_FILL_LANES 8
+
+void dsa_prng_fill_u32(DsaPrng *rng, uint32_t *out, size_t count,
+                       uint32_t bound);
+
+// Jeu d'instructions du remplissage en bloc : "AVX2" ou "scalaire"
+const char *dsa_prng_fill_isa(void);
+
+// --- Générateur du thread courant ---
+// Remplace rand()/srand(time(NULL)) dans tous les modules : chaque thread a
+// son propre état (pas de verrou ni de course entre threads), initialisé à la
+// première utilisation avec une graine fraîche.
+DsaPrng *dsa_prng_thread(void);
+
+// Réinitialise le générateur du thread avec `seed` (données reproductibles)
+void dsa_prng_thread_reseed(uint64_t seed);
+
+// Graine du générateur du thread (à afficher pour rejouer un tirage)
+uint64_t dsa_prng_thread_seed(void);
+
+#endif
@@ -0,0 +1,49 @@
+#include "scratch_pool.h"
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+void *dsa_aligned_buffer_alloc(size_t bytes) {
+  // aligned_alloc exige un multiple de l'alignement
+  size_t rounded = (bytes + DSA_SCRATCH_ALIGNMENT - 1) &
+                   ~(size_t)(DSA_SCRATCH_ALIGNMENT - 1);
+  if (rounded == 0)
+    rounded = DSA_SCRATCH_ALIGNMENT;
+#ifdef _WIN32
+  return _aligned_malloc(rounded, DSA_SCRATCH_ALIGNMENT);
+#else
+  return aligned_alloc(DSA_SCRATCH_ALIGNMENT, rounded);
+#endif
+}
+
+void dsa_aligned_buffer_free(void *buffer) {
+#ifdef _WIN32
+  _aligned_free(buffer);
+#else
+  free(buffer);
+#endif
+}
+
+void *dsa_scratch_pool_get(DsaScratchPool *pool, DsaScratchSlot slot,
+                           size_t bytes) {
+  DsaScratchBlock *block = &pool->blocks[slot];
+  if (block->data && block->capacity >= bytes)
+    return block->data;
+
+  // L'ancien contenu n'a pas à être conservé : libérer d'abord limite le pic
+  // de mémoire
+  dsa_aligned_buffer_free(block->data);
+  block->data = dsa_aligned_buffer_alloc(bytes);
+  block->capacity = block->data ? bytes : 0;
+  return block->data;
+}
+
+void dsa_scratch_pool_release(DsaScratchPool *pool) {
+  for (int slot = 0; slot < DSA_SCRATCH_SLOT_COUNT; slot++) {
+    dsa_aligned_buffer_free(pool->blocks[slot].data);
+    pool->blocks[slot].data = NULL;
+    pool->blocks[slot].capacity = 0;
+  }
+}
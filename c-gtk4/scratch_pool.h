@@ -0,0 +1,43 @@
+#ifndef SCRATCH_POOL_H
+#define SCRATCH_POOL_H
+
+#include <stddef.h>
+
+// Tampons de travail réutilisés d'un tri à l'autre : un tampon par usage,
+// agrandi au besoin et jamais réduit. Les tris successifs retrouvent ainsi
+// une mémoire déjà allouée et déjà paginée, au lieu d'un grand malloc (et
+// de ses défauts de page) à chaque tri.
+
+// Alignement des tampons (ligne de cache, registres AVX)
+#define DSA_SCRATCH_ALIGNMENT 64
+
+typedef enum {
+  DSA_SCRATCH_ARRAY, // Copie du tableau à trier
+  DSA_SCRATCH_SORT,  // Tampon interne des tris (radix, comptage, parallèle)
+  DSA_SCRATCH_SLOT_COUNT
+} DsaScratchSlot;
+
+typedef struct {
+  void *data;
+  size_t capacity;
+} DsaScratchBlock;
+
+// Un pool ne doit servir qu'à un tri à la fois ; {0} est un pool vide
+typedef struct {
+  DsaScratchBlock blocks[DSA_SCRATCH_SLOT_COUNT];
+} DsaScratchPool;
+
+// Tampon d'au moins `bytes` octets, aligné sur DSA_SCRATCH_ALIGNMENT. Son
+// contenu est indéfini s'il a dû être agrandi ; il reste valide jusqu'au
+// prochain appel sur le même emplacement. NULL si la mémoire manque.
+void *dsa_scratch_pool_get(DsaScratchPool *pool, DsaScratchSlot slot,
+                           size_t bytes);
+
+// Libère tous les tampons (le pool reste utilisable)
+void dsa_scratch_pool_release(DsaScratchPool *pool);
+
+// Mémoire alignée sur DSA_SCRATCH_ALIGNMENT (libérée par la fonction suivante)
+void *dsa_aligned_buffer_alloc(size_t bytes);
+void dsa_aligned_buffer_free(void *buffer);
+
+#endif
@@ -1,210 +1,1210 @@
 #include "sort_algorithms.h"
-#include <stdio.h>
+#include "array_format.h"
+#include "array_generators.h"
+#include "prng.h"
+#include "sort_network.h"
+#include "timing.h"
+#include <limits.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
-#include <time.h>
 
-// --- Utilitaires de comparaison ---
-int compare_int(const void *a, const void *b) {
-  return (*(int *)a - *(int *)b);
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+// --- Noyaux de tri spécialisés par type ---
+// Chaque famille de noyaux est générée par macro pour un type d'élément
+// donné : la comparaison LESS est inlinée par le compilateur, sans
+// indirection void* dans les boucles internes.
+
+// Taille de partition en dessous de laquelle l'introsort passe au tri par
+// insertion (ou au réseau de tri SIMD, jusqu'à DSA_SORT_NETWORK_MAX éléments,
+// pour int et float)
+#define INTROSORT_THRESHOLD 16
+
+// Au-delà de cette taille, le pivot est le ninther (médian de trois médians)
+#define NINTHER_THRESHOLD 128
+
+// Intervalle de valeurs maximal pour le tri par comptage des entiers
+#define COUNTING_MAX_RANGE (1u << 24)
+
+// Tri parallèle : taille minimale (en dessous, introsort séquentiel), nombre
+// maximal de threads, éléments minimum par thread, seaux par thread et
+// suréchantillonnage pour le choix des séparateurs
+#define PARALLEL_SORT_THRESHOLD 100000
+#define PARALLEL_MAX_THREADS 64
+#define PARALLEL_MIN_CHUNK 16384
+#define PARALLEL_BUCKETS_PER_THREAD 4
+#define PARALLEL_OVERSAMPLING 16
+
+// Nombre de threads demandé pour DSA_ALGO_PARALLEL (0 = automatique) : écrit
+// par la fenêtre des tableaux, lu par les tris lancés depuis d'autres
+// threads (courbes, génération des clés)
+static atomic_int sort_thread_count = 0;
+
+// Tri fusion : taille des blocs triés par insertion avant les fusions
+#define MERGE_RUN 32
+
+// Nombre d'éléments traités entre deux vérifications d'annulation dans les
+// boucles du tri par insertion
+#define SORT_CONTROL_STEP 4096
+
+// Suivi du tri en cours sur ce thread (NULL : tri sans suivi). Les threads
+// du tri parallèle reprennent celui du thread qui les lance.
+static _Thread_local DsaSortControl *sort_control = NULL;
+
+static inline bool sort_cancelled(void) {
+  return sort_control &&
+         atomic_load_explicit(&sort_control->cancel, memory_order_relaxed);
 }
-int compare_float(const void *a, const void *b) {
-  return (*(float *)a < *(float *)b) ? -1 : (*(float *)a > *(float *)b);
+
+static inline void sort_progress_begin(uint64_t total) {
+  if (sort_control) {
+    atomic_store_explicit(&sort_control->done, 0, memory_order_relaxed);
+    atomic_store_explicit(&sort_control->total, total, memory_order_relaxed);
+  }
+}
+
+static inline void sort_progress_add(uint64_t amount) {
+  if (sort_control)
+    atomic_fetch_add_explicit(&sort_control->done, amount,
+                              memory_order_relaxed);
+}
+
+// Tampon interne d'un tri : pris dans le pool du tri suivi s'il en a un
+// (emplacement DSA_SCRATCH_SORT, un seul tampon à la fois), sinon alloué
+static inline void *sort_scratch_alloc(size_t bytes) {
+  if (sort_control && sort_control->scratch)
+    return dsa_scratch_pool_get(sort_control->scratch, DSA_SCRATCH_SORT, bytes);
+  return malloc(bytes);
+}
+
+static inline void sort_scratch_free(void *buffer) {
+  if (!(sort_control && sort_control->scratch))
+    free(buffer);
+}
+
+// Nombre de paires (i, j), i < j : travail total des tris quadratiques
+static uint64_t sort_pair_count(size_t size) {
+  return size < 2 ? 0 : (uint64_t)size * (uint64_t)(size - 1) / 2;
 }
-int compare_char(const void *a, const void *b) {
-  return (*(char *)a - *(char *)b);
+
+// Nombre de passes du tri Shell (écarts n/2, n/4, ..., 1)
+static uint64_t shell_pass_count(size_t size) {
+  uint64_t passes = 0;
+  for (size_t gap = size / 2; gap > 0; gap /= 2)
+    passes++;
+  return passes;
+}
+
+// Nombre de passes du tri fusion : insertion par blocs de MERGE_RUN, puis
+// une passe par doublement de la largeur des blocs
+static uint64_t merge_pass_count(size_t size) {
+  uint64_t passes = 1;
+  for (size_t width = MERGE_RUN; width < size; width *= 2)
+    passes++;
+  return passes;
+}
+
+// Profondeur maximale de récursion avant le repli sur le tri par tas :
+// 2 * floor(log2(n))
+static int introsort_depth_limit(size_t size) {
+  int depth = 0;
+  while (size > 1) {
+    depth++;
+    size >>= 1;
+  }
+  return 2 * depth;
+}
+
+#define SORT_SWAP(T, a, b)                                                     \
+  do {                                                                         \
+    T swap_tmp = (a);                                                          \
+    (a) = (b);                                                                 \
+    (b) = swap_tmp;                                                            \
+  } while (0)
+
+#define LESS_NUM(a, b) ((a) < (b))
+#define LESS_STR(a, b) (strcmp((a), (b)) < 0)
+
+// Tri fusion stable ascendant de arr avec un tampon tmp de même taille :
+// blocs de MERGE_RUN triés par insertion, puis fusions en alternant arr et
+// tmp. À clés égales, l'élément de gauche passe en premier ; deux blocs
+// déjà dans l'ordre sont simplement recopiés. Retourne false si le tri a
+// été annulé (tous les éléments restent alors dans arr).
+#define DEFINE_MERGE_SORT(NAME, T, LESS)                                       \
+  static void merge_runs_##NAME(T *src, T *dst, size_t lo, size_t mid,         \
+                                size_t hi) {                                   \
+    if (!LESS(src[mid], src[mid - 1])) {                                       \
+      memcpy(dst + lo, src + lo, (hi - lo) * sizeof(T));                       \
+      return;                                                                  \
+    }                                                                          \
+    size_t i = lo, j = mid, k = lo;                                            \
+    while (i < mid && j < hi) {                                                \
+      bool right = LESS(src[j], src[i]);                                       \
+      dst[k++] = right ? src[j] : src[i];                                      \
+      j += right;                                                              \
+      i += !right;                                                             \
+    }                                                                          \
+    memcpy(dst + k, src + i, (mid - i) * sizeof(T));                           \
+    memcpy(dst + k + (mid - i), src + j, (hi - j) * sizeof(T));                \
+  }                                                                            \
+                                                                               \
+  static bool merge_sort_buffer_##NAME(T *arr, T *tmp, size_t size) {          \
+    for (size_t lo = 0; lo < size; lo += MERGE_RUN) {                          \
+      size_t hi = size - lo > MERGE_RUN ? lo + MERGE_RUN : size;               \
+      for (size_t i = lo + 1; i < hi; i++) {                                   \
+        T key = arr[i];                                                        \
+        size_t j = i;                                                          \
+        while (j > lo && LESS(key, arr[j - 1])) {                              \
+          arr[j] = arr[j - 1];                                                 \
+          j--;                                                                 \
+        }                                                                      \
+        arr[j] = key;                                                          \
+      }                                                                        \
+    }                                                                          \
+    sort_progress_add(size);                                                   \
+                                                                               \
+    T *src = arr;                                                              \
+    T *dst = tmp;                                                              \
+    bool done = true;                                                          \
+    for (size_t width = MERGE_RUN; done && width < size; width *= 2) {         \
+      size_t lo = 0;                                                           \
+      for (; lo < size; lo += 2 * width) {                                     \
+        if ((lo == 0 || width >= SORT_CONTROL_STEP) && sort_cancelled()) {     \
+          /* Reste de la passe recopié tel quel : aucun élément perdu */       \
+          memcpy(dst + lo, src + lo, (size - lo) * sizeof(T));                 \
+          done = false;                                                        \
+          break;                                                               \
+        }                                                                      \
+        if (size - lo <= width) {                                              \
+          memcpy(dst + lo, src + lo, (size - lo) * sizeof(T));                 \
+          break;                                                               \
+        }                                                                      \
+        size_t hi = size - lo > 2 * width ? lo + 2 * width : size;             \
+        merge_runs_##NAME(src, dst, lo, lo + width, hi);                       \
+      }                                                                        \
+      T *swap = src;                                                           \
+      src = dst;                                                               \
+      dst = swap;                                                              \
+      if (done)                                                                \
+        sort_progress_add(size);                                               \
+    }                                                                          \
+    if (src != arr)                                                            \
+      memcpy(arr, src, size * sizeof(T));                                      \
+    return done;                                                               \
+  }
+
+#define DEFINE_SORT_KERNELS(SUFFIX, T, LESS)                                   \
+  /* -- BULLE (échange sans branchement, arrêt si passe sans échange) -- */    \
+  static void bubble_sort_##SUFFIX(T *arr, size_t size) {                      \
+    if (size < 2)                                                              \
+      return;                                                                  \
+    for (size_t i = 0; i < size - 1; i++) {                                    \
+      if (sort_cancelled())                                                    \
+        return;                                                                \
+      int swapped = 0;                                                         \
+      for (size_t j = 0; j < size - i - 1; j++) {                              \
+        T a = arr[j];                                                          \
+        T b = arr[j + 1];                                                      \
+        int gt = LESS(b, a);                                                   \
+        arr[j] = gt ? b : a;                                                   \
+        arr[j + 1] = gt ? a : b;                                               \
+        swapped |= gt;                                                         \
+      }                                                                        \
+      sort_progress_add(size - i - 1);                                         \
+      if (!swapped)                                                            \
+        break;                                                                 \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  /* -- INSERTION (insère arr[begin, end) dans le préfixe trié) -- */          \
+  static void insertion_sort_range_##SUFFIX(T *arr, size_t begin,              \
+                                            size_t end) {                      \
+    for (size_t i = begin; i < end; i++) {                                     \
+      T key = arr[i];                                                          \
+      size_t j = i;                                                            \
+      while (j > 0 && LESS(key, arr[j - 1])) {                                 \
+        arr[j] = arr[j - 1];                                                   \
+        j--;                                                                   \
+      }                                                                        \
+      arr[j] = key;                                                            \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  static void insertion_sort_##SUFFIX(T *arr, size_t size) {                   \
+    insertion_sort_range_##SUFFIX(arr, 1, size);                               \
+  }                                                                            \
+                                                                               \
+  /* Tri par insertion seul (DSA_ALGO_INSERTION) : par tranches, avec suivi */ \
+  static void insertion_sort_tracked_##SUFFIX(T *arr, size_t size) {           \
+    for (size_t begin = 1; begin < size; begin += SORT_CONTROL_STEP) {         \
+      if (sort_cancelled())                                                    \
+        return;                                                                \
+      size_t end = begin + SORT_CONTROL_STEP;                                  \
+      if (end > size)                                                          \
+        end = size;                                                            \
+      insertion_sort_range_##SUFFIX(arr, begin, end);                          \
+      sort_progress_add(sort_pair_count(end) - sort_pair_count(begin));        \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  /* -- SHELL -- */                                                            \
+  static void shell_sort_##SUFFIX(T *arr, size_t size) {                       \
+    for (size_t gap = size / 2; gap > 0; gap /= 2) {                           \
+      if (sort_cancelled())                                                    \
+        return;                                                                \
+      for (size_t i = gap; i < size; i += 1) {                                 \
+        T temp = arr[i];                                                       \
+        size_t j;                                                              \
+        for (j = i; j >= gap && LESS(temp, arr[j - gap]); j -= gap)            \
+          arr[j] = arr[j - gap];                                               \
+        arr[j] = temp;                                                         \
+      }                                                                        \
+      sort_progress_add(size);                                                 \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  /* -- TAS (repli de l'introsort quand la récursion dégénère) -- */           \
+  static void sift_down_##SUFFIX(T *arr, size_t root, size_t size) {           \
+    T value = arr[root];                                                       \
+    size_t child;                                                              \
+    while ((child = 2 * root + 1) < size) {                                    \
+      if (child + 1 < size && LESS(arr[child], arr[child + 1]))                \
+        child++;                                                               \
+      if (!LESS(value, arr[child]))                                            \
+        break;                                                                 \
+      arr[root] = arr[child];                                                  \
+      root = child;                                                            \
+    }                                                                          \
+    arr[root] = value;                                                         \
+  }                                                                            \
+                                                                               \
+  static void heap_sort_##SUFFIX(T *arr, size_t size) {                        \
+    if (size < 2)                                                              \
+      return;                                                                  \
+    for (size_t i = size / 2; i-- > 0;)                                        \
+      sift_down_##SUFFIX(arr, i, size);                                        \
+    for (size_t end = size - 1; end > 0; end--) {                              \
+      SORT_SWAP(T, arr[0], arr[end]);                                          \
+      sift_down_##SUFFIX(arr, 0, end);                                         \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  /* Ordonne arr[a] <= arr[b] <= arr[c] */                                     \
+  static inline void sort3_##SUFFIX(T *arr, size_t a, size_t b, size_t c) {    \
+    if (LESS(arr[b], arr[a]))                                                  \
+      SORT_SWAP(T, arr[a], arr[b]);                                            \
+    if (LESS(arr[c], arr[b])) {                                                \
+      SORT_SWAP(T, arr[b], arr[c]);                                            \
+      if (LESS(arr[b], arr[a]))                                                \
+        SORT_SWAP(T, arr[a], arr[b]);                                          \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  /* -- QUICK (introsort : pivot médian de trois, insertion sous le seuil, */  \
+  /*    tas au-delà de la profondeur limite => O(n log n) garanti) -- */       \
+  static void introsort_loop_##SUFFIX(T *arr, size_t size, int depth_limit,    \
+                                      size_t small_limit) {                    \
+    while (size > small_limit) {                                               \
+      if (sort_cancelled())                                                    \
+        return;                                                                \
+      if (depth_limit == 0) {                                                  \
+        heap_sort_##SUFFIX(arr, size);                                         \
+        sort_progress_add(size);                                               \
+        return;                                                                \
+      }                                                                        \
+      depth_limit--;                                                           \
+                                                                               \
+      /* Pivot placé en arr[mid] ; arr[0] <= pivot <= arr[size - 1] */         \
+      /* servent de sentinelles aux boucles de partition */                    \
+      size_t mid = size / 2;                                                   \
+      if (size > NINTHER_THRESHOLD) {                                          \
+        /* Grands tableaux : médian de trois médians (ninther de Tukey) */     \
+        size_t s = size / 8;                                                   \
+        sort3_##SUFFIX(arr, 0, s, 2 * s);                                      \
+        sort3_##SUFFIX(arr, mid - s, mid, mid + s);                            \
+        sort3_##SUFFIX(arr, size - 1 - 2 * s, size - 1 - s, size - 1);         \
+        sort3_##SUFFIX(arr, s, mid, size - 1 - s);                             \
+        if (LESS(arr[mid], arr[0]))                                            \
+          SORT_SWAP(T, arr[0], arr[s]);                                        \
+        if (LESS(arr[size - 1], arr[mid]))                                     \
+          SORT_SWAP(T, arr[size - 1], arr[size - 1 - s]);                      \
+      } else {                                                                 \
+        sort3_##SUFFIX(arr, 0, mid, size - 1);                                 \
+      }                                                                        \
+      T pivot = arr[mid];                                                      \
+                                                                               \
+      /* Partition de Hoare : [0, j] <= pivot <= [j + 1, size) */              \
+      size_t i = 0, j = size - 1;                                              \
+      for (;;) {                                                               \
+        do                                                                     \
+          i++;                                                                 \
+        while (LESS(arr[i], pivot));                                           \
+        do                                                                     \
+          j--;                                                                 \
+        while (LESS(pivot, arr[j]));                                           \
+        if (i >= j)                                                            \
+          break;                                                               \
+        SORT_SWAP(T, arr[i], arr[j]);                                          \
+      }                                                                        \
+                                                                               \
+      /* Récursion sur la plus petite moitié, boucle sur la plus grande */     \
+      size_t left = j + 1;                                                     \
+      if (left < size - left) {                                                \
+        introsort_loop_##SUFFIX(arr, left, depth_limit, small_limit);          \
+        arr += left;                                                           \
+        size -= left;                                                          \
+      } else {                                                                 \
+        introsort_loop_##SUFFIX(arr + left, size - left, depth_limit,          \
+                                small_limit);                                  \
+        size = left;                                                           \
+      }                                                                        \
+    }                                                                          \
+    if (!NETWORK_SORT_##SUFFIX(arr, size))                                     \
+      insertion_sort_##SUFFIX(arr, size);                                      \
+    sort_progress_add(size);                                                   \
+  }                                                                            \
+                                                                               \
+  static void quick_sort_##SUFFIX(T *arr, size_t size) {                       \
+    introsort_loop_##SUFFIX(arr, size, introsort_depth_limit(size),            \
+                            NETWORK_LIMIT_##SUFFIX);                           \
+  }                                                                            \
+                                                                               \
+  /* -- FUSION (stable ; sans tampon, repli sur l'introsort : pour des */      \
+  /*    clés seules, la stabilité ne change pas le résultat) -- */             \
+  static void merge_sort_##SUFFIX(T *arr, size_t size) {                       \
+    if (size < 2)                                                              \
+      return;                                                                  \
+    T *tmp = sort_scratch_alloc(size * sizeof(T));                             \
+    if (!tmp) {                                                                \
+      quick_sort_##SUFFIX(arr, size);                                          \
+      return;                                                                  \
+    }                                                                          \
+    merge_sort_buffer_##SUFFIX(arr, tmp, size);                                \
+    sort_scratch_free(tmp);                                                    \
+  }                                                                            \
+                                                                               \
+  static void sort_##SUFFIX(T *arr, size_t size, DsaSortAlgo algo) {           \
+    switch (algo) {                                                            \
+    case DSA_ALGO_BUBBLE:                                                      \
+      sort_progress_begin(sort_pair_count(size));                              \
+      bubble_sort_##SUFFIX(arr, size);                                         \
+      break;                                                                   \
+    case DSA_ALGO_INSERTION:                                                   \
+      sort_progress_begin(sort_pair_count(size));                              \
+      insertion_sort_tracked_##SUFFIX(arr, size);                              \
+      break;                                                                   \
+    case DSA_ALGO_SHELL:                                                       \
+      sort_progress_begin((uint64_t)size * shell_pass_count(size));            \
+      shell_sort_##SUFFIX(arr, size);                                          \
+      break;                                                                   \
+    case DSA_ALGO_QUICK:                                                       \
+      sort_progress_begin(size);                                               \
+      quick_sort_##SUFFIX(arr, size);                                          \
+      break;                                                                   \
+    case DSA_ALGO_RADIX:                                                       \
+      sort_progress_begin(size);                                               \
+      radix_sort_##SUFFIX(arr, size);                                          \
+      break;                                                                   \
+    case DSA_ALGO_COUNTING:                                                    \
+      sort_progress_begin(size);                                               \
+      counting_sort_##SUFFIX(arr, size);                                       \
+      break;                                                                   \
+    case DSA_ALGO_PARALLEL:                                                    \
+      sort_progress_begin(size);                                               \
+      parallel_sort_##SUFFIX(arr, size);                                       \
+      break;                                                                   \
+    case DSA_ALGO_MERGE:                                                       \
+      sort_progress_begin((uint64_t)size * merge_pass_count(size));            \
+      merge_sort_##SUFFIX(arr, size);                                          \
+      break;                                                                   \
+    }                                                                          \
+  }
+
+// Tris non comparatifs, spécifiques à chaque type (définis plus bas)
+static void radix_sort_int(int *arr, size_t size);
+static void radix_sort_float(float *arr, size_t size);
+static void radix_sort_char(char *arr, size_t size);
+static void radix_sort_string(char **arr, size_t size);
+static void counting_sort_int(int *arr, size_t size);
+static void counting_sort_float(float *arr, size_t size);
+static void counting_sort_char(char *arr, size_t size);
+static void counting_sort_string(char **arr, size_t size);
+
+// Tri parallèle (défini plus bas par DEFINE_PARALLEL_SORT)
+static void parallel_sort_int(int *arr, size_t size);
+static void parallel_sort_float(float *arr, size_t size);
+static void parallel_sort_char(char *arr, size_t size);
+static void parallel_sort_string(char **arr, size_t size);
+
+// Fin de l'introsort : réseaux de tri SIMD pour int et float quand le
+// processeur les prend en charge (blocs plus grands), insertion sinon
+static size_t network_threshold(void) {
+  size_t limit = dsa_sort_network_limit();
+  return limit > INTROSORT_THRESHOLD ? limit : INTROSORT_THRESHOLD;
+}
+
+#define NETWORK_LIMIT_int network_threshold()
+#define NETWORK_LIMIT_float network_threshold()
+#define NETWORK_LIMIT_char INTROSORT_THRESHOLD
+#define NETWORK_LIMIT_string INTROSORT_THRESHOLD
+#define NETWORK_SORT_int(arr, size) dsa_sort_network_int(arr, size)
+#define NETWORK_SORT_float(arr, size) dsa_sort_network_float(arr, size)
+#define NETWORK_SORT_char(arr, size) false
+#define NETWORK_SORT_string(arr, size) false
+
+DEFINE_MERGE_SORT(int, int, LESS_NUM)
+DEFINE_MERGE_SORT(float, float, LESS_NUM)
+DEFINE_MERGE_SORT(char, char, LESS_NUM)
+DEFINE_MERGE_SORT(string, char *, LESS_STR)
+
+DEFINE_SORT_KERNELS(int, int, LESS_NUM)
+DEFINE_SORT_KERNELS(float, float, LESS_NUM)
+DEFINE_SORT_KERNELS(char, char, LESS_NUM)
+DEFINE_SORT_KERNELS(string, char *, LESS_STR)
+
+// --- Tris linéaires (radix LSD / comptage) ---
+// Les clés sont ramenées à des entiers non signés dont l'ordre naturel est
+// celui des valeurs : bit de signe inversé pour les entiers, astuce IEEE 754
+// pour les réels (tous les bits inversés si négatif, sinon bit de signe mis).
+
+static inline uint32_t float_to_key(uint32_t bits) {
+  return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
 }
-int compare_string(const void *a, const void *b) {
-  return strcmp(*(char **)a, *(char **)b);
+
+static inline uint32_t key_to_float(uint32_t key) {
+  return (key & 0x80000000u) ? (key & 0x7FFFFFFFu) : ~key;
 }
 
-// --- Implémentations spécifiques (Exemple simplifié pour INT) ---
-// Note: Pour un vrai système complet, on utiliserait des templates ou macros,
-// mais ici on va dupliquer un peu ou utiliser void* avec memcpy pour qsort.
+// Radix LSD base 256 sur des clés 32 bits : un seul passage de comptage pour
+// les quatre histogrammes, puis une passe de dispersion par octet (les
+// passes où toutes les clés partagent le même octet sont sautées).
+// `index` (facultatif) suit ses clés à chaque passe : le tri étant stable,
+// il donne la permutation des clés égales dans leur ordre d'origine.
+// Retourne false si le tampon temporaire n'a pas pu être alloué.
+static bool radix_sort_u32(uint32_t *keys, size_t *index, size_t size) {
+  if (size < 2)
+    return true;
+
+  // Un seul tampon : indices (alignés sur size_t) puis clés
+  size_t index_bytes = index ? size * sizeof(size_t) : 0;
+  char *block = sort_scratch_alloc(index_bytes + size * sizeof(uint32_t));
+  if (!block)
+    return false;
+  uint32_t *tmp = (uint32_t *)(block + index_bytes);
+  size_t *tmp_index = (size_t *)block;
 
-// -- BULLE --
-void bubble_sort_int(int *arr, size_t size) {
-  for (size_t i = 0; i < size - 1; i++) {
-    for (size_t j = 0; j < size - i - 1; j++) {
-      if (arr[j] > arr[j + 1]) {
-        int temp = arr[j];
-        arr[j] = arr[j + 1];
-        arr[j + 1] = temp;
+  size_t counts[4][256] = {{0}};
+  for (size_t i = 0; i < size; i++) {
+    uint32_t k = keys[i];
+    counts[0][k & 0xFF]++;
+    counts[1][(k >> 8) & 0xFF]++;
+    counts[2][(k >> 16) & 0xFF]++;
+    counts[3][k >> 24]++;
+  }
+
+  uint32_t *src = keys;
+  uint32_t *dst = tmp;
+  size_t *src_index = index;
+  size_t *dst_index = tmp_index;
+  for (int pass = 0; pass < 4; pass++) {
+    if (sort_cancelled())
+      break; // Les clés sont recopiées ci-dessous : aucun élément perdu
+    size_t *count = counts[pass];
+    int shift = pass * 8;
+    if (count[(src[0] >> shift) & 0xFF] == size)
+      continue; // Octet identique partout : passe inutile
+
+    size_t offset = 0;
+    for (int b = 0; b < 256; b++) {
+      size_t c = count[b];
+      count[b] = offset;
+      offset += c;
+    }
+    if (index) {
+      for (size_t i = 0; i < size; i++) {
+        uint32_t k = src[i];
+        size_t d = count[(k >> shift) & 0xFF]++;
+        dst[d] = k;
+        dst_index[d] = src_index[i];
+      }
+      size_t *swap_index = src_index;
+      src_index = dst_index;
+      dst_index = swap_index;
+    } else {
+      for (size_t i = 0; i < size; i++) {
+        uint32_t k = src[i];
+        dst[count[(k >> shift) & 0xFF]++] = k;
       }
     }
+    uint32_t *swap = src;
+    src = dst;
+    dst = swap;
   }
+
+  if (src != keys) {
+    memcpy(keys, src, size * sizeof(uint32_t));
+    if (index)
+      memcpy(index, src_index, size * sizeof(size_t));
+  }
+  sort_scratch_free(block);
+  return true;
+}
+
+static void radix_sort_int(int *arr, size_t size) {
+  uint32_t *keys = (uint32_t *)arr;
+  for (size_t i = 0; i < size; i++)
+    keys[i] = (uint32_t)arr[i] ^ 0x80000000u;
+  bool ok = radix_sort_u32(keys, NULL, size);
+  for (size_t i = 0; i < size; i++)
+    arr[i] = (int)(keys[i] ^ 0x80000000u);
+  if (!ok)
+    quick_sort_int(arr, size);
+}
+
+static void radix_sort_float(float *arr, size_t size) {
+  uint32_t *keys = (uint32_t *)arr;
+  for (size_t i = 0; i < size; i++) {
+    uint32_t bits;
+    memcpy(&bits, &arr[i], sizeof(bits));
+    keys[i] = float_to_key(bits);
+  }
+  bool ok = radix_sort_u32(keys, NULL, size);
+  for (size_t i = 0; i < size; i++) {
+    uint32_t bits = key_to_float(keys[i]);
+    memcpy(&arr[i], &bits, sizeof(bits));
+  }
+  if (!ok)
+    quick_sort_float(arr, size);
+}
+
+// Un caractère tient sur un octet : le radix se réduit au comptage
+static void radix_sort_char(char *arr, size_t size) {
+  counting_sort_char(arr, size);
 }
 
-// -- INSERTION --
-void insertion_sort_int(int *arr, size_t size) {
+// Pas de clé de taille fixe pour les chaînes : repli sur l'introsort
+static void radix_sort_string(char **arr, size_t size) {
+  quick_sort_string(arr, size);
+}
+
+// Comptage sur l'intervalle [min, max] ; si l'intervalle est grand devant le
+// nombre d'éléments, le radix est plus économe et prend le relais.
+static void counting_sort_int(int *arr, size_t size) {
+  if (size < 2)
+    return;
+
+  int min = arr[0], max = arr[0];
   for (size_t i = 1; i < size; i++) {
-    int key = arr[i];
-    int j = i - 1;
-    while (j >= 0 && arr[j] > key) {
-      arr[j + 1] = arr[j];
-      j = j - 1;
-    }
-    arr[j + 1] = key;
+    if (arr[i] < min)
+      min = arr[i];
+    if (arr[i] > max)
+      max = arr[i];
+  }
+
+  uint64_t range = (uint64_t)((int64_t)max - (int64_t)min) + 1;
+  if (range > COUNTING_MAX_RANGE || range > (uint64_t)size * 2 + 256) {
+    radix_sort_int(arr, size);
+    return;
+  }
+
+  size_t *count = sort_scratch_alloc((size_t)range * sizeof(size_t));
+  if (!count) {
+    radix_sort_int(arr, size);
+    return;
+  }
+  memset(count, 0, (size_t)range * sizeof(size_t));
+  for (size_t i = 0; i < size; i++)
+    count[arr[i] - min]++;
+
+  size_t pos = 0;
+  for (uint64_t v = 0; v < range; v++) {
+    int value = (int)((int64_t)min + (int64_t)v);
+    for (size_t c = count[v]; c > 0; c--)
+      arr[pos++] = value;
   }
+  sort_scratch_free(count);
 }
 
-// -- SHELL --
-void shell_sort_int(int *arr, size_t size) {
-  for (size_t gap = size / 2; gap > 0; gap /= 2) {
-    for (size_t i = gap; i < size; i += 1) {
-      int temp = arr[i];
-      size_t j;
-      for (j = i; j >= gap && arr[j - gap] > temp; j -= gap)
-        arr[j] = arr[j - gap];
-      arr[j] = temp;
-    }
+// Les réels ne sont pas dénombrables : le comptage se fait par octet de clé,
+// c'est-à-dire le radix
+static void counting_sort_float(float *arr, size_t size) {
+  radix_sort_float(arr, size);
+}
+
+static void counting_sort_char(char *arr, size_t size) {
+  size_t count[256] = {0};
+  for (size_t i = 0; i < size; i++)
+    count[(unsigned char)arr[i]]++;
+
+  // Parcours des valeurs dans l'ordre de `char` (signé ou non selon la
+  // plateforme)
+  size_t pos = 0;
+  for (int v = CHAR_MIN; v <= CHAR_MAX; v++) {
+    for (size_t c = count[(unsigned char)v]; c > 0; c--)
+      arr[pos++] = (char)v;
   }
 }
 
-// -- QUICK (Wrapper qsort standard pour simplicité et performance) --
-void quick_sort_int(int *arr, size_t size) {
-  qsort(arr, size, sizeof(int), compare_int);
+static void counting_sort_string(char **arr, size_t size) {
+  quick_sort_string(arr, size);
 }
 
-// --- Fonctions publiques ---
+// --- Tri indirect et enregistrements (clé + données associées) ---
+// Les clés sont triées avec leur indice d'origine, par le radix stable
+// (clés 32 bits) ou par le tri fusion de paires (clé, indice) ; la
+// permutation obtenue range ensuite clés et données associées en une passe.
 
-void generate_random_data(ArrayData *data, size_t size, DataType type) {
-  if (data->array)
-    free(data->array);
-  data->size = size;
-  data->type = type;
+#define LESS_KEY_NUM(a, b) ((a).key < (b).key)
+#define LESS_KEY_STR(a, b) (strcmp((a).key, (b).key) < 0)
+
+#define DEFINE_ARGSORT_MERGE(SUFFIX, T, LESS)                                  \
+  typedef struct {                                                             \
+    T key;                                                                     \
+    size_t index;                                                              \
+  } Indexed_##SUFFIX;                                                          \
+                                                                               \
+  DEFINE_MERGE_SORT(indexed_##SUFFIX, Indexed_##SUFFIX, LESS)                  \
+                                                                               \
+  static bool argsort_merge_##SUFFIX(T *arr, size_t size,                      \
+                                     size_t *order) {                          \
+    Indexed_##SUFFIX *items = malloc(size * sizeof(Indexed_##SUFFIX));         \
+    Indexed_##SUFFIX *tmp = sort_scratch_alloc(size * sizeof(*tmp));           \
+    if (!items || !tmp) {                                                      \
+      free(items);                                                             \
+      if (tmp)                                                                 \
+        sort_scratch_free(tmp);                                                \
+      return false;                                                            \
+    }                                                                          \
+    for (size_t i = 0; i < size; i++) {                                        \
+      items[i].key = arr[i];                                                   \
+      items[i].index = i;                                                      \
+    }                                                                          \
+    merge_sort_buffer_indexed_##SUFFIX(items, tmp, size);                      \
+    for (size_t i = 0; i < size; i++)                                          \
+      order[i] = items[i].index;                                               \
+    sort_scratch_free(tmp);                                                    \
+    free(items);                                                               \
+    return true;                                                               \
+  }
 
-  // Seed du random
-  srand((unsigned int)time(NULL));
+DEFINE_ARGSORT_MERGE(int, int, LESS_KEY_NUM)
+DEFINE_ARGSORT_MERGE(float, float, LESS_KEY_NUM)
+DEFINE_ARGSORT_MERGE(char, char, LESS_KEY_NUM)
+DEFINE_ARGSORT_MERGE(string, char *, LESS_KEY_STR)
 
-  switch (type) {
-  case TYPE_INT:
-    data->array = malloc(size * sizeof(int));
+// Clés 32 bits dans l'ordre des valeurs, triées par le radix avec leurs
+// indices (chaînes exclues)
+static bool argsort_radix(const DsaArrayData *data, size_t *order) {
+  size_t size = data->size;
+  uint32_t *keys = malloc(size * sizeof(uint32_t));
+  if (!keys)
+    return false;
+
+  for (size_t i = 0; i < size; i++) {
+    order[i] = i;
+    switch (data->type) {
+    case DSA_TYPE_INT:
+      keys[i] = (uint32_t)((const int *)data->array)[i] ^ 0x80000000u;
+      break;
+    case DSA_TYPE_FLOAT: {
+      uint32_t bits;
+      memcpy(&bits, (const float *)data->array + i, sizeof(bits));
+      keys[i] = float_to_key(bits);
+      break;
+    }
+    case DSA_TYPE_CHAR:
+      keys[i] = (uint32_t)((int)((const char *)data->array)[i] - CHAR_MIN);
+      break;
+    case DSA_TYPE_STRING:
+      break;
+    }
+  }
+  bool ok = radix_sort_u32(keys, order, size);
+  free(keys);
+  return ok;
+}
+
+static bool argsort_dispatch(const DsaArrayData *data, DsaSortAlgo algo,
+                             size_t *order) {
+  size_t size = data->size;
+  if (size < 2) {
+    if (size == 1)
+      order[0] = 0;
+    return true;
+  }
+
+  if ((algo == DSA_ALGO_RADIX || algo == DSA_ALGO_COUNTING) &&
+      data->type != DSA_TYPE_STRING) {
+    sort_progress_begin(size);
+    return argsort_radix(data, order);
+  }
+
+  sort_progress_begin((uint64_t)size * merge_pass_count(size));
+  switch (data->type) {
+  case DSA_TYPE_INT:
+    return argsort_merge_int((int *)data->array, size, order);
+  case DSA_TYPE_FLOAT:
+    return argsort_merge_float((float *)data->array, size, order);
+  case DSA_TYPE_CHAR:
+    return argsort_merge_char((char *)data->array, size, order);
+  case DSA_TYPE_STRING:
+    return argsort_merge_string((char **)data->array, size, order);
+  }
+  return false;
+}
+
+// dst[i] = src[order[i]] pour des éléments de `width` octets (largeurs
+// courantes copiées par des affectations de taille fixe)
+static void gather_elements(void *dst, const void *src, const size_t *order,
+                            size_t size, size_t width) {
+  switch (width) {
+  case 1:
     for (size_t i = 0; i < size; i++)
-      ((int *)data->array)[i] = rand() % 1000;
+      ((uint8_t *)dst)[i] = ((const uint8_t *)src)[order[i]];
     break;
-  case TYPE_FLOAT:
-    data->array = malloc(size * sizeof(float));
+  case 4:
     for (size_t i = 0; i < size; i++)
-      ((float *)data->array)[i] = (float)rand() / (float)(RAND_MAX / 1000.0);
+      ((uint32_t *)dst)[i] = ((const uint32_t *)src)[order[i]];
     break;
-  case TYPE_CHAR:
-    data->array = malloc(size * sizeof(char));
+  case 8:
     for (size_t i = 0; i < size; i++)
-      ((char *)data->array)[i] = 'A' + (rand() % 26);
+      ((uint64_t *)dst)[i] = ((const uint64_t *)src)[order[i]];
     break;
-  case TYPE_STRING:
-    // Pas implémenté pour l'instant pour garder simple (gestion mémoire
-    // complexe) Fallback sur INT
-    data->type = TYPE_INT;
-    data->array = malloc(size * sizeof(int));
+  default:
     for (size_t i = 0; i < size; i++)
-      ((int *)data->array)[i] = rand() % 1000;
+      memcpy((char *)dst + i * width, (const char *)src + order[i] * width,
+             width);
     break;
   }
 }
 
-void free_array_data(ArrayData *data) {
+// Tri stable des enregistrements : permutation, puis rangement des clés et
+// des données associées. Sans mémoire ou annulé, le tableau reste intact.
+static void sort_records(DsaArrayData *data, DsaSortAlgo algo) {
+  size_t size = data->size;
+  if (size < 2)
+    return;
+
+  size_t key_size = dsa_array_element_size(data->type);
+  size_t payload_size = data->payload_size;
+  size_t *order = malloc(size * sizeof(size_t));
+  void *keys = malloc(size * key_size);
+  void *payload = malloc(payload_size ? size * payload_size : 1);
+  if (order && keys && payload && argsort_dispatch(data, algo, order) &&
+      !sort_cancelled()) {
+    gather_elements(keys, data->array, order, size, key_size);
+    memcpy(data->array, keys, size * key_size);
+    gather_elements(payload, data->payload, order, size, payload_size);
+    memcpy(data->payload, payload, size * payload_size);
+  }
+  free(payload);
+  free(keys);
+  free(order);
+}
+
+// --- Tri parallèle (sample sort) ---
+// 1. Des séparateurs sont choisis dans un échantillon trié du tableau.
+// 2. Chaque thread compte, pour son segment, les éléments de chaque seau.
+// 3. Les sommes préfixes donnent à chaque thread sa zone d'écriture dans
+//    chaque seau ; les threads dispersent leurs éléments dans un tampon.
+// 4. Les seaux (du plus grand au plus petit) sont distribués dynamiquement
+//    aux threads, triés par introsort puis recopiés à leur place finale.
+// Chaque séparateur possède aussi un seau « égalité » qui n'a pas besoin
+// d'être trié : les valeurs très répétées ne déséquilibrent pas les threads.
+
+int dsa_sort_get_thread_count(void) {
+  int count = atomic_load_explicit(&sort_thread_count, memory_order_relaxed);
+  if (count > 0)
+    return count;
+
+  long cpus = 1;
+#ifdef _WIN32
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  cpus = (long)info.dwNumberOfProcessors;
+#elif defined(_SC_NPROCESSORS_ONLN)
+  cpus = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+  if (cpus < 1)
+    cpus = 1;
+  if (cpus > PARALLEL_MAX_THREADS)
+    cpus = PARALLEL_MAX_THREADS;
+  return (int)cpus;
+}
+
+void dsa_sort_set_thread_count(int count) {
+  if (count < 0)
+    count = 0;
+  if (count > PARALLEL_MAX_THREADS)
+    count = PARALLEL_MAX_THREADS;
+  atomic_store_explicit(&sort_thread_count, count, memory_order_relaxed);
+}
+
+// Exécute worker(args + i * arg_size) sur `threads` threads (le dernier sur
+// le thread appelant) et attend leur fin. Si un thread ne peut pas être
+// créé, sa part est exécutée sur le thread appelant.
+static void run_parallel(int threads, void *(*worker)(void *), void *args,
+                         size_t arg_size) {
+  pthread_t ids[PARALLEL_MAX_THREADS];
+  bool started[PARALLEL_MAX_THREADS];
+
+  for (int t = 0; t < threads - 1; t++) {
+    void *arg = (char *)args + (size_t)t * arg_size;
+    started[t] = pthread_create(&ids[t], NULL, worker, arg) == 0;
+    if (!started[t])
+      worker(arg);
+  }
+  worker((char *)args + (size_t)(threads - 1) * arg_size);
+  for (int t = 0; t < threads - 1; t++) {
+    if (started[t])
+      pthread_join(ids[t], NULL);
+  }
+}
+
+// Nombre de threads effectivement utilisés pour `size` éléments
+static int parallel_threads_for(size_t size) {
+  int threads = dsa_sort_get_thread_count();
+  size_t max_by_size = size / PARALLEL_MIN_CHUNK;
+  if ((size_t)threads > max_by_size)
+    threads = (int)max_by_size;
+  return threads < 1 ? 1 : threads;
+}
+
+typedef enum {
+  PARALLEL_PHASE_COUNT,
+  PARALLEL_PHASE_SCATTER,
+  PARALLEL_PHASE_SORT
+} ParallelPhase;
+
+#define DEFINE_PARALLEL_SORT(SUFFIX, T, LESS)                                  \
+  typedef struct {                                                             \
+    T *arr;                                                                    \
+    T *tmp;                                                                    \
+    size_t size;                                                               \
+    int threads;                                                               \
+    T *splitters;                                                              \
+    size_t num_splitters;                                                      \
+    size_t num_buckets;                                                        \
+    size_t *counts;       /* [thread][seau] puis positions d'écriture */       \
+    size_t *bucket_start; /* [seau + 1] */                                     \
+    size_t *order;        /* seaux non vides, du plus grand au plus petit */   \
+    size_t order_count;                                                        \
+    atomic_size_t next_bucket;                                                 \
+    ParallelPhase phase;                                                       \
+    DsaSortControl *control; /* Suivi du thread appelant */                    \
+  } ParallelSort_##SUFFIX;                                                     \
+                                                                               \
+  typedef struct {                                                             \
+    ParallelSort_##SUFFIX *ctx;                                                \
+    int id;                                                                    \
+  } ParallelWorker_##SUFFIX;                                                   \
+                                                                               \
+  /* Seau 2j : s[j-1] < x < s[j] ; seau 2j-1 : x == s[j-1] */                  \
+  static inline size_t classify_##SUFFIX(const ParallelSort_##SUFFIX *ctx,     \
+                                         T x) {                                \
+    T *s = ctx->splitters;                                                     \
+    size_t lo = 0, len = ctx->num_splitters;                                   \
+    while (len > 0) {                                                          \
+      size_t half = len / 2;                                                   \
+      if (LESS(x, s[lo + half])) {                                             \
+        len = half;                                                            \
+      } else {                                                                 \
+        lo += half + 1;                                                        \
+        len -= half + 1;                                                       \
+      }                                                                        \
+    }                                                                          \
+    if (lo > 0 && !LESS(s[lo - 1], x))                                         \
+      return 2 * lo - 1;                                                       \
+    return 2 * lo;                                                             \
+  }                                                                            \
+                                                                               \
+  static void *parallel_worker_##SUFFIX(void *arg) {                           \
+    ParallelWorker_##SUFFIX *w = arg;                                          \
+    ParallelSort_##SUFFIX *ctx = w->ctx;                                       \
+    size_t begin = ctx->size * (size_t)w->id / (size_t)ctx->threads;           \
+    size_t end = ctx->size * (size_t)(w->id + 1) / (size_t)ctx->threads;       \
+    size_t *counts = ctx->counts + (size_t)w->id * ctx->num_buckets;           \
+    sort_control = ctx->control;                                               \
+                                                                               \
+    switch (ctx->phase) {                                                      \
+    case PARALLEL_PHASE_COUNT:                                                 \
+      for (size_t i = begin; i < end; i++)                                     \
+        counts[classify_##SUFFIX(ctx, ctx->arr[i])]++;                         \
+      break;                                                                   \
+    case PARALLEL_PHASE_SCATTER:                                               \
+      for (size_t i = begin; i < end; i++) {                                   \
+        T x = ctx->arr[i];                                                     \
+        ctx->tmp[counts[classify_##SUFFIX(ctx, x)]++] = x;                     \
+      }                                                                        \
+      break;                                                                   \
+    case PARALLEL_PHASE_SORT: {                                                \
+      size_t k;                                                                \
+      while ((k = atomic_fetch_add(&ctx->next_bucket, 1)) <                    \
+             ctx->order_count) {                                               \
+        size_t b = ctx->order[k];                                              \
+        size_t start = ctx->bucket_start[b];                                   \
+        size_t len = ctx->bucket_start[b + 1] - start;                         \
+        /* Après annulation, les seaux sont recopiés sans être triés */        \
+        if (b % 2 == 0)                                                        \
+          quick_sort_##SUFFIX(ctx->tmp + start, len);                          \
+        else                                                                   \
+          sort_progress_add(len);                                              \
+        memcpy(ctx->arr + start, ctx->tmp + start, len * sizeof(T));           \
+      }                                                                        \
+      break;                                                                   \
+    }                                                                          \
+    }                                                                          \
+    return NULL;                                                               \
+  }                                                                            \
+                                                                               \
+  static void parallel_sort_##SUFFIX(T *arr, size_t size) {                    \
+    int threads = parallel_threads_for(size);                                  \
+    if (size < PARALLEL_SORT_THRESHOLD || threads < 2) {                       \
+      quick_sort_##SUFFIX(arr, size);                                          \
+      return;                                                                  \
+    }                                                                          \
+                                                                               \
+    size_t wanted = (size_t)threads * PARALLEL_BUCKETS_PER_THREAD;             \
+    size_t sample_size = wanted * PARALLEL_OVERSAMPLING;                       \
+    size_t max_buckets = 2 * wanted + 1;                                       \
+    T *tmp = sort_scratch_alloc(size * sizeof(T));                             \
+    T *sample = malloc(sample_size * sizeof(T));                               \
+    size_t *counts = calloc((size_t)threads * max_buckets, sizeof(size_t));    \
+    size_t *bucket_start = malloc((max_buckets + 1) * sizeof(size_t));         \
+    size_t *order = malloc(max_buckets * sizeof(size_t));                      \
+    if (!tmp || !sample || !counts || !bucket_start || !order) {               \
+      sort_scratch_free(tmp);                                                  \
+      free(sample);                                                            \
+      free(counts);                                                            \
+      free(bucket_start);                                                      \
+      free(order);                                                             \
+      quick_sort_##SUFFIX(arr, size);                                          \
+      return;                                                                  \
+    }                                                                          \
+                                                                               \
+    /* Échantillon pseudo-aléatoire (xorshift à graine fixe), trié, */         \
+    /* puis séparateurs distincts pris à intervalles réguliers */              \
+    uint64_t state = 0x9E3779B97F4A7C15ull;                                    \
+    for (size_t i = 0; i < sample_size; i++) {                                 \
+      state ^= state << 13;                                                    \
+      state ^= state >> 7;                                                     \
+      state ^= state << 17;                                                    \
+      sample[i] = arr[state % size];                                           \
+    }                                                                          \
+    /* Échantillon : hors avancement */                                        \
+    DsaSortControl *control = sort_control;                                    \
+    sort_control = NULL;                                                       \
+    quick_sort_##SUFFIX(sample, sample_size);                                  \
+    sort_control = control;                                                    \
+    size_t num_splitters = 0;                                                  \
+    for (size_t i = 1; i < wanted; i++) {                                      \
+      T candidate = sample[i * PARALLEL_OVERSAMPLING];                         \
+      if (num_splitters == 0 ||                                                \
+          LESS(sample[num_splitters - 1], candidate))                          \
+        sample[num_splitters++] = candidate;                                   \
+    }                                                                          \
+                                                                               \
+    ParallelSort_##SUFFIX ctx = {0};                                           \
+    ctx.arr = arr;                                                             \
+    ctx.tmp = tmp;                                                             \
+    ctx.size = size;                                                           \
+    ctx.threads = threads;                                                     \
+    ctx.splitters = sample;                                                    \
+    ctx.num_splitters = num_splitters;                                         \
+    ctx.num_buckets = 2 * num_splitters + 1;                                   \
+    ctx.counts = counts;                                                       \
+    ctx.bucket_start = bucket_start;                                           \
+    ctx.order = order;                                                         \
+    ctx.control = sort_control;                                                \
+                                                                               \
+    ParallelWorker_##SUFFIX workers[PARALLEL_MAX_THREADS];                     \
+    for (int t = 0; t < threads; t++) {                                        \
+      workers[t].ctx = &ctx;                                                   \
+      workers[t].id = t;                                                       \
+    }                                                                          \
+                                                                               \
+    ctx.phase = PARALLEL_PHASE_COUNT;                                          \
+    run_parallel(threads, parallel_worker_##SUFFIX, workers,                   \
+                 sizeof(workers[0]));                                          \
+                                                                               \
+    /* Début de chaque seau, puis position d'écriture de chaque thread */      \
+    size_t offset = 0;                                                         \
+    for (size_t b = 0; b < ctx.num_buckets; b++) {                             \
+      bucket_start[b] = offset;                                                \
+      for (int t = 0; t < threads; t++) {                                      \
+        size_t *c = &counts[(size_t)t * ctx.num_buckets + b];                  \
+        size_t n = *c;                                                         \
+        *c = offset;                                                           \
+        offset += n;                                                           \
+      }                                                                        \
+    }                                                                          \
+    bucket_start[ctx.num_buckets] = offset;                                    \
+                                                                               \
+    ctx.phase = PARALLEL_PHASE_SCATTER;                                        \
+    run_parallel(threads, parallel_worker_##SUFFIX, workers,                   \
+                 sizeof(workers[0]));                                          \
+                                                                               \
+    /* Seaux non vides par taille décroissante (insertion : peu de seaux) */   \
+    for (size_t b = 0; b < ctx.num_buckets; b++) {                             \
+      size_t len = bucket_start[b + 1] - bucket_start[b];                      \
+      if (len == 0)                                                            \
+        continue;                                                              \
+      size_t k = ctx.order_count++;                                            \
+      while (k > 0 &&                                                          \
+             bucket_start[order[k - 1] + 1] - bucket_start[order[k - 1]] <     \
+                 len) {                                                        \
+        order[k] = order[k - 1];                                               \
+        k--;                                                                   \
+      }                                                                        \
+      order[k] = b;                                                            \
+    }                                                                          \
+    atomic_init(&ctx.next_bucket, 0);                                          \
+                                                                               \
+    ctx.phase = PARALLEL_PHASE_SORT;                                           \
+    run_parallel(threads, parallel_worker_##SUFFIX, workers,                   \
+                 sizeof(workers[0]));                                          \
+                                                                               \
+    sort_scratch_free(tmp);                                                    \
+    free(sample);                                                              \
+    free(counts);                                                              \
+    free(bucket_start);                                                        \
+    free(order);                                                               \
+  }
+
+DEFINE_PARALLEL_SORT(int, int, LESS_NUM)
+DEFINE_PARALLEL_SORT(float, float, LESS_NUM)
+DEFINE_PARALLEL_SORT(char, char, LESS_NUM)
+DEFINE_PARALLEL_SORT(string, char *, LESS_STR)
+
+// --- Fonctions publiques ---
+
+size_t dsa_array_element_size(DsaDataType type) {
+  switch (type) {
+  case DSA_TYPE_INT:
+    return sizeof(int);
+  case DSA_TYPE_FLOAT:
+    return sizeof(float);
+  case DSA_TYPE_CHAR:
+    return sizeof(char);
+  case DSA_TYPE_STRING:
+    return sizeof(char *);
+  }
+  return sizeof(int);
+}
+
+void dsa_generate_random_data(DsaArrayData *data, size_t size,
+                              DsaDataType type) {
+  // Nouvelle graine à chaque appel ; dsa_generate_array() avec une graine fixe
+  // pour des données reproductibles
+  DsaArrayGenOptions options =
+      dsa_array_gen_options(DSA_DIST_UNIFORM, dsa_prng_fresh_seed());
+  dsa_generate_array(data, size, type, &options);
+}
+
+void dsa_free_array_data(DsaArrayData *data) {
   if (data->array) {
+    if (data->type == DSA_TYPE_STRING) {
+      char **arr = (char **)data->array;
+      for (size_t i = 0; i < data->size; i++)
+        free(arr[i]);
+    }
     free(data->array);
     data->array = NULL;
   }
+  free(data->payload);
+  data->payload = NULL;
+  data->payload_size = 0;
   data->size = 0;
 }
 
-double sort_array(ArrayData *data, SortAlgo algo) {
-  clock_t start = clock();
+DsaTimingSample dsa_sort_array_timed(DsaArrayData *data, DsaSortAlgo algo) {
+  DsaTimingMark start = dsa_timing_mark();
 
-  // NOTE: Ici on ne traite que les INT pour l'exemple du prototype.
-  // Il faudrait ajouter des switch cases pour FLOAT, CHAR, etc.
-  if (data->type == TYPE_INT) {
-    int *arr = (int *)data->array;
-    switch (algo) {
-    case ALGO_BUBBLE:
-      bubble_sort_int(arr, data->size);
-      break;
-    case ALGO_INSERTION:
-      insertion_sort_int(arr, data->size);
-      break;
-    case ALGO_SHELL:
-      shell_sort_int(arr, data->size);
-      break;
-    case ALGO_QUICK:
-      quick_sort_int(arr, data->size);
-      break;
-    }
+  if (data->payload) {
+    sort_records(data, algo);
+    return dsa_timing_since(start);
+  }
+
+  switch (data->type) {
+  case DSA_TYPE_INT:
+    sort_int((int *)data->array, data->size, algo);
+    break;
+  case DSA_TYPE_FLOAT:
+    sort_float((float *)data->array, data->size, algo);
+    break;
+  case DSA_TYPE_CHAR:
+    sort_char((char *)data->array, data->size, algo);
+    break;
+  case DSA_TYPE_STRING:
+    sort_string((char **)data->array, data->size, algo);
+    break;
   }
 
-  clock_t end = clock();
-  return ((double)(end - start)) / CLOCKS_PER_SEC;
+  return dsa_timing_since(start);
 }
 
-char *array_to_string(const ArrayData *data) {
-  // Allocation d'un grand buffer
-  // On estime ~12 chars par nombre + virgule (max int 10 chars + signes)
-  size_t buffer_size = data->size * 15 + 100;
-  char *buffer = malloc(buffer_size);
-  if (!buffer)
-    return NULL;
+bool dsa_sort_argsort(const DsaArrayData *data, DsaSortAlgo algo,
+                      size_t *order) {
+  return argsort_dispatch(data, algo, order);
+}
 
-  char *ptr = buffer; // Pointeur courant pour écriture efficace
-  *ptr = '\0';
-
-  // Affichage complet (aucune troncation demandée)
-
-  if (data->type == TYPE_INT) {
-    int *arr = (int *)data->array;
-    for (size_t i = 0; i < data->size; i++) {
-      // Imprime directement à la position ptr
-      int written = sprintf(ptr, "%d", arr[i]);
-      if (written > 0)
-        ptr += written;
-
-      if (i < data->size - 1) {
-        if ((i + 1) % 100 == 0) { // Saut de ligne toutes les 100 valeurs
-          strcpy(ptr, "\n");
-          ptr += 1;
-        } else {
-          strcpy(ptr, ", ");
-          ptr += 2;
-        }
-      }
-    }
-  } else if (data->type == TYPE_FLOAT) {
-    float *arr = (float *)data->array;
-    for (size_t i = 0; i < data->size; i++) {
-      int written = sprintf(ptr, "%.2f", arr[i]);
-      if (written > 0)
-        ptr += written;
-
-      if (i < data->size - 1) {
-        if ((i + 1) % 80 == 0) {
-          strcpy(ptr, "\n");
-          ptr += 1;
-        } else {
-          strcpy(ptr, ", ");
-          ptr += 2;
-        }
-      }
-    }
-  } else if (data->type == TYPE_CHAR) {
-    char *arr = (char *)data->array;
-    for (size_t i = 0; i < data->size; i++) {
-      int written = sprintf(ptr, "%c", arr[i]);
-      if (written > 0)
-        ptr += written;
-
-      if (i < data->size - 1) {
-        if ((i + 1) % 150 == 0) {
-          strcpy(ptr, "\n");
-          ptr += 1;
-        } else {
-          strcpy(ptr, ", ");
-          ptr += 2;
-        }
-      }
-    }
+double dsa_sort_array(DsaArrayData *data, DsaSortAlgo algo) {
+  return dsa_timing_ns_to_s(dsa_sort_array_timed(data, algo).ns);
+}
+
+void dsa_sort_control_init(DsaSortControl *control) {
+  atomic_init(&control->cancel, false);
+  atomic_init(&control->done, 0);
+  atomic_init(&control->total, 0);
+  control->scratch = NULL;
+}
+
+void dsa_sort_control_cancel(DsaSortControl *control) {
+  atomic_store(&control->cancel, true);
+}
+
+double dsa_sort_control_progress(DsaSortControl *control) {
+  uint64_t total = atomic_load_explicit(&control->total, memory_order_relaxed);
+  uint64_t done = atomic_load_explicit(&control->done, memory_order_relaxed);
+  if (total == 0)
+    return 0.0;
+  return done >= total ? 1.0 : (double)done / (double)total;
+}
+
+bool dsa_sort_array_controlled(DsaArrayData *data, DsaSortAlgo algo,
+                               DsaSortControl *control,
+                               DsaTimingSample *elapsed) {
+  DsaSortControl *previous = sort_control;
+  sort_control = control;
+  DsaTimingSample sample = dsa_sort_array_timed(data, algo);
+  sort_control = previous;
+
+  bool cancelled = control && atomic_load(&control->cancel);
+  if (control && !cancelled) {
+    // Certains tris s'arrêtent avant d'avoir consommé tout leur budget
+    atomic_store(&control->done, atomic_load(&control->total));
   }
+  if (elapsed)
+    *elapsed = sample;
+  return !cancelled;
+}
 
-  return buffer;
+char *dsa_array_to_string(const DsaArrayData *data) {
+  // Affichage complet (aucune troncation demandée) ; saut de ligne toutes
+  // les dsa_array_format_line_length(type) valeurs
+  DsaTextBuffer buffer = {0};
+  if (!dsa_array_format_append(&buffer, data, 0, data->size,
+                               dsa_array_format_line_length(data->type))) {
+    dsa_text_buffer_free(&buffer);
+    return NULL;
+  }
+  return buffer.text;
 }
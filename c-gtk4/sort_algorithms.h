@@ -1,32 +1,108 @@
 #ifndef SORT_ALGORITHMS_H
 #define SORT_ALGORITHMS_H
 
+#include "ds_types.h"
+#include "scratch_pool.h"
+#include "timing.h"
+#include <stdatomic.h>
+#include <stdbool.h>
 #include <stddef.h>
-
-// Types de données supportés
-typedef enum { TYPE_INT, TYPE_FLOAT, TYPE_CHAR, TYPE_STRING } DataType;
+#include <stdint.h>
 
 // Algorithmes de tri supportés
-typedef enum { ALGO_BUBBLE, ALGO_INSERTION, ALGO_SHELL, ALGO_QUICK } SortAlgo;
+// DSA_ALGO_RADIX / DSA_ALGO_COUNTING sont linéaires pour DSA_TYPE_INT,
+// DSA_TYPE_FLOAT et DSA_TYPE_CHAR ; pour DSA_TYPE_STRING ils se replient sur
+// DSA_ALGO_QUICK. DSA_ALGO_PARALLEL est un tri par échantillonnage
+// multi-thread ; sous 100000 éléments il se replie sur DSA_ALGO_QUICK.
+// DSA_ALGO_MERGE est un tri fusion stable (ascendant, insertion sur les petits
+// blocs).
+typedef enum {
+  DSA_ALGO_BUBBLE,
+  DSA_ALGO_INSERTION,
+  DSA_ALGO_SHELL,
+  DSA_ALGO_QUICK,
+  DSA_ALGO_RADIX,
+  DSA_ALGO_COUNTING,
+  DSA_ALGO_PARALLEL,
+  DSA_ALGO_MERGE
+} DsaSortAlgo;
+
+#define DSA_SORT_ALGO_COUNT 8
 
 // Structure unique pour passer les données
+// Pour DSA_TYPE_STRING, `array` est un tableau de `char *` (chaque chaîne est
+// allouée séparément et libérée par dsa_free_array_data).
+// `payload` (facultatif, NULL par défaut) associe `payload_size` octets à
+// chaque élément : le tableau est alors un ensemble d'enregistrements dont
+// `array` contient les clés. Les tris déplacent chaque enregistrement avec
+// sa clé et sont tous stables : DSA_ALGO_RADIX et DSA_ALGO_COUNTING passent par
+// un radix stable (sauf pour les chaînes), les autres algorithmes par le tri
+// fusion. `payload` est libéré par dsa_free_array_data.
 typedef struct {
-  void *array;   // Pointeur vers le début du tableau
-  size_t size;   // Nombre d'éléments
-  DataType type; // Type des éléments
-} ArrayData;
+  void *array;      // Pointeur vers le début du tableau
+  size_t size;      // Nombre d'éléments
+  DsaDataType type; // Type des éléments
+  void *payload;
+  size_t payload_size; // Octets par élément dans `payload`
+} DsaArrayData;
+
+// Taille en octets d'un élément du type donné
+size_t dsa_array_element_size(DsaDataType type);
 
 // Génère des données aléatoires
-void generate_random_data(ArrayData *data, size_t size, DataType type);
+void dsa_generate_random_data(DsaArrayData *data, size_t size,
+                              DsaDataType type);
 
 // Libère la mémoire du tableau
-void free_array_data(ArrayData *data);
+void dsa_free_array_data(DsaArrayData *data);
 
 // Fonction de tri générique wrapper
 // Retourne le temps d'exécution en secondes
-double sort_array(ArrayData *data, SortAlgo algo);
+double dsa_sort_array(DsaArrayData *data, DsaSortAlgo algo);
+
+// Variante détaillée : durée en nanosecondes et en cycles processeur
+DsaTimingSample dsa_sort_array_timed(DsaArrayData *data, DsaSortAlgo algo);
+
+// Suivi d'un tri exécuté sur un autre thread : le tri publie son avancement
+// (done / total, en unités propres à l'algorithme) et s'interrompt dès que
+// `cancel` est posé. `scratch` (facultatif, NULL après dsa_sort_control_init)
+// fournit les tampons internes des tris au lieu d'un malloc par tri.
+typedef struct {
+  atomic_bool cancel;
+  atomic_uint_fast64_t done;
+  atomic_uint_fast64_t total;
+  DsaScratchPool *scratch;
+} DsaSortControl;
+
+void dsa_sort_control_init(DsaSortControl *control);
+void dsa_sort_control_cancel(DsaSortControl *control);
+// Avancement entre 0 et 1
+double dsa_sort_control_progress(DsaSortControl *control);
+
+// Tri indirect : `order` (data->size indices) reçoit la permutation qui
+// trie le tableau, sans déplacer les données ; order[i] est l'indice du
+// i-ème élément dans l'ordre croissant, les éléments égaux gardant leur
+// ordre d'origine. DSA_ALGO_RADIX et DSA_ALGO_COUNTING utilisent le radix
+// stable (sauf pour les chaînes), les autres algorithmes le tri fusion.
+// Retourne false si la mémoire manque.
+bool dsa_sort_argsort(const DsaArrayData *data, DsaSortAlgo algo,
+                      size_t *order);
+
+// Tri interruptible : `control` peut être NULL. Retourne false si le tri a
+// été annulé ; le tableau contient alors les mêmes éléments, partiellement
+// triés. `elapsed` (facultatif) reçoit la durée mesurée. Avec `payload`,
+// un tri annulé (ou sans mémoire pour ses tampons) laisse le tableau
+// inchangé.
+bool dsa_sort_array_controlled(DsaArrayData *data, DsaSortAlgo algo,
+                               DsaSortControl *control,
+                               DsaTimingSample *elapsed);
+
+// Nombre de threads utilisés par DSA_ALGO_PARALLEL (0 = nombre de coeurs) ;
+// réglable pendant que des tris tournent sur d'autres threads
+void dsa_sort_set_thread_count(int count);
+int dsa_sort_get_thread_count(void);
 
 // Convertit le tableau en chaîne de caractères pour affichage
-char *array_to_string(const ArrayData *data);
+char *dsa_array_to_string(const DsaArrayData *data);
 
 #endif
@@ -0,0 +1,313 @@
+#include "sort_network.h"
+#include <limits.h>
+#include <math.h>
+#include <pthread.h>
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SORT_NETWORK_X86 1
+#include <immintrin.h>
+#endif
+
+// --- Réseau bitonique ---
+// Le bloc est copié dans un tampon aligné de taille P (puissance de deux,
+// au moins 8) complété par des sentinelles maximales, trié par le réseau
+// bitonique classique, puis les `size` premiers éléments sont recopiés.
+//
+// Étape (k, j) : chaque élément i est comparé à i ^ j ; le sous-bloc de
+// taille k contenant i est trié en ordre croissant si (i & k) == 0.
+// Pour j >= largeur du vecteur, les paires sont dans deux vecteurs
+// distincts (min/max verticaux) ; sinon l'échange se fait dans le vecteur
+// par permutation puis mélange selon un masque calculé par voie.
+//
+// Réels : min_ps / max_ps renvoient leur second opérande quand les deux
+// valeurs sont égales (-0 et +0) ou que l'une est NaN, ce qui dupliquerait
+// une valeur et perdrait l'autre. L'échange garde donc les deux valeurs par
+// un mélange sur b < a, et un bloc contenant NaN est laissé au tri par
+// insertion de l'appelant.
+
+typedef enum { ISA_SCALAR, ISA_SSE41, ISA_AVX2 } NetworkIsa;
+
+static NetworkIsa network_isa = ISA_SCALAR;
+static pthread_once_t network_once = PTHREAD_ONCE_INIT;
+static _Thread_local bool network_disabled = false;
+
+static void network_detect(void) {
+#ifdef SORT_NETWORK_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2"))
+    network_isa = ISA_AVX2;
+  else if (__builtin_cpu_supports("sse4.1"))
+    network_isa = ISA_SSE41;
+#endif
+}
+
+static NetworkIsa current_isa(void) {
+  pthread_once(&network_once, network_detect);
+  return network_isa;
+}
+
+static size_t padded_size(size_t size) {
+  size_t p = 8;
+  while (p < size)
+    p <<= 1;
+  return p;
+}
+
+#ifdef SORT_NETWORK_X86
+
+__attribute__((target("avx2"))) static void bitonic_avx2_int(int *buf,
+                                                             size_t p) {
+  const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  const __m256i zero = _mm256_setzero_si256();
+  for (size_t k = 2; k <= p; k <<= 1) {
+    for (size_t j = k >> 1; j > 0; j >>= 1) {
+      if (j >= 8) {
+        for (size_t i = 0; i < p; i += 8) {
+          if (i & j)
+            continue;
+          __m256i a = _mm256_load_si256((__m256i *)(buf + i));
+          __m256i b = _mm256_load_si256((__m256i *)(buf + i + j));
+          __m256i lo = _mm256_min_epi32(a, b);
+          __m256i hi = _mm256_max_epi32(a, b);
+          bool up = (i & k) == 0;
+          _mm256_store_si256((__m256i *)(buf + i), up ? lo : hi);
+          _mm256_store_si256((__m256i *)(buf + i + j), up ? hi : lo);
+        }
+      } else {
+        const __m256i partner =
+            _mm256_xor_si256(lane, _mm256_set1_epi32((int)j));
+        const __m256i kv = _mm256_set1_epi32((int)k);
+        const __m256i jv = _mm256_set1_epi32((int)j);
+        for (size_t i = 0; i < p; i += 8) {
+          __m256i v = _mm256_load_si256((__m256i *)(buf + i));
+          __m256i w = _mm256_permutevar8x32_epi32(v, partner);
+          __m256i g = _mm256_add_epi32(lane, _mm256_set1_epi32((int)i));
+          __m256i up = _mm256_cmpeq_epi32(_mm256_and_si256(g, kv), zero);
+          __m256i low = _mm256_cmpeq_epi32(_mm256_and_si256(g, jv), zero);
+          __m256i take_min = _mm256_cmpeq_epi32(up, low);
+          v = _mm256_blendv_epi8(_mm256_max_epi32(v, w),
+                                 _mm256_min_epi32(v, w), take_min);
+          _mm256_store_si256((__m256i *)(buf + i), v);
+        }
+      }
+    }
+  }
+}
+
+__attribute__((target("avx2"))) static void bitonic_avx2_float(float *buf,
+                                                               size_t p) {
+  const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  const __m256i zero = _mm256_setzero_si256();
+  for (size_t k = 2; k <= p; k <<= 1) {
+    for (size_t j = k >> 1; j > 0; j >>= 1) {
+      if (j >= 8) {
+        for (size_t i = 0; i < p; i += 8) {
+          if (i & j)
+            continue;
+          __m256 a = _mm256_load_ps(buf + i);
+          __m256 b = _mm256_load_ps(buf + i + j);
+          __m256 swap = _mm256_cmp_ps(b, a, _CMP_LT_OQ);
+          __m256 lo = _mm256_blendv_ps(a, b, swap);
+          __m256 hi = _mm256_blendv_ps(b, a, swap);
+          bool up = (i & k) == 0;
+          _mm256_store_ps(buf + i, up ? lo : hi);
+          _mm256_store_ps(buf + i + j, up ? hi : lo);
+        }
+      } else {
+        const __m256i partner =
+            _mm256_xor_si256(lane, _mm256_set1_epi32((int)j));
+        const __m256i kv = _mm256_set1_epi32((int)k);
+        const __m256i jv = _mm256_set1_epi32((int)j);
+        for (size_t i = 0; i < p; i += 8) {
+          __m256 v = _mm256_load_ps(buf + i);
+          __m256 w = _mm256_permutevar8x32_ps(v, partner);
+          __m256i g = _mm256_add_epi32(lane, _mm256_set1_epi32((int)i));
+          __m256i up = _mm256_cmpeq_epi32(_mm256_and_si256(g, kv), zero);
+          __m256i low = _mm256_cmpeq_epi32(_mm256_and_si256(g, jv), zero);
+          __m256 take_min = _mm256_castsi256_ps(_mm256_cmpeq_epi32(up, low));
+          // Chaque voie ne prend la valeur partenaire que si elle est
+          // strictement plus petite (min) ou plus grande (max)
+          __m256 lo = _mm256_blendv_ps(v, w, _mm256_cmp_ps(w, v, _CMP_LT_OQ));
+          __m256 hi = _mm256_blendv_ps(v, w, _mm256_cmp_ps(v, w, _CMP_LT_OQ));
+          v = _mm256_blendv_ps(hi, lo, take_min);
+          _mm256_store_ps(buf + i, v);
+        }
+      }
+    }
+  }
+}
+
+__attribute__((target("sse4.1"))) static void bitonic_sse41_int(int *buf,
+                                                                size_t p) {
+  const __m128i lane = _mm_setr_epi32(0, 1, 2, 3);
+  const __m128i zero = _mm_setzero_si128();
+  for (size_t k = 2; k <= p; k <<= 1) {
+    for (size_t j = k >> 1; j > 0; j >>= 1) {
+      if (j >= 4) {
+        for (size_t i = 0; i < p; i += 4) {
+          if (i & j)
+            continue;
+          __m128i a = _mm_load_si128((__m128i *)(buf + i));
+          __m128i b = _mm_load_si128((__m128i *)(buf + i + j));
+          __m128i lo = _mm_min_epi32(a, b);
+          __m128i hi = _mm_max_epi32(a, b);
+          bool up = (i & k) == 0;
+          _mm_store_si128((__m128i *)(buf + i), up ? lo : hi);
+          _mm_store_si128((__m128i *)(buf + i + j), up ? hi : lo);
+        }
+      } else {
+        const __m128i kv = _mm_set1_epi32((int)k);
+        const __m128i jv = _mm_set1_epi32((int)j);
+        for (size_t i = 0; i < p; i += 4) {
+          __m128i v = _mm_load_si128((__m128i *)(buf + i));
+          __m128i w = (j == 1) ? _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1))
+                               : _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2));
+          __m128i g = _mm_add_epi32(lane, _mm_set1_epi32((int)i));
+          __m128i up = _mm_cmpeq_epi32(_mm_and_si128(g, kv), zero);
+          __m128i low = _mm_cmpeq_epi32(_mm_and_si128(g, jv), zero);
+          __m128i take_min = _mm_cmpeq_epi32(up, low);
+          v = _mm_blendv_epi8(_mm_max_epi32(v, w), _mm_min_epi32(v, w),
+                              take_min);
+          _mm_store_si128((__m128i *)(buf + i), v);
+        }
+      }
+    }
+  }
+}
+
+__attribute__((target("sse4.1"))) static void bitonic_sse41_float(float *buf,
+                                                                  size_t p) {
+  const __m128i lane = _mm_setr_epi32(0, 1, 2, 3);
+  const __m128i zero = _mm_setzero_si128();
+  for (size_t k = 2; k <= p; k <<= 1) {
+    for (size_t j = k >> 1; j > 0; j >>= 1) {
+      if (j >= 4) {
+        for (size_t i = 0; i < p; i += 4) {
+          if (i & j)
+            continue;
+          __m128 a = _mm_load_ps(buf + i);
+          __m128 b = _mm_load_ps(buf + i + j);
+          __m128 swap = _mm_cmplt_ps(b, a);
+          __m128 lo = _mm_blendv_ps(a, b, swap);
+          __m128 hi = _mm_blendv_ps(b, a, swap);
+          bool up = (i & k) == 0;
+          _mm_store_ps(buf + i, up ? lo : hi);
+          _mm_store_ps(buf + i + j, up ? hi : lo);
+        }
+      } else {
+        const __m128i kv = _mm_set1_epi32((int)k);
+        const __m128i jv = _mm_set1_epi32((int)j);
+        for (size_t i = 0; i < p; i += 4) {
+          __m128 v = _mm_load_ps(buf + i);
+          __m128 w = (j == 1) ? _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1))
+                              : _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2));
+          __m128i g = _mm_add_epi32(lane, _mm_set1_epi32((int)i));
+          __m128i up = _mm_cmpeq_epi32(_mm_and_si128(g, kv), zero);
+          __m128i low = _mm_cmpeq_epi32(_mm_and_si128(g, jv), zero);
+          __m128 take_min = _mm_castsi128_ps(_mm_cmpeq_epi32(up, low));
+          __m128 lo = _mm_blendv_ps(v, w, _mm_cmplt_ps(w, v));
+          __m128 hi = _mm_blendv_ps(v, w, _mm_cmplt_ps(v, w));
+          v = _mm_blendv_ps(hi, lo, take_min);
+          _mm_store_ps(buf + i, v);
+        }
+      }
+    }
+  }
+}
+
+// Un élément au moins est NaN (comparaison non ordonnée avec lui-même)
+__attribute__((target("avx2"))) static bool has_nan_avx2(const float *buf,
+                                                         size_t p) {
+  __m256 unordered = _mm256_setzero_ps();
+  for (size_t i = 0; i < p; i += 8) {
+    __m256 v = _mm256_load_ps(buf + i);
+    unordered = _mm256_or_ps(unordered, _mm256_cmp_ps(v, v, _CMP_UNORD_Q));
+  }
+  return _mm256_movemask_ps(unordered) != 0;
+}
+
+__attribute__((target("sse4.1"))) static bool has_nan_sse41(const float *buf,
+                                                           size_t p) {
+  __m128 unordered = _mm_setzero_ps();
+  for (size_t i = 0; i < p; i += 4) {
+    __m128 v = _mm_load_ps(buf + i);
+    unordered = _mm_or_ps(unordered, _mm_cmpunord_ps(v, v));
+  }
+  return _mm_movemask_ps(unordered) != 0;
+}
+
+#endif // SORT_NETWORK_X86
+
+// --- API publique ---
+
+size_t dsa_sort_network_limit(void) {
+  if (network_disabled || current_isa() == ISA_SCALAR)
+    return 0;
+  return DSA_SORT_NETWORK_MAX;
+}
+
+bool dsa_sort_network_int(int *arr, size_t size) {
+  if (size > DSA_SORT_NETWORK_MAX || dsa_sort_network_limit() == 0)
+    return false;
+#ifdef SORT_NETWORK_X86
+  _Alignas(32) int buf[DSA_SORT_NETWORK_MAX];
+  size_t p = padded_size(size);
+  memcpy(buf, arr, size * sizeof(int));
+  for (size_t i = size; i < p; i++)
+    buf[i] = INT_MAX;
+
+  if (current_isa() == ISA_AVX2)
+    bitonic_avx2_int(buf, p);
+  else
+    bitonic_sse41_int(buf, p);
+
+  memcpy(arr, buf, size * sizeof(int));
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool dsa_sort_network_float(float *arr, size_t size) {
+  if (size > DSA_SORT_NETWORK_MAX || dsa_sort_network_limit() == 0)
+    return false;
+#ifdef SORT_NETWORK_X86
+  _Alignas(32) float buf[DSA_SORT_NETWORK_MAX];
+  size_t p = padded_size(size);
+  memcpy(buf, arr, size * sizeof(float));
+  for (size_t i = size; i < p; i++)
+    buf[i] = INFINITY;
+
+  if (current_isa() == ISA_AVX2) {
+    if (has_nan_avx2(buf, p))
+      return false;
+    bitonic_avx2_float(buf, p);
+  } else {
+    if (has_nan_sse41(buf, p))
+      return false;
+    bitonic_sse41_float(buf, p);
+  }
+
+  memcpy(arr, buf, size * sizeof(float));
+  return true;
+#else
+  return false;
+#endif
+}
+
+void dsa_sort_network_set_enabled(bool enabled) { network_disabled = !enabled; }
+
+bool dsa_sort_network_is_enabled(void) { return !network_disabled; }
+
+const char *dsa_sort_network_isa(void) {
+  switch (current_isa()) {
+  case ISA_AVX2:
+    return "AVX2";
+  case ISA_SSE41:
+    return "SSE4.1";
+  case ISA_SCALAR:
+    break;
+  }
+  return "scalaire";
+}
@@ -0,0 +1,30 @@
+#ifndef SORT_NETWORK_H
+#define SORT_NETWORK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Taille maximale d'un bloc trié par réseau de tri bitonique
+#define DSA_SORT_NETWORK_MAX 64
+
+// Trie en place un bloc de `size` éléments (size <= DSA_SORT_NETWORK_MAX) avec
+// un réseau bitonique vectorisé (AVX2 ou SSE4.1, choisi à l'exécution via
+// CPUID). Retourne false sans rien modifier si le bloc est trop grand, si
+// aucune extension SIMD n'est disponible, si les réseaux sont désactivés
+// pour le thread appelant ou (réels) si le bloc contient NaN : l'appelant
+// garde alors son tri par insertion. Les réels égaux (-0 et +0) sont
+// conservés tels quels.
+bool dsa_sort_network_int(int *arr, size_t size);
+bool dsa_sort_network_float(float *arr, size_t size);
+
+// Taille de bloc à confier aux réseaux (0 s'ils sont inutilisables)
+size_t dsa_sort_network_limit(void);
+
+// Active/désactive les réseaux SIMD pour le thread appelant (comparaisons)
+void dsa_sort_network_set_enabled(bool enabled);
+bool dsa_sort_network_is_enabled(void);
+
+// Jeu d'instructions retenu : "AVX2", "SSE4.1" ou "scalaire"
+const char *dsa_sort_network_isa(void);
+
+#endif
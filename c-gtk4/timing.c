@@ -0,0 +1,119 @@
+#include "timing.h"
+#include <math.h>
+#include <stdlib.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define TIMING_HAS_RDTSC 1
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define TIMING_HAS_RDTSC 1
+#endif
+
+// --- Horloges ---
+
+uint64_t dsa_timing_now_ns(void) {
+#ifdef _WIN32
+  static LARGE_INTEGER frequency;
+  LARGE_INTEGER counter;
+  if (frequency.QuadPart == 0)
+    QueryPerformanceFrequency(&frequency);
+  QueryPerformanceCounter(&counter);
+  // Découpage pour éviter le débordement de counter * 1e9
+  uint64_t seconds = (uint64_t)(counter.QuadPart / frequency.QuadPart);
+  uint64_t rest = (uint64_t)(counter.QuadPart % frequency.QuadPart);
+  return seconds * 1000000000ull +
+         rest * 1000000000ull / (uint64_t)frequency.QuadPart;
+#else
+  struct timespec ts;
+#ifdef CLOCK_MONOTONIC_RAW
+  // Non corrigée par NTP : pas de saut ni de dérive pendant une mesure
+  if (clock_gettime(CLOCK_MONOTONIC_RAW, &ts) != 0)
+#endif
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+uint64_t dsa_timing_cycles(void) {
+#ifdef TIMING_HAS_RDTSC
+  return (uint64_t)__rdtsc();
+#else
+  return 0;
+#endif
+}
+
+bool dsa_timing_has_cycles(void) {
+#ifdef TIMING_HAS_RDTSC
+  return true;
+#else
+  return false;
+#endif
+}
+
+DsaTimingMark dsa_timing_mark(void) {
+  DsaTimingMark mark;
+  mark.cycles = dsa_timing_cycles();
+  mark.ns = dsa_timing_now_ns();
+  return mark;
+}
+
+DsaTimingSample dsa_timing_since(DsaTimingMark mark) {
+  DsaTimingSample sample;
+  sample.ns = dsa_timing_now_ns() - mark.ns;
+  sample.cycles = dsa_timing_cycles() - mark.cycles;
+  return sample;
+}
+
+double dsa_timing_ns_to_ms(uint64_t ns) { return (double)ns / 1e6; }
+
+double dsa_timing_ns_to_s(uint64_t ns) { return (double)ns / 1e9; }
+
+// --- Statistiques ---
+
+static int compare_u64(const void *a, const void *b) {
+  uint64_t x = *(const uint64_t *)a;
+  uint64_t y = *(const uint64_t *)b;
+  return (x > y) - (x < y);
+}
+
+DsaTimingStats dsa_timing_stats(uint64_t *samples_ns, size_t count) {
+  DsaTimingStats stats = {0};
+  if (count == 0 || !samples_ns)
+    return stats;
+
+  qsort(samples_ns, count, sizeof(uint64_t), compare_u64);
+
+  double sum = 0.0;
+  for (size_t i = 0; i < count; i++)
+    sum += (double)samples_ns[i];
+
+  stats.count = count;
+  stats.min_ns = samples_ns[0];
+  stats.max_ns = samples_ns[count - 1];
+  stats.median_ns = (count % 2) ? samples_ns[count / 2]
+                                : (samples_ns[count / 2 - 1] +
+                                   (samples_ns[count / 2] -
+                                    samples_ns[count / 2 - 1]) /
+                                       2);
+  // Rang le plus proche : plus petite valeur couvrant 99 % des mesures
+  size_t rank = (count * 99 + 99) / 100;
+  stats.p99_ns = samples_ns[rank - 1];
+  stats.mean_ns = sum / (double)count;
+
+  // Rangs j et k (base 1) de l'intervalle de la médiane : approximation
+  // normale de la loi binomiale B(n, 1/2), n/2 -/+ 1.96 * sqrt(n) / 2
+  double half_width = 0.98 * sqrt((double)count);
+  double low = floor((double)count / 2.0 - half_width + 0.5);
+  double high = floor(1.0 + (double)count / 2.0 + half_width + 0.5);
+  size_t j = low < 1.0 ? 1 : (size_t)low;
+  size_t k = high > (double)count ? count : (size_t)high;
+  stats.ci_low_ns = samples_ns[j - 1];
+  stats.ci_high_ns = samples_ns[k - 1];
+  return stats;
+}
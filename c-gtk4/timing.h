@@ -0,0 +1,53 @@
+#ifndef TIMING_H
+#define TIMING_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Mesure ponctuelle : durée écoulée en nanosecondes (horloge monotone) et en
+// cycles processeur (rdtsc, 0 si le compteur est indisponible)
+typedef struct {
+  uint64_t ns;
+  uint64_t cycles;
+} DsaTimingSample;
+
+// Point de départ d'une mesure (voir dsa_timing_since)
+typedef struct {
+  uint64_t ns;
+  uint64_t cycles;
+} DsaTimingMark;
+
+// Statistiques sur des mesures répétées (en nanosecondes)
+typedef struct {
+  size_t count;
+  uint64_t min_ns;
+  uint64_t median_ns;
+  uint64_t p99_ns;
+  uint64_t max_ns;
+  double mean_ns;
+  // Intervalle de confiance à 95 % de la médiane (par rangs, sans hypothèse
+  // sur la distribution ; vaut [min, max] sous 6 mesures)
+  uint64_t ci_low_ns;
+  uint64_t ci_high_ns;
+} DsaTimingStats;
+
+// Horloge monotone en nanosecondes (CLOCK_MONOTONIC_RAW si disponible,
+// QueryPerformanceCounter sous Windows)
+uint64_t dsa_timing_now_ns(void);
+
+// Compteur de cycles du processeur (rdtsc sur x86, 0 ailleurs)
+uint64_t dsa_timing_cycles(void);
+bool dsa_timing_has_cycles(void);
+
+DsaTimingMark dsa_timing_mark(void);
+DsaTimingSample dsa_timing_since(DsaTimingMark mark);
+
+double dsa_timing_ns_to_ms(uint64_t ns);
+double dsa_timing_ns_to_s(uint64_t ns);
+
+// Min / médiane / p99 / max / moyenne et intervalle de confiance de la
+// médiane de `count` durées ; trie `samples_ns` en place
+DsaTimingStats dsa_timing_stats(uint64_t *samples_ns, size_t count);
+
+#endif
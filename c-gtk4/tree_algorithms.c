@@ -6,7 +6,7 @@
 // Helpers
 // ============================================================================
 
-static void traversal_add(TraversalResult *res, int value) {
+static void traversal_add(DsaTraversalResult *res, int value) {
   if (res->count >= res->capacity) {
     res->capacity = (res->capacity == 0) ? 10 : res->capacity * 2;
     res->values = (int *)realloc(res->values, res->capacity * sizeof(int));
@@ -14,7 +14,7 @@ static void traversal_add(TraversalResult *res, int value) {
   res->values[res->count++] = value;
 }
 
-void free_traversal_result(TraversalResult *res) {
+void dsa_free_traversal_result(DsaTraversalResult *res) {
   if (res->values)
     free(res->values);
   res->values = NULL;
@@ -26,8 +26,8 @@ void free_traversal_result(TraversalResult *res) {
 // BST Implementation
 // ============================================================================
 
-BinaryNode *create_binary_node(int value) {
-  BinaryNode *node = (BinaryNode *)malloc(sizeof(BinaryNode));
+DsaBinaryNode *dsa_create_binary_node(int value) {
+  DsaBinaryNode *node = (DsaBinaryNode *)malloc(sizeof(DsaBinaryNode));
   if (!node)
     return NULL;
   node->value = value;
@@ -38,145 +38,145 @@ BinaryNode *create_binary_node(int value) {
   return node;
 }
 
-BinaryNode *bst_insert(BinaryNode *root, int value) {
+DsaBinaryNode *dsa_bst_insert(DsaBinaryNode *root, int value) {
   if (!root)
-    return create_binary_node(value);
+    return dsa_create_binary_node(value);
 
   if (value < root->value) {
-    root->left = bst_insert(root->left, value);
+    root->left = dsa_bst_insert(root->left, value);
   } else if (value > root->value) {
-    root->right = bst_insert(root->right, value);
+    root->right = dsa_bst_insert(root->right, value);
   }
   // Si égal, on ne fait rien (pas de doublons dans ce BST simple)
   return root;
 }
 
-static BinaryNode *bst_min_value_node(BinaryNode *node) {
-  BinaryNode *current = node;
+static DsaBinaryNode *bst_min_value_node(DsaBinaryNode *node) {
+  DsaBinaryNode *current = node;
   while (current && current->left != NULL)
     current = current->left;
   return current;
 }
 
-BinaryNode *bst_delete(BinaryNode *root, int value) {
+DsaBinaryNode *dsa_bst_delete(DsaBinaryNode *root, int value) {
   if (!root)
     return root;
 
   if (value < root->value) {
-    root->left = bst_delete(root->left, value);
+    root->left = dsa_bst_delete(root->left, value);
   } else if (value > root->value) {
-    root->right = bst_delete(root->right, value);
+    root->right = dsa_bst_delete(root->right, value);
   } else {
     // Trouvé
     if (root->left == NULL) {
-      BinaryNode *temp = root->right;
+      DsaBinaryNode *temp = root->right;
       free(root);
       return temp;
     } else if (root->right == NULL) {
-      BinaryNode *temp = root->left;
+      DsaBinaryNode *temp = root->left;
       free(root);
       return temp;
     }
 
     // 2 enfants: successeur in-order (plus petit du sous-arbre droit)
-    BinaryNode *temp = bst_min_value_node(root->right);
+    DsaBinaryNode *temp = bst_min_value_node(root->right);
     root->value = temp->value; // Copie valeur
     root->right =
-        bst_delete(root->right, temp->value); // Supprime le successeur
+        dsa_bst_delete(root->right, temp->value); // Supprime le successeur
   }
   return root;
 }
 
-void bst_modify(BinaryNode **root, int old_val, int new_val) {
-  *root = bst_delete(*root, old_val);
-  *root = bst_insert(*root, new_val);
+void dsa_bst_modify(DsaBinaryNode **root, int old_val, int new_val) {
+  *root = dsa_bst_delete(*root, old_val);
+  *root = dsa_bst_insert(*root, new_val);
 }
 
-BinaryNode *bst_search(BinaryNode *root, int value) {
+DsaBinaryNode *dsa_bst_search(DsaBinaryNode *root, int value) {
   if (!root || root->value == value)
     return root;
   if (value < root->value)
-    return bst_search(root->left, value);
-  return bst_search(root->right, value);
+    return dsa_bst_search(root->left, value);
+  return dsa_bst_search(root->right, value);
 }
 
-void free_binary_tree(BinaryNode *root) {
+void dsa_free_binary_tree(DsaBinaryNode *root) {
   if (!root)
     return;
-  free_binary_tree(root->left);
-  free_binary_tree(root->right);
+  dsa_free_binary_tree(root->left);
+  dsa_free_binary_tree(root->right);
   free(root);
 }
 
-int bst_get_height(BinaryNode *root) {
+int dsa_bst_get_height(DsaBinaryNode *root) {
   if (!root)
     return 0;
-  int lh = bst_get_height(root->left);
-  int rh = bst_get_height(root->right);
+  int lh = dsa_bst_get_height(root->left);
+  int rh = dsa_bst_get_height(root->right);
   return 1 + (lh > rh ? lh : rh);
 }
 
-int bst_get_size(BinaryNode *root) {
+int dsa_bst_get_size(DsaBinaryNode *root) {
   if (!root)
     return 0;
-  return 1 + bst_get_size(root->left) + bst_get_size(root->right);
+  return 1 + dsa_bst_get_size(root->left) + dsa_bst_get_size(root->right);
 }
 
 // BST Traversals
 
-void _bst_pre(BinaryNode *n, TraversalResult *r) {
+static void bst_collect_preorder(DsaBinaryNode *n, DsaTraversalResult *r) {
   if (!n)
     return;
   traversal_add(r, n->value);
-  _bst_pre(n->left, r);
-  _bst_pre(n->right, r);
+  bst_collect_preorder(n->left, r);
+  bst_collect_preorder(n->right, r);
 }
-TraversalResult bst_traverse_preorder(BinaryNode *root) {
-  TraversalResult r = {0};
-  _bst_pre(root, &r);
+DsaTraversalResult dsa_bst_traverse_preorder(DsaBinaryNode *root) {
+  DsaTraversalResult r = {0};
+  bst_collect_preorder(root, &r);
   return r;
 }
 
-void _bst_in(BinaryNode *n, TraversalResult *r) {
+static void bst_collect_inorder(DsaBinaryNode *n, DsaTraversalResult *r) {
   if (!n)
     return;
-  _bst_in(n->left, r);
+  bst_collect_inorder(n->left, r);
   traversal_add(r, n->value);
-  _bst_in(n->right, r);
+  bst_collect_inorder(n->right, r);
 }
-TraversalResult bst_traverse_inorder(BinaryNode *root) {
-  TraversalResult r = {0};
-  _bst_in(root, &r);
+DsaTraversalResult dsa_bst_traverse_inorder(DsaBinaryNode *root) {
+  DsaTraversalResult r = {0};
+  bst_collect_inorder(root, &r);
   return r;
 }
 
-void _bst_post(BinaryNode *n, TraversalResult *r) {
+static void bst_collect_postorder(DsaBinaryNode *n, DsaTraversalResult *r) {
   if (!n)
     return;
-  _bst_post(n->left, r);
-  _bst_post(n->right, r);
+  bst_collect_postorder(n->left, r);
+  bst_collect_postorder(n->right, r);
   traversal_add(r, n->value);
 }
-TraversalResult bst_traverse_postorder(BinaryNode *root) {
-  TraversalResult r = {0};
-  _bst_post(root, &r);
+DsaTraversalResult dsa_bst_traverse_postorder(DsaBinaryNode *root) {
+  DsaTraversalResult r = {0};
+  bst_collect_postorder(root, &r);
   return r;
 }
 
-TraversalResult bst_traverse_bfs(BinaryNode *root) {
-  TraversalResult r = {0};
+DsaTraversalResult dsa_bst_traverse_bfs(DsaBinaryNode *root) {
+  DsaTraversalResult r = {0};
   if (!root)
     return r;
 
   // File simple (tableau dynamique)
-  BinaryNode **queue = (BinaryNode **)malloc(
-      10000 * sizeof(BinaryNode *)); // Capacité fixe simple
+  DsaBinaryNode **queue = (DsaBinaryNode **)malloc(
+      10000 * sizeof(DsaBinaryNode *)); // Capacité fixe simple
   int front = 0, rear = 0;
 
   queue[rear++] = root;
 
   while (front < rear) {
-    BinaryNode *n = queue[front++];
+    DsaBinaryNode *n = queue[front++];
     traversal_add(&r, n->value);
     if (n->left)
       queue[rear++] = n->left;
@@ -192,69 +192,70 @@ TraversalResult bst_traverse_bfs(BinaryNode *root) {
 // N-ary Implementation
 // ============================================================================
 
-NaryNode *create_nary_node(int value) {
-  NaryNode *node = (NaryNode *)malloc(sizeof(NaryNode));
+DsaNaryNode *dsa_create_nary_node(int value) {
+  DsaNaryNode *node = (DsaNaryNode *)malloc(sizeof(DsaNaryNode));
   if (!node)
     return NULL;
   node->value = value;
   node->num_children = 0;
   node->capacity = 2;
-  node->children = (NaryNode **)malloc(sizeof(NaryNode *) * node->capacity);
+  node->children =
+      (DsaNaryNode **)malloc(sizeof(DsaNaryNode *) * node->capacity);
   node->x = 0;
   node->y = 0;
   return node;
 }
 
-void add_child_internal(NaryNode *parent, NaryNode *child) {
+static void nary_add_child(DsaNaryNode *parent, DsaNaryNode *child) {
   if (!parent || !child)
     return;
   if (parent->num_children >= parent->capacity) {
     parent->capacity *= 2;
-    parent->children = (NaryNode **)realloc(
-        parent->children, sizeof(NaryNode *) * parent->capacity);
+    parent->children = (DsaNaryNode **)realloc(
+        parent->children, sizeof(DsaNaryNode *) * parent->capacity);
   }
   parent->children[parent->num_children++] = child;
 }
 
-NaryNode *nary_search(NaryNode *root, int value) {
+DsaNaryNode *dsa_nary_search(DsaNaryNode *root, int value) {
   if (!root)
     return NULL;
   if (root->value == value)
     return root;
   for (int i = 0; i < root->num_children; i++) {
-    NaryNode *res = nary_search(root->children[i], value);
+    DsaNaryNode *res = dsa_nary_search(root->children[i], value);
     if (res)
       return res;
   }
   return NULL;
 }
 
-NaryNode *nary_find_parent(NaryNode *root, int value) {
+DsaNaryNode *dsa_nary_find_parent(DsaNaryNode *root, int value) {
   if (!root)
     return NULL;
   for (int i = 0; i < root->num_children; i++) {
     if (root->children[i]->value == value)
       return root;
-    NaryNode *res = nary_find_parent(root->children[i], value);
+    DsaNaryNode *res = dsa_nary_find_parent(root->children[i], value);
     if (res)
       return res;
   }
   return NULL;
 }
 
-NaryNode *nary_insert(NaryNode *root, int value, int parent_value) {
+DsaNaryNode *dsa_nary_insert(DsaNaryNode *root, int value, int parent_value) {
   if (!root)
-    return create_nary_node(value);
+    return dsa_create_nary_node(value);
 
-  NaryNode *parent = nary_search(root, parent_value);
+  DsaNaryNode *parent = dsa_nary_search(root, parent_value);
   if (parent) {
-    add_child_internal(parent, create_nary_node(value));
+    nary_add_child(parent, dsa_create_nary_node(value));
     return root;
   }
   return root; // Parent non trouvé
 }
 
-NaryNode *nary_delete(NaryNode *root, int value) {
+DsaNaryNode *dsa_nary_delete(DsaNaryNode *root, int value) {
   if (!root)
     return NULL;
 
@@ -262,10 +263,10 @@ NaryNode *nary_delete(NaryNode *root, int value) {
   if (root->value == value) {
     if (root->num_children > 0) {
       // Promouvoir le premier enfant
-      NaryNode *new_root = root->children[0];
+      DsaNaryNode *new_root = root->children[0];
       // Ajouter les autres enfants de l'ancienne racine au nouveau
       for (int i = 1; i < root->num_children; i++) {
-        add_child_internal(new_root, root->children[i]);
+        nary_add_child(new_root, root->children[i]);
       }
       // Attention: root->children est un tableau de pointeurs, libération
       // propre nécessaire Ici on a déplacé les pointeurs, donc on peut juste
@@ -280,14 +281,14 @@ NaryNode *nary_delete(NaryNode *root, int value) {
     }
   }
 
-  NaryNode *parent = nary_find_parent(root, value);
+  DsaNaryNode *parent = dsa_nary_find_parent(root, value);
   if (parent) {
     for (int i = 0; i < parent->num_children; i++) {
       if (parent->children[i]->value == value) {
-        NaryNode *to_del = parent->children[i];
+        DsaNaryNode *to_del = parent->children[i];
         // Réattacher les petits-enfants au parent
         for (int j = 0; j < to_del->num_children; j++) {
-          add_child_internal(parent, to_del->children[j]);
+          nary_add_child(parent, to_del->children[j]);
         }
 
         // Supprimer l'élément du tableau du parent (shift)
@@ -305,87 +306,87 @@ NaryNode *nary_delete(NaryNode *root, int value) {
   return root;
 }
 
-void nary_modify(NaryNode *root, int old_val, int new_val) {
-  NaryNode *node = nary_search(root, old_val);
+void dsa_nary_modify(DsaNaryNode *root, int old_val, int new_val) {
+  DsaNaryNode *node = dsa_nary_search(root, old_val);
   if (node) {
     node->value = new_val;
   }
 }
 
-void free_nary_tree(NaryNode *root) {
+void dsa_free_nary_tree(DsaNaryNode *root) {
   if (!root)
     return;
   for (int i = 0; i < root->num_children; i++) {
-    free_nary_tree(root->children[i]);
+    dsa_free_nary_tree(root->children[i]);
   }
   free(root->children);
   free(root);
 }
 
-int nary_get_height(NaryNode *root) {
+int dsa_nary_get_height(DsaNaryNode *root) {
   if (!root)
     return 0;
   if (root->num_children == 0)
     return 1;
   int max_h = 0;
   for (int i = 0; i < root->num_children; i++) {
-    int h = nary_get_height(root->children[i]);
+    int h = dsa_nary_get_height(root->children[i]);
     if (h > max_h)
       max_h = h;
   }
   return 1 + max_h;
 }
 
-int nary_get_size(NaryNode *root) {
+int dsa_nary_get_size(DsaNaryNode *root) {
   if (!root)
     return 0;
   int size = 1;
   for (int i = 0; i < root->num_children; i++) {
-    size += nary_get_size(root->children[i]);
+    size += dsa_nary_get_size(root->children[i]);
   }
   return size;
 }
 
 // N-ary Traversals
 
-void _nary_pre(NaryNode *n, TraversalResult *r) {
+static void nary_collect_preorder(DsaNaryNode *n, DsaTraversalResult *r) {
   if (!n)
     return;
   traversal_add(r, n->value);
   for (int i = 0; i < n->num_children; i++)
-    _nary_pre(n->children[i], r);
+    nary_collect_preorder(n->children[i], r);
 }
-TraversalResult nary_traverse_preorder(NaryNode *root) {
-  TraversalResult r = {0};
-  _nary_pre(root, &r);
+DsaTraversalResult dsa_nary_traverse_preorder(DsaNaryNode *root) {
+  DsaTraversalResult r = {0};
+  nary_collect_preorder(root, &r);
   return r;
 }
 
-void _nary_post(NaryNode *n, TraversalResult *r) {
+static void nary_collect_postorder(DsaNaryNode *n, DsaTraversalResult *r) {
   if (!n)
     return;
   for (int i = 0; i < n->num_children; i++)
-    _nary_post(n->children[i], r);
+    nary_collect_postorder(n->children[i], r);
   traversal_add(r, n->value);
 }
-TraversalResult nary_traverse_postorder(NaryNode *root) {
-  TraversalResult r = {0};
-  _nary_post(root, &r);
+DsaTraversalResult dsa_nary_traverse_postorder(DsaNaryNode *root) {
+  DsaTraversalResult r = {0};
+  nary_collect_postorder(root, &r);
   return r;
 }
 
-TraversalResult nary_traverse_bfs(NaryNode *root) {
-  TraversalResult r = {0};
+DsaTraversalResult dsa_nary_traverse_bfs(DsaNaryNode *root) {
+  DsaTraversalResult r = {0};
   if (!root)
     return r;
 
-  NaryNode **queue = (NaryNode **)malloc(10000 * sizeof(NaryNode *));
+  DsaNaryNode **queue = (DsaNaryNode **)malloc(10000 * sizeof(DsaNaryNode *));
   int front = 0, rear = 0;
 
   queue[rear++] = root;
 
   while (front < rear) {
-    NaryNode *n = queue[front++];
+    DsaNaryNode *n = queue[front++];
     traversal_add(&r, n->value);
     for (int i = 0; i < n->num_children; i++)
       queue[rear++] = n->children[i];
@@ -399,15 +400,15 @@ TraversalResult nary_traverse_bfs(NaryNode *root) {
 // Conversion
 // ============================================================================
 
-BinaryNode *convert_nary_to_binary(NaryNode *nary_root) {
+DsaBinaryNode *dsa_convert_nary_to_binary(DsaNaryNode *nary_root) {
   if (!nary_root)
     return NULL;
-  BinaryNode *bin_root = create_binary_node(nary_root->value);
+  DsaBinaryNode *bin_root = dsa_create_binary_node(nary_root->value);
   if (nary_root->num_children > 0) {
-    bin_root->left = convert_nary_to_binary(nary_root->children[0]);
-    BinaryNode *current = bin_root->left;
+    bin_root->left = dsa_convert_nary_to_binary(nary_root->children[0]);
+    DsaBinaryNode *current = bin_root->left;
     for (int i = 1; i < nary_root->num_children; i++) {
-      current->right = convert_nary_to_binary(nary_root->children[i]);
+      current->right = dsa_convert_nary_to_binary(nary_root->children[i]);
       current = current->right;
     }
   }
@@ -9,59 +9,59 @@ typedef struct {
     int *values;
     int count;
     int capacity;
-} TraversalResult;
+} DsaTraversalResult;
 
-typedef struct BinaryNode {
+typedef struct DsaBinaryNode {
     int value;
-    struct BinaryNode *left;
-    struct BinaryNode *right;
+    struct DsaBinaryNode *left;
+    struct DsaBinaryNode *right;
     int x, y; // Pour l'affichage graphique
-} BinaryNode;
+} DsaBinaryNode;
 
-typedef struct NaryNode {
+typedef struct DsaNaryNode {
     int value;
-    struct NaryNode **children;
+    struct DsaNaryNode **children;
     int num_children;
     int capacity;
     int x, y; // Pour l'affichage graphique
-} NaryNode;
+} DsaNaryNode;
 
 // Fonctions utilitaires
-void free_traversal_result(TraversalResult *res);
+void dsa_free_traversal_result(DsaTraversalResult *res);
 
 // Fonctions pour Arbres Binaires (BST)
-BinaryNode *create_binary_node(int value);
-BinaryNode *bst_insert(BinaryNode *root, int value);
-BinaryNode *bst_delete(BinaryNode *root, int value);
-void bst_modify(BinaryNode **root, int old_val, int new_val);
-BinaryNode *bst_search(BinaryNode *root, int value);
-void free_binary_tree(BinaryNode *root);
-int bst_get_height(BinaryNode *root);
-int bst_get_size(BinaryNode *root);
+DsaBinaryNode *dsa_create_binary_node(int value);
+DsaBinaryNode *dsa_bst_insert(DsaBinaryNode *root, int value);
+DsaBinaryNode *dsa_bst_delete(DsaBinaryNode *root, int value);
+void dsa_bst_modify(DsaBinaryNode **root, int old_val, int new_val);
+DsaBinaryNode *dsa_bst_search(DsaBinaryNode *root, int value);
+void dsa_free_binary_tree(DsaBinaryNode *root);
+int dsa_bst_get_height(DsaBinaryNode *root);
+int dsa_bst_get_size(DsaBinaryNode *root);
 
 // Parcours BST
-TraversalResult bst_traverse_preorder(BinaryNode *root);
-TraversalResult bst_traverse_inorder(BinaryNode *root);
-TraversalResult bst_traverse_postorder(BinaryNode *root);
-TraversalResult bst_traverse_bfs(BinaryNode *root);
+DsaTraversalResult dsa_bst_traverse_preorder(DsaBinaryNode *root);
+DsaTraversalResult dsa_bst_traverse_inorder(DsaBinaryNode *root);
+DsaTraversalResult dsa_bst_traverse_postorder(DsaBinaryNode *root);
+DsaTraversalResult dsa_bst_traverse_bfs(DsaBinaryNode *root);
 
 // Fonctions pour Arbres N-aires
-NaryNode *create_nary_node(int value);
-NaryNode *nary_search(NaryNode *root, int value);
-NaryNode *nary_find_parent(NaryNode *root, int value);
-NaryNode *nary_insert(NaryNode *root, int value, int parent_value);
-NaryNode *nary_delete(NaryNode *root, int value);
-void nary_modify(NaryNode *root, int old_val, int new_val);
-void free_nary_tree(NaryNode *root);
-int nary_get_height(NaryNode *root);
-int nary_get_size(NaryNode *root);
+DsaNaryNode *dsa_create_nary_node(int value);
+DsaNaryNode *dsa_nary_search(DsaNaryNode *root, int value);
+DsaNaryNode *dsa_nary_find_parent(DsaNaryNode *root, int value);
+DsaNaryNode *dsa_nary_insert(DsaNaryNode *root, int value, int parent_value);
+DsaNaryNode *dsa_nary_delete(DsaNaryNode *root, int value);
+void dsa_nary_modify(DsaNaryNode *root, int old_val, int new_val);
+void dsa_free_nary_tree(DsaNaryNode *root);
+int dsa_nary_get_height(DsaNaryNode *root);
+int dsa_nary_get_size(DsaNaryNode *root);
 
 // Parcours N-aires
-TraversalResult nary_traverse_preorder(NaryNode *root);
-TraversalResult nary_traverse_postorder(NaryNode *root);
-TraversalResult nary_traverse_bfs(NaryNode *root);
+DsaTraversalResult dsa_nary_traverse_preorder(DsaNaryNode *root);
+DsaTraversalResult dsa_nary_traverse_postorder(DsaNaryNode *root);
+DsaTraversalResult dsa_nary_traverse_bfs(DsaNaryNode *root);
 
 // Conversion
-BinaryNode *convert_nary_to_binary(NaryNode *nary_root);
+DsaBinaryNode *dsa_convert_nary_to_binary(DsaNaryNode *nary_root);
 
 #endif // TREE_ALGORITHMS_H
@@ -1,4 +1,5 @@
 #include "trees_window.h"
+#include "prng.h"
 #include "tree_algorithms.h"
 #include <ctype.h>
 #include <gtk/gtk.h>
@@ -6,7 +7,6 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <time.h>
 
 
 #ifndef M_PI
@@ -55,8 +55,8 @@ typedef struct {
   GtkWidget *lbl_stats;
 
   // Data
-  NaryNode *nary_root;
-  BinaryNode *binary_root;
+  DsaNaryNode *nary_root;
+  DsaBinaryNode *binary_root;
   TreeMode current_mode;
   InputMode input_mode;
 } TreesWindowData;
@@ -82,7 +82,7 @@ static void log_message(TreesWindowData *data, const char *fmt, ...) {
 // Layout Calculation
 // ============================================================================
 
-static void layout_nary_robust(NaryNode *root, double *current_x, double y) {
+static void layout_nary_robust(DsaNaryNode *root, double *current_x, double y) {
   if (!root)
     return;
 
@@ -111,7 +111,7 @@ static void layout_nary_robust(NaryNode *root, double *current_x, double y) {
   }
 }
 
-static void layout_binary_inorder(BinaryNode *root, double *current_x,
+static void layout_binary_inorder(DsaBinaryNode *root, double *current_x,
                                   double y) {
   if (!root)
     return;
@@ -154,11 +154,11 @@ static void draw_node(cairo_t *cr, double x, double y, int value,
   cairo_show_text(cr, text);
 }
 
-static void draw_nary_links_and_nodes(cairo_t *cr, NaryNode *node) {
+static void draw_nary_links_and_nodes(cairo_t *cr, DsaNaryNode *node) {
   if (!node)
     return;
   for (int i = 0; i < node->num_children; i++) {
-    NaryNode *child = node->children[i];
+    DsaNaryNode *child = node->children[i];
     cairo_set_source_rgb(cr, 0.5, 0.5, 0.5);
     cairo_set_line_width(cr, 2.0);
     cairo_move_to(cr, node->x, node->y);
@@ -169,7 +169,7 @@ static void draw_nary_links_and_nodes(cairo_t *cr, NaryNode *node) {
   draw_node(cr, node->x, node->y, node->value, false);
 }
 
-static void draw_binary_links_and_nodes(cairo_t *cr, BinaryNode *node) {
+static void draw_binary_links_and_nodes(cairo_t *cr, DsaBinaryNode *node) {
   if (!node)
     return;
   if (node->left) {
@@ -224,7 +224,7 @@ static void draw_tree(GtkDrawingArea *area, cairo_t *cr, int width, int height,
 // Layout Helpers
 // ============================================================================
 
-static int count_leaves_nary(NaryNode *root) {
+static int count_leaves_nary(DsaNaryNode *root) {
   if (!root)
     return 0;
   if (root->num_children == 0)
@@ -236,7 +236,7 @@ static int count_leaves_nary(NaryNode *root) {
   return count;
 }
 
-static int count_leaves_binary(BinaryNode *root) {
+static int count_leaves_binary(DsaBinaryNode *root) {
   if (!root)
     return 0;
   if (!root->left && !root->right)
@@ -250,12 +250,12 @@ static void update_drawing_area_layout(TreesWindowData *data) {
 
   if (data->current_mode == MODE_NARY) {
     width_units = count_leaves_nary(data->nary_root);
-    height = nary_get_height(data->nary_root);
+    height = dsa_nary_get_height(data->nary_root);
   } else {
     // Binary layout is Inorder (one slot per node), so we need total size, not
     // just leaves
-    width_units = bst_get_size(data->binary_root);
-    height = bst_get_height(data->binary_root);
+    width_units = dsa_bst_get_size(data->binary_root);
+    height = dsa_bst_get_height(data->binary_root);
   }
 
   // Minimums
@@ -282,11 +282,11 @@ static void update_drawing_area_layout(TreesWindowData *data) {
 static void update_stats(TreesWindowData *data) {
   int size = 0, height = 0;
   if (data->current_mode == MODE_NARY) {
-    size = nary_get_size(data->nary_root);
-    height = nary_get_height(data->nary_root);
+    size = dsa_nary_get_size(data->nary_root);
+    height = dsa_nary_get_height(data->nary_root);
   } else {
-    size = bst_get_size(data->binary_root);
-    height = bst_get_height(data->binary_root);
+    size = dsa_bst_get_size(data->binary_root);
+    height = dsa_bst_get_height(data->binary_root);
   }
   char buf[64];
   snprintf(buf, sizeof(buf), "Taille: %d | Hauteur: %d", size, height);
@@ -300,17 +300,17 @@ static void on_insert_clicked(GtkWidget *btn, gpointer user_data) {
   int val = atoi(val_str);
 
   if (data->current_mode == MODE_BINARY) {
-    data->binary_root = bst_insert(data->binary_root, val);
+    data->binary_root = dsa_bst_insert(data->binary_root, val);
     log_message(data, "Inséré (BST): %d", val);
   } else {
     const char *parent_str =
         gtk_editable_get_text(GTK_EDITABLE(data->entry_insert_parent));
     if (strlen(parent_str) == 0 && data->nary_root == NULL) {
-      data->nary_root = nary_insert(data->nary_root, val, 0);
+      data->nary_root = dsa_nary_insert(data->nary_root, val, 0);
       log_message(data, "Inséré Racine (N-ary): %d", val);
     } else {
       int parent_val = atoi(parent_str);
-      data->nary_root = nary_insert(data->nary_root, val, parent_val);
+      data->nary_root = dsa_nary_insert(data->nary_root, val, parent_val);
       log_message(data, "Tentative insertion %d sous %d", val, parent_val);
     }
   }
@@ -324,10 +324,10 @@ static void on_delete_clicked(GtkWidget *btn, gpointer user_data) {
   int val = atoi(val_str);
 
   if (data->current_mode == MODE_BINARY) {
-    data->binary_root = bst_delete(data->binary_root, val);
+    data->binary_root = dsa_bst_delete(data->binary_root, val);
     log_message(data, "Supprimé (BST): %d", val);
   } else {
-    data->nary_root = nary_delete(data->nary_root, val);
+    data->nary_root = dsa_nary_delete(data->nary_root, val);
     log_message(data, "Supprimé (N-ary): %d", val);
   }
   update_stats(data);
@@ -343,10 +343,10 @@ static void on_modify_clicked(GtkWidget *btn, gpointer user_data) {
   int new_val = atoi(new_str);
 
   if (data->current_mode == MODE_BINARY) {
-    bst_modify(&data->binary_root, old_val, new_val);
+    dsa_bst_modify(&data->binary_root, old_val, new_val);
     log_message(data, "Modifié (BST): %d -> %d", old_val, new_val);
   } else {
-    nary_modify(data->nary_root, old_val, new_val);
+    dsa_nary_modify(data->nary_root, old_val, new_val);
     log_message(data, "Modifié (N-ary): %d -> %d", old_val, new_val);
   }
   update_stats(data);
@@ -361,35 +361,39 @@ static void on_generate_clicked(GtkWidget *btn, gpointer user_data) {
   if (count <= 0)
     count = 10;
 
-  srand(time(NULL));
+  // Graine affichée dans le journal pour pouvoir rejouer le tirage
+  uint64_t seed = dsa_prng_fresh_seed();
+  DsaPrng rng;
+  dsa_prng_seed(&rng, seed);
 
   if (data->binary_root) {
-    free_binary_tree(data->binary_root);
+    dsa_free_binary_tree(data->binary_root);
     data->binary_root = NULL;
   }
   if (data->nary_root) {
-    free_nary_tree(data->nary_root);
+    dsa_free_nary_tree(data->nary_root);
     data->nary_root = NULL;
   }
 
   int *values = malloc(count * sizeof(int));
   for (int i = 0; i < count; i++)
-    values[i] = rand() % 100 + 1;
+    values[i] = (int)dsa_prng_bounded(&rng, 100) + 1;
 
   if (data->current_mode == MODE_BINARY) {
     for (int i = 0; i < count; i++)
-      data->binary_root = bst_insert(data->binary_root, values[i]);
+      data->binary_root = dsa_bst_insert(data->binary_root, values[i]);
   } else {
     if (count > 0) {
-      data->nary_root = nary_insert(NULL, values[0], 0);
+      data->nary_root = dsa_nary_insert(NULL, values[0], 0);
       for (int i = 1; i < count; i++) {
-        int parent_idx = rand() % i;
-        nary_insert(data->nary_root, values[i], values[parent_idx]);
+        int parent_idx = (int)dsa_prng_bounded(&rng, (uint32_t)i);
+        dsa_nary_insert(data->nary_root, values[i], values[parent_idx]);
       }
     }
   }
   free(values);
-  log_message(data, "Généré aléatoirement %d noeuds", count);
+  log_message(data, "Généré aléatoirement %d noeuds (graine %llu)", count,
+              (unsigned long long)seed);
   update_stats(data);
   gtk_widget_queue_draw(data->drawing_area);
 }
@@ -397,11 +401,11 @@ static void on_generate_clicked(GtkWidget *btn, gpointer user_data) {
 static void on_clear_clicked(GtkWidget *btn, gpointer user_data) {
   TreesWindowData *data = (TreesWindowData *)user_data;
   if (data->binary_root) {
-    free_binary_tree(data->binary_root);
+    dsa_free_binary_tree(data->binary_root);
     data->binary_root = NULL;
   }
   if (data->nary_root) {
-    free_nary_tree(data->nary_root);
+    dsa_free_nary_tree(data->nary_root);
     data->nary_root = NULL;
   }
   log_message(data, "Arbre vidé");
@@ -415,8 +419,8 @@ static void on_convert_clicked(GtkWidget *btn, gpointer user_data) {
     return;
 
   if (data->binary_root)
-    free_binary_tree(data->binary_root);
-  data->binary_root = convert_nary_to_binary(data->nary_root);
+    dsa_free_binary_tree(data->binary_root);
+  data->binary_root = dsa_convert_nary_to_binary(data->nary_root);
 
   data->current_mode = MODE_BINARY;
   gtk_drop_down_set_selected(GTK_DROP_DOWN(data->combo_tree_type), 0);
@@ -433,37 +437,37 @@ static void on_execute_traversal_clicked(GtkWidget *btn, gpointer user_data) {
   int method_idx =
       gtk_drop_down_get_selected(GTK_DROP_DOWN(data->combo_trav_method));
 
-  TraversalResult res = {0};
+  DsaTraversalResult res = {0};
   char *method_name = "";
 
   if (data->current_mode == MODE_BINARY) {
     if (type_idx == 1) { // BFS
-      res = bst_traverse_bfs(data->binary_root);
+      res = dsa_bst_traverse_bfs(data->binary_root);
       method_name = "Largeur (BFS)";
     } else {
       if (method_idx == 0) {
-        res = bst_traverse_preorder(data->binary_root);
+        res = dsa_bst_traverse_preorder(data->binary_root);
         method_name = "Pré-ordre";
       } else if (method_idx == 1) {
-        res = bst_traverse_inorder(data->binary_root);
+        res = dsa_bst_traverse_inorder(data->binary_root);
         method_name = "In-ordre";
       } else {
-        res = bst_traverse_postorder(data->binary_root);
+        res = dsa_bst_traverse_postorder(data->binary_root);
         method_name = "Post-ordre";
       }
     }
   } else {
     if (type_idx == 1) { // BFS
-      res = nary_traverse_bfs(data->nary_root);
+      res = dsa_nary_traverse_bfs(data->nary_root);
       method_name = "Largeur (BFS)";
     } else {
       if (method_idx == 1)
         log_message(data, "Attention: In-ordre ignore pour N-aire");
       if (method_idx == 2) {
-        res = nary_traverse_postorder(data->nary_root);
+        res = dsa_nary_traverse_postorder(data->nary_root);
         method_name = "Post-ordre";
       } else {
-        res = nary_traverse_preorder(data->nary_root);
+        res = dsa_nary_traverse_preorder(data->nary_root);
         method_name = "Pré-ordre";
       }
     }
@@ -481,7 +485,7 @@ static void on_execute_traversal_clicked(GtkWidget *btn, gpointer user_data) {
   log_message(data, "%s", str->str);
 
   g_string_free(str, TRUE);
-  free_traversal_result(&res);
+  dsa_free_traversal_result(&res);
 }
 
 // ============================================================================
@@ -589,11 +593,11 @@ static void on_manual_dialog_ok(GtkWidget *btn, gpointer user_data) {
 
   // Second pass: Processing
   if (data->binary_root) {
-    free_binary_tree(data->binary_root);
+    dsa_free_binary_tree(data->binary_root);
     data->binary_root = NULL;
   }
   if (data->nary_root) {
-    free_nary_tree(data->nary_root);
+    dsa_free_nary_tree(data->nary_root);
     data->nary_root = NULL;
   }
 
@@ -641,14 +645,14 @@ static void on_manual_dialog_ok(GtkWidget *btn, gpointer user_data) {
   for (int i = 0; i < count; i++) {
     int val = values[i];
     if (data->current_mode == MODE_BINARY) {
-      data->binary_root = bst_insert(data->binary_root, val);
+      data->binary_root = dsa_bst_insert(data->binary_root, val);
     } else {
       if (i == 0) {
-        data->nary_root = nary_insert(NULL, val, 0);
+        data->nary_root = dsa_nary_insert(NULL, val, 0);
       } else {
         int parent_idx = (i - 1) / n_degree;
         if (parent_idx >= 0 && parent_idx < i) {
-          nary_insert(data->nary_root, val, values[parent_idx]);
+          dsa_nary_insert(data->nary_root, val, values[parent_idx]);
         }
       }
     }
@@ -787,9 +791,9 @@ static void on_input_mode_changed(GtkCheckButton *btn, gpointer user_data) {
 static void on_window_destroy(GtkWidget *widget, gpointer user_data) {
   TreesWindowData *data = (TreesWindowData *)user_data;
   if (data->binary_root)
-    free_binary_tree(data->binary_root);
+    dsa_free_binary_tree(data->binary_root);
   if (data->nary_root)
-    free_nary_tree(data->nary_root);
+    dsa_free_nary_tree(data->nary_root);
   g_free(data);
 }
 
@@ -0,0 +1,331 @@
+#include "unrolled_list.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Les valeurs sont écrites octet par octet depuis DsaNodeData : tous les
+// membres de l'union commencent à son premier octet.
+
+static char *block_slot(const DsaUnrolledList *list, DsaUnrolledBlock *block,
+                        int index) {
+  return (char *)block->values + (size_t)index * list->value_size;
+}
+
+static void store_value(const DsaUnrolledList *list, DsaUnrolledBlock *block,
+                        int index, DsaNodeData data) {
+  memcpy(block_slot(list, block, index), &data, list->value_size);
+}
+
+// Déplace `count` valeurs entre deux emplacements (blocs éventuellement
+// identiques)
+static void move_values(const DsaUnrolledList *list, DsaUnrolledBlock *to,
+                        int to_index, DsaUnrolledBlock *from, int from_index,
+                        int count) {
+  memmove(block_slot(list, to, to_index), block_slot(list, from, from_index),
+          (size_t)count * list->value_size);
+}
+
+static void free_block_strings(const DsaUnrolledList *list,
+                               DsaUnrolledBlock *block) {
+  for (int i = 0; i < block->count; i++)
+    free(dsa_unrolled_block_value(list, block, i).string_val);
+}
+
+// Nouveau bloc vide, chaîné après `previous` (en tête si NULL)
+static DsaUnrolledBlock *insert_block_after(DsaUnrolledList *list,
+                                            DsaUnrolledBlock *previous) {
+  DsaUnrolledBlock *block =
+      (DsaUnrolledBlock *)dsa_node_pool_alloc(&list->pool);
+  if (!block)
+    return NULL;
+  block->count = 0;
+  if (previous) {
+    block->next = previous->next;
+    previous->next = block;
+  } else {
+    block->next = list->head;
+    list->head = block;
+  }
+  if (list->tail == previous)
+    list->tail = block;
+  list->blocks++;
+  return block;
+}
+
+static void remove_block_after(DsaUnrolledList *list,
+                               DsaUnrolledBlock *previous,
+                               DsaUnrolledBlock *block) {
+  if (previous)
+    previous->next = block->next;
+  else
+    list->head = block->next;
+  if (list->tail == block)
+    list->tail = previous;
+  dsa_node_pool_free(&list->pool, block);
+  list->blocks--;
+}
+
+// Bloc contenant la position (< list->size) ; `position` devient l'indice
+// dans ce bloc
+static DsaUnrolledBlock *find_block(const DsaUnrolledList *list, int *position,
+                                    DsaUnrolledBlock **previous) {
+  DsaUnrolledBlock *before = NULL;
+  DsaUnrolledBlock *block = list->head;
+  while (*position >= block->count) {
+    *position -= block->count;
+    before = block;
+    block = block->next;
+  }
+  if (previous)
+    *previous = before;
+  return block;
+}
+
+DsaUnrolledList *dsa_create_unrolled_list(DsaDataType type) {
+  DsaUnrolledList *list = (DsaUnrolledList *)malloc(sizeof(DsaUnrolledList));
+  if (list) {
+    list->head = NULL;
+    list->tail = NULL;
+    list->type = type;
+    list->size = 0;
+    list->value_size = dsa_array_element_size(type);
+    list->capacity =
+        (int)((DSA_UNROLLED_BLOCK_BYTES - sizeof(DsaUnrolledBlock)) /
+              list->value_size);
+    list->blocks = 0;
+    // Réserve toujours active : les blocs de malloc ne seraient pas alignés
+    dsa_node_pool_init(&list->pool, DSA_UNROLLED_BLOCK_BYTES, true);
+  }
+  return list;
+}
+
+void dsa_free_unrolled_list(DsaUnrolledList *list) {
+  if (!list)
+    return;
+
+  if (list->type == DSA_TYPE_STRING) {
+    for (DsaUnrolledBlock *block = list->head; block; block = block->next)
+      free_block_strings(list, block);
+  }
+  dsa_node_pool_release(&list->pool);
+  free(list);
+}
+
+bool dsa_insert_unrolled_at_beginning(DsaUnrolledList *list, DsaNodeData data) {
+  return dsa_insert_unrolled_at_position(list, data, 0);
+}
+
+bool dsa_insert_unrolled_at_end(DsaUnrolledList *list, DsaNodeData data) {
+  if (!list)
+    return false;
+
+  DsaUnrolledBlock *block = list->tail;
+  if (!block || block->count == list->capacity) {
+    block = insert_block_after(list, list->tail);
+    if (!block)
+      return false;
+  }
+  store_value(list, block, block->count++, data);
+  list->size++;
+  return true;
+}
+
+bool dsa_insert_unrolled_at_position(DsaUnrolledList *list, DsaNodeData data,
+                                     int position) {
+  if (!list || position < 0 || position > list->size)
+    return false;
+  if (position == list->size)
+    return dsa_insert_unrolled_at_end(list, data);
+
+  int index = position;
+  DsaUnrolledBlock *block = find_block(list, &index, NULL);
+  if (block->count == list->capacity) {
+    // Bloc plein : sa seconde moitié passe dans un nouveau bloc
+    DsaUnrolledBlock *half = insert_block_after(list, block);
+    if (!half)
+      return false;
+    int keep = block->count / 2;
+    half->count = block->count - keep;
+    move_values(list, half, 0, block, keep, half->count);
+    block->count = keep;
+    if (index > keep) {
+      index -= keep;
+      block = half;
+    }
+  }
+  move_values(list, block, index + 1, block, index, block->count - index);
+  store_value(list, block, index, data);
+  block->count++;
+  list->size++;
+  return true;
+}
+
+bool dsa_delete_unrolled_at_position(DsaUnrolledList *list, int position) {
+  if (!list || position < 0 || position >= list->size)
+    return false;
+
+  int index = position;
+  DsaUnrolledBlock *previous;
+  DsaUnrolledBlock *block = find_block(list, &index, &previous);
+  if (list->type == DSA_TYPE_STRING)
+    free(dsa_unrolled_block_value(list, block, index).string_val);
+  move_values(list, block, index, block, index + 1, block->count - index - 1);
+  block->count--;
+  list->size--;
+
+  DsaUnrolledBlock *next = block->next;
+  int minimum = list->capacity / 2;
+  if (block->count >= minimum)
+    return true;
+  if (next && block->count + next->count <= list->capacity) {
+    // Fusion avec le bloc suivant
+    move_values(list, block, block->count, next, 0, next->count);
+    block->count += next->count;
+    remove_block_after(list, block, next);
+  } else if (next) {
+    // Emprunt au bloc suivant, réparti entre les deux
+    int moved = (next->count - block->count) / 2;
+    move_values(list, block, block->count, next, 0, moved);
+    move_values(list, next, 0, next, moved, next->count - moved);
+    block->count += moved;
+    next->count -= moved;
+  } else if (block->count == 0) {
+    remove_block_after(list, previous, block);
+  }
+  return true;
+}
+
+bool dsa_modify_unrolled_at_position(DsaUnrolledList *list, DsaNodeData data,
+                                     int position) {
+  if (!list || position < 0 || position >= list->size)
+    return false;
+
+  int index = position;
+  DsaUnrolledBlock *block = find_block(list, &index, NULL);
+  if (list->type == DSA_TYPE_STRING)
+    free(dsa_unrolled_block_value(list, block, index).string_val);
+  store_value(list, block, index, data);
+  return true;
+}
+
+bool dsa_get_unrolled_at(const DsaUnrolledList *list, int position,
+                         DsaNodeData *data) {
+  if (!list || position < 0 || position >= list->size)
+    return false;
+
+  // Les positions du dernier bloc (ajouts et lectures en fin) sans parcours
+  DsaUnrolledBlock *block;
+  int index = position - (list->size - list->tail->count);
+  if (index >= 0) {
+    block = list->tail;
+  } else {
+    index = position;
+    block = find_block(list, &index, NULL);
+  }
+  *data = dsa_unrolled_block_value(list, block, index);
+  return true;
+}
+
+bool dsa_append_unrolled_values(DsaUnrolledList *list,
+                                const DsaNodeData *values, int count) {
+  if (!list || count < 0)
+    return false;
+
+  // Blocs manquants alloués avant toute écriture
+  int room = list->tail ? list->capacity - list->tail->count : 0;
+  DsaUnrolledBlock *old_tail = list->tail;
+  for (int missing = count - room; missing > 0; missing -= list->capacity) {
+    if (!insert_block_after(list, list->tail)) {
+      while (list->tail != old_tail) {
+        DsaUnrolledBlock *added = old_tail ? old_tail->next : list->head;
+        remove_block_after(list, old_tail, added);
+      }
+      return false;
+    }
+  }
+
+  DsaUnrolledBlock *block = old_tail ? old_tail : list->head;
+  for (int i = 0; i < count; i++) {
+    if (block->count == list->capacity)
+      block = block->next;
+    store_value(list, block, block->count++, values[i]);
+  }
+  list->size += count;
+  return true;
+}
+
+DsaUnrolledList *dsa_copy_unrolled_list(const DsaUnrolledList *list) {
+  if (!list)
+    return NULL;
+  DsaUnrolledList *copy = dsa_create_unrolled_list(list->type);
+  if (!copy)
+    return NULL;
+
+  // Copie bloc à bloc, en gardant le remplissage de chaque bloc
+  for (DsaUnrolledBlock *block = list->head; block; block = block->next) {
+    DsaUnrolledBlock *target = insert_block_after(copy, copy->tail);
+    if (!target) {
+      dsa_free_unrolled_list(copy);
+      return NULL;
+    }
+    if (list->type != DSA_TYPE_STRING) {
+      move_values(list, target, 0, block, 0, block->count);
+      target->count = block->count;
+    } else {
+      for (int i = 0; i < block->count; i++) {
+        DsaNodeData value = dsa_unrolled_block_value(list, block, i);
+        DsaNodeData data = dsa_copy_node_data(value, list->type);
+        if (value.string_val && !data.string_val) {
+          dsa_free_unrolled_list(copy);
+          return NULL;
+        }
+        store_value(copy, target, target->count++, data);
+      }
+    }
+    copy->size += block->count;
+  }
+  return copy;
+}
+
+bool dsa_sort_unrolled_list(DsaUnrolledList *list, DsaSortAlgo algo) {
+  if (!list || list->size < 2)
+    return true;
+
+  char *values = (char *)malloc((size_t)list->size * list->value_size);
+  if (!values)
+    return false;
+
+  size_t offset = 0;
+  for (DsaUnrolledBlock *block = list->head; block; block = block->next) {
+    size_t bytes = (size_t)block->count * list->value_size;
+    memcpy(values + offset, block->values, bytes);
+    offset += bytes;
+  }
+
+  // Les chaînes triées restent à la liste : pas de dsa_free_array_data
+  DsaArrayData array = {
+      .array = values, .size = (size_t)list->size, .type = list->type};
+  dsa_sort_array(&array, algo);
+
+  offset = 0;
+  for (DsaUnrolledBlock *block = list->head; block; block = block->next) {
+    size_t bytes = (size_t)block->count * list->value_size;
+    memcpy(block->values, values + offset, bytes);
+    offset += bytes;
+  }
+  free(values);
+  return true;
+}
+
+void dsa_fill_unrolled_list_random(DsaUnrolledList *list, int count) {
+  if (!list)
+    return;
+
+  for (int i = 0; i < count; i++) {
+    DsaNodeData data = dsa_generate_random_node_data(list->type);
+    if (!dsa_insert_unrolled_at_end(list, data)) {
+      if (list->type == DSA_TYPE_STRING)
+        free(data.string_val);
+      return;
+    }
+  }
+}
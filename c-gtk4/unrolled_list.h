@@ -0,0 +1,86 @@
+#ifndef UNROLLED_LIST_H
+#define UNROLLED_LIST_H
+
+#include "list_algorithms.h"
+#include "sort_algorithms.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Liste déroulée : une liste chaînée de blocs de DSA_UNROLLED_BLOCK_BYTES
+// octets alignés sur une ligne de cache, chacun contenant plusieurs valeurs
+// contiguës stockées à leur taille naturelle (dsa_array_element_size), sans
+// type ni pointeur par valeur. Un accès par position saute un bloc entier par
+// lien suivi et les parcours lisent des valeurs voisines en mémoire. Comme
+// DsaSimpleList, la liste possède ses chaînes.
+//
+// Un bloc plein qui reçoit une insertion est coupé en deux ; un bloc qui
+// descend sous la moitié de sa capacité après une suppression reprend des
+// valeurs du bloc suivant, ou fusionne avec lui : hors du dernier, chaque
+// bloc reste au moins à moitié plein. Les ajouts en fin remplissent les
+// blocs entièrement.
+
+#define DSA_UNROLLED_BLOCK_BYTES 256
+
+typedef struct DsaUnrolledBlock {
+  struct DsaUnrolledBlock *next;
+  int count;         // Valeurs occupées, au début de `values`
+  uint64_t values[]; // `capacity` valeurs de `value_size` octets
+} DsaUnrolledBlock;
+
+typedef struct {
+  DsaUnrolledBlock *head;
+  DsaUnrolledBlock *tail;
+  DsaDataType type;
+  int size;
+  int capacity;      // Valeurs par bloc
+  size_t value_size; // Octets par valeur
+  int blocks;        // Nombre de blocs
+  DsaNodePool pool;  // Blocs de DSA_UNROLLED_BLOCK_BYTES octets
+} DsaUnrolledList;
+
+DsaUnrolledList *dsa_create_unrolled_list(DsaDataType type);
+void dsa_free_unrolled_list(DsaUnrolledList *list);
+bool dsa_insert_unrolled_at_beginning(DsaUnrolledList *list, DsaNodeData data);
+bool dsa_insert_unrolled_at_end(DsaUnrolledList *list, DsaNodeData data);
+bool dsa_insert_unrolled_at_position(DsaUnrolledList *list, DsaNodeData data,
+                                     int position);
+bool dsa_delete_unrolled_at_position(DsaUnrolledList *list, int position);
+bool dsa_modify_unrolled_at_position(DsaUnrolledList *list, DsaNodeData data,
+                                     int position);
+// Valeur à la position donnée (les chaînes restent à la liste)
+bool dsa_get_unrolled_at(const DsaUnrolledList *list, int position,
+                         DsaNodeData *data);
+// Mêmes garanties que dsa_append_simple_values
+bool dsa_append_unrolled_values(DsaUnrolledList *list,
+                                const DsaNodeData *values, int count);
+DsaUnrolledList *dsa_copy_unrolled_list(const DsaUnrolledList *list);
+
+// Tri par l'algorithme de tableau `algo` (dsa_sort_array) : les valeurs sont
+// rassemblées bloc par bloc dans un tableau contigu, triées, puis remises
+// dans les mêmes blocs. false si la mémoire manque (liste inchangée).
+bool dsa_sort_unrolled_list(DsaUnrolledList *list, DsaSortAlgo algo);
+
+void dsa_fill_unrolled_list_random(DsaUnrolledList *list, int count);
+
+// Valeur d'indice `index` d'un bloc (parcours bloc par bloc)
+static inline DsaNodeData dsa_unrolled_block_value(
+    const DsaUnrolledList *list, const DsaUnrolledBlock *block, int index) {
+  DsaNodeData data = {0};
+  switch (list->type) {
+  case DSA_TYPE_INT:
+    data.int_val = ((const int *)block->values)[index];
+    break;
+  case DSA_TYPE_FLOAT:
+    data.float_val = ((const float *)block->values)[index];
+    break;
+  case DSA_TYPE_CHAR:
+    data.char_val = ((const char *)block->values)[index];
+    break;
+  case DSA_TYPE_STRING:
+    data.string_val = ((char *const *)block->values)[index];
+    break;
+  }
+  return data;
+}
+
+#endif